@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file bench.hpp
+*
+* @brief Minimal, dependency-free micro-benchmark harness for the etools benchmarks.
+*
+* Each benchmark is a standalone executable (see `benchmarks/CMakeLists.txt`). The
+* harness repeats a measured body several times and reports the fastest run, which
+* is the least noisy estimator for short, cache-resident loops.
+*
+* Output is one line per measurement:
+* @code
+* <name>    <ns/op> ns/op    <Mops/s> Mop/s
+* @endcode
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_BENCHMARKS_BENCH_HPP_
+#define ETOOLS_BENCHMARKS_BENCH_HPP_
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+/// @brief Keeps a function out of line so a benchmark measures a real call.
+#if defined(_MSC_VER)
+    #define BENCH_NOINLINE __declspec(noinline)
+#else
+    #define BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+namespace bench {
+
+    /**
+    * @brief Prevents the optimizer from discarding a computed value.
+    */
+    template<typename T>
+    inline void do_not_optimize(const T& value) noexcept {
+    #if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+    #else
+        static volatile const T* sink;
+        sink = &value;
+    #endif
+    }
+
+    /**
+    * @brief Compiler-level memory barrier between measured repetitions.
+    */
+    inline void clobber() noexcept {
+    #if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : : "memory");
+    #endif
+    }
+
+    /**
+    * @brief Runs `body()` `reps` times and returns the fastest wall time in nanoseconds.
+    */
+    template<typename Fn>
+    inline double best_ns(std::size_t reps, Fn&& body) {
+        double best = 1e300;
+        for (std::size_t r = 0; r < reps; ++r) {
+            const auto t0 = std::chrono::steady_clock::now();
+            body();
+            clobber();
+            const auto t1 = std::chrono::steady_clock::now();
+            const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+            if (ns < best) best = ns;
+        }
+        return best;
+    }
+
+    /**
+    * @brief Measures `body()` (which performs `ops` operations) and prints a result line.
+    *
+    * @return Nanoseconds per operation of the fastest repetition.
+    */
+    template<typename Fn>
+    inline double run(const char* name, std::size_t ops, Fn&& body, std::size_t reps = 15) {
+        const double ns = best_ns(reps, body) / static_cast<double>(ops ? ops : 1);
+        std::printf("%-48s %10.3f ns/op %12.2f Mop/s\n", name, ns, 1e3 / ns);
+        return ns;
+    }
+
+    /**
+    * @brief Small deterministic PRNG (xorshift64*) so runs are reproducible.
+    */
+    struct rng {
+        std::uint64_t state = 0x9E3779B97F4A7C15ull;
+        std::uint64_t operator()() noexcept {
+            state ^= state >> 12;
+            state ^= state << 25;
+            state ^= state >> 27;
+            return state * 0x2545F4914F6CDD1Dull;
+        }
+    };
+
+} // namespace bench
+
+#endif // ETOOLS_BENCHMARKS_BENCH_HPP_
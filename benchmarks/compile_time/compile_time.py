@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+"""Compile-time benchmarks for the etools::meta metaprograms.
+
+Generates one synthetic translation unit per facility and pack size (packs of
+distinct types `t<0> .. t<N-1>`, spelled out literally so pack construction is
+not part of the measurement), compiles it with -fsyntax-only and reports, per
+case:
+
+  seconds          wall time of the compile
+  peak_rss_mb      peak resident memory of the compiler process
+  instantiations   template instantiations (Clang, from -ftime-trace; null on GCC)
+  instantiation_s  time spent instantiating templates (-ftime-report / -ftime-trace)
+
+The `baseline` facility only spells the pack; subtract it to isolate a facility.
+With --budgets, exits non-zero if any case listed in the budget file fails to
+compile or exceeds its limits:
+
+  { "sort": { "1000": { "seconds": 5.0, "peak_rss_mb": 400 } }, ... }
+
+    python3 compile_time.py --cxx g++ --include /path/to/repo [--sizes 10 100] [--json out.json]
+"""
+import argparse
+import json
+import os
+import re
+import signal
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+PRELUDE = """#include <cstddef>
+#include <type_traits>
+template<std::size_t I> struct t { char pad[I % 13 + 1]; };
+template<typename A, typename B> struct size_less : std::bool_constant<(sizeof(A) < sizeof(B))> {};
+"""
+
+
+def pack(n, name=lambda i: "t<{}>".format(i)):
+    return ", ".join(name(i) for i in range(n))
+
+
+def facility_baseline(n):
+    return "using pack = etools::meta::typelist<{}>;\n".format(pack(n))
+
+
+def facility_sort(n):
+    return ("using sorted = etools::meta::sort_t<size_less, {}>;\n"
+            "static_assert(!std::is_void_v<sorted>);\n").format(pack(n))
+
+
+def facility_unique_typelist(n):
+    # Every type appears twice: t<0>, t<0>, t<1>, t<1>, ...
+    return ("using uniq = etools::meta::unique_typelist_t<{}>;\n"
+            "static_assert(!std::is_void_v<uniq>);\n").format(pack(n, lambda i: "t<{}>".format(i // 2)))
+
+
+def facility_nth(n):
+    lines = ["#define PACK {}".format(pack(n))]
+    probes = sorted({(n - 1) * k // 15 for k in range(16)})
+    lines += ["static_assert(std::is_same_v<etools::meta::nth_t<{0}, PACK>, t<{0}>>);".format(i) for i in probes]
+    return "\n".join(lines) + "\n"
+
+
+def facility_is_distinct(n):
+    return "static_assert(etools::meta::is_distinct_v<{}>);\n".format(pack(n))
+
+
+def facility_typeset(n):
+    return ("using set = etools::meta::typeset<{}>;\n"
+            "bool probe(set& s) {{ s.set<t<{}>>(); s.reset<t<0>>(); return s.test<t<{}>>(); }}\n"
+            ).format(pack(n), n - 1, n // 2)
+
+
+# facility -> (header, TU body generator)
+FACILITIES = {
+    "baseline": ("typelist.hpp", facility_baseline),
+    "sort": ("sort.hpp", facility_sort),
+    "unique_typelist": ("unique_variant.hpp", facility_unique_typelist),
+    "nth": ("traits.hpp", facility_nth),
+    "is_distinct": ("traits.hpp", facility_is_distinct),
+    "typeset": ("typeset.hpp", facility_typeset),
+}
+
+
+def is_clang(cxx):
+    out = subprocess.run([cxx, "--version"], capture_output=True, text=True).stdout
+    return "clang" in out.lower()
+
+
+def run_compiler(cmd, timeout):
+    """Runs `cmd`; returns (returncode, stderr, seconds, peak_rss_mb).
+
+    The compiler runs in its own process group so that a timeout also kills
+    the driver's children (cc1plus / clang -cc1), and is reaped with wait4()
+    so that the peak RSS is that of this compile alone.
+    """
+    with tempfile.TemporaryFile(mode="w+") as err:
+        start = time.perf_counter()
+        proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL, stderr=err, start_new_session=True)
+        timer = threading.Timer(timeout, os.killpg, (proc.pid, signal.SIGKILL))
+        timer.start()
+        try:
+            _, status, usage = os.wait4(proc.pid, 0)
+        finally:
+            timer.cancel()
+        seconds = time.perf_counter() - start
+        proc.returncode = os.waitstatus_to_exitcode(status)
+        err.seek(0)
+        text = err.read()
+    if proc.returncode == -signal.SIGKILL and seconds >= timeout:
+        return None, "timeout after {:.0f}s".format(timeout), None, None
+    # ru_maxrss is in KiB on Linux, bytes on macOS.
+    rss_mb = usage.ru_maxrss / (1024.0 * 1024.0) if sys.platform == "darwin" else usage.ru_maxrss / 1024.0
+    return proc.returncode, text, seconds, rss_mb
+
+
+def gcc_instantiation_seconds(report):
+    m = re.search(r"^\s*template instantiation\s*:.*?\(\s*\d+%\)\s+\S+\s+\(\s*\d+%\)\s+(\d+\.\d+)", report, re.M)
+    return float(m.group(1)) if m else None
+
+
+def clang_trace(path):
+    with open(path) as f:
+        events = json.load(f).get("traceEvents", [])
+    names = ("InstantiateClass", "InstantiateFunction")
+    count = sum(1 for e in events if e.get("name") in names)
+    total = [e for e in events if e.get("name") == "Total PerformPendingInstantiations"]
+    seconds = total[0]["dur"] / 1e6 if total else None
+    return count, seconds
+
+
+def measure(args, clang, workdir, facility, n):
+    src = os.path.join(workdir, "{}_{}.cpp".format(facility, n))
+    with open(src, "w") as f:
+        header, body = FACILITIES[facility]
+        f.write("#include <etools/meta/{}>\n".format(header) + PRELUDE + body(n))
+
+    cmd = [args.cxx, "-std=c++17", "-fsyntax-only", "-I" + args.include]
+    if args.template_depth:
+        cmd.append("-ftemplate-depth={}".format(args.template_depth))
+    cmd += ["-ftime-trace", "-ftime-trace-granularity=0"] if clang else ["-ftime-report"]
+    if clang:
+        cmd += ["-o", os.path.join(workdir, "{}_{}.o".format(facility, n))]
+    cmd.append(src)
+
+    rc, err, seconds, rss = run_compiler(cmd, args.timeout)
+    result = {"facility": facility, "n": n, "ok": rc == 0, "seconds": seconds,
+              "peak_rss_mb": rss, "instantiations": None, "instantiation_s": None}
+    if rc != 0:
+        lines = err.strip().splitlines()
+        first = next((l for l in lines if "error" in l), lines[0] if lines else "")
+        result["error"] = first.strip()[:200]
+        return result
+    if clang:
+        trace = os.path.join(workdir, "{}_{}.json".format(facility, n))
+        if os.path.exists(trace):
+            result["instantiations"], result["instantiation_s"] = clang_trace(trace)
+    else:
+        result["instantiation_s"] = gcc_instantiation_seconds(err)
+    return result
+
+
+def over_budget(result, budgets):
+    limits = budgets.get(result["facility"], {}).get(str(result["n"]))
+    if limits is None:
+        return None
+    if not result["ok"]:
+        return "does not compile"
+    for key in ("seconds", "peak_rss_mb", "instantiations"):
+        if key in limits and result.get(key) is not None and result[key] > limits[key]:
+            return "{} {:.2f} > {}".format(key, result[key], limits[key])
+    return None
+
+
+def fmt(v, spec):
+    return "-" if v is None else format(v, spec)
+
+
+def main():
+    p = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    here = os.path.dirname(os.path.abspath(__file__))
+    p.add_argument("--cxx", default=os.environ.get("CXX", "g++"))
+    p.add_argument("--include", default=os.path.normpath(os.path.join(here, "..", "..")))
+    p.add_argument("--sizes", type=int, nargs="+", default=[10, 100, 1000, 5000])
+    p.add_argument("--facilities", nargs="+", default=list(FACILITIES), choices=list(FACILITIES))
+    p.add_argument("--template-depth", type=int, default=0, help="pass -ftemplate-depth (0: compiler default)")
+    p.add_argument("--timeout", type=float, default=120.0, help="per-compile timeout in seconds")
+    p.add_argument("--json", help="also write the results to this file")
+    p.add_argument("--budgets", help="JSON budget file; exit non-zero on any violation")
+    args = p.parse_args()
+
+    clang = is_clang(args.cxx)
+    budgets = {}
+    if args.budgets:
+        with open(args.budgets) as f:
+            budgets = json.load(f)
+
+    results, violations = [], []
+    print("{:<16} {:>5} {:>9} {:>9} {:>14} {:>10}  {}".format(
+        "facility", "N", "time [s]", "rss [MB]", "instantiations", "inst [s]", "status"))
+    with tempfile.TemporaryDirectory(prefix="etools_ct_") as workdir:
+        for facility in args.facilities:
+            for n in args.sizes:
+                r = measure(args, clang, workdir, facility, n)
+                results.append(r)
+                verdict = over_budget(r, budgets)
+                if verdict:
+                    violations.append("{} N={}: {}".format(facility, n, verdict))
+                status = "ok" if r["ok"] else r["error"]
+                if verdict:
+                    status += "  [over budget: {}]".format(verdict)
+                print("{:<16} {:>5} {:>9} {:>9} {:>14} {:>10}  {}".format(
+                    facility, n, fmt(r["seconds"], ".2f"), fmt(r["peak_rss_mb"], ".0f"),
+                    fmt(r["instantiations"], "d"), fmt(r["instantiation_s"], ".2f"), status), flush=True)
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump({"compiler": args.cxx, "clang": clang, "results": results,
+                       "violations": violations}, f, indent=2)
+    for v in violations:
+        print("budget violation: " + v, file=sys.stderr)
+    return 1 if violations else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
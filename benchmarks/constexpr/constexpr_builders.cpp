@@ -0,0 +1,83 @@
+// Constant-evaluation cost of the compile-time table builders.
+//
+// Not a run-time benchmark: constexpr_ops.py compiles this file with
+// -fsyntax-only for one case and key count at a time, and bisects the
+// smallest -fconstexpr-ops-limit (GCC) / -fconstexpr-steps (Clang) that still
+// accepts it. That number is the cost of the most expensive single constant
+// evaluation in the case.
+//
+//   -DETOOLS_CX_CASE=<n>   case number, see the table below
+//   -DETOOLS_CX_N=<count>  number of keys
+//
+// Keys are distinct, well-spread 64-bit values generated from the index.
+#include <etools/hashing/fks.hpp>
+#include <etools/hashing/llut.hpp>
+#include <etools/meta/algorithm.hpp>
+#include <etools/meta/utility.hpp>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+#ifndef ETOOLS_CX_CASE
+#define ETOOLS_CX_CASE 0
+#endif
+#ifndef ETOOLS_CX_N
+#define ETOOLS_CX_N 64
+#endif
+
+namespace {
+    constexpr std::size_t n = ETOOLS_CX_N;
+
+    constexpr std::uint64_t key_at(std::size_t i) { return (i + 1) * 0x9E3779B97F4A7C15ull; }
+
+    template<std::size_t... Is>
+    constexpr std::array<std::uint64_t, n> make_keys(std::index_sequence<Is...>) { return {{ key_at(Is)... }}; }
+
+    constexpr std::array<std::uint64_t, n> keys = make_keys(std::make_index_sequence<n>{});
+
+    template<std::size_t... Is>
+    constexpr std::size_t fks_probe(std::index_sequence<Is...>) {
+        return etools::hashing::fks<std::uint64_t>::instance<key_at(Is)...>()(key_at(0));
+    }
+
+    template<std::size_t... Is>
+    constexpr std::size_t llut_probe(std::index_sequence<Is...>) {
+        return etools::hashing::llut<std::uint16_t>::instance<static_cast<std::uint16_t>(Is * 3)...>()(0);
+    }
+
+    template<bool Radix>
+    constexpr std::uint64_t sort_checksum() {
+        auto a = keys;
+        if constexpr (Radix) etools::meta::radix_sort_array(a);
+        else etools::meta::sort_array(a, std::less<>{});
+        return a[0] ^ a[n - 1];
+    }
+
+    constexpr std::size_t partition_checksum() {
+        const auto p = etools::meta::counting_sort_by_bucket<n>(keys, [](std::uint64_t k) { return k % n; });
+        return p.offsets[n];
+    }
+} // namespace
+
+#if ETOOLS_CX_CASE == 0   // keys only: the floor every other case includes
+static_assert(keys[0] == key_at(0));
+#elif ETOOLS_CX_CASE == 1 // fks: full builder
+static_assert(fks_probe(std::make_index_sequence<n>{}) == 0);
+#elif ETOOLS_CX_CASE == 2 // llut: full builder (16-bit keys)
+static_assert(llut_probe(std::make_index_sequence<n>{}) == 0);
+#elif ETOOLS_CX_CASE == 3 // distinctness: open-addressing probe (all_distinct_fast for wide keys)
+static_assert(etools::meta::all_distinct_probe(keys));
+#elif ETOOLS_CX_CASE == 4 // distinctness: sort + adjacent compare
+static_assert(etools::meta::all_distinct_sorted(keys));
+#elif ETOOLS_CX_CASE == 5 // introsort
+static_assert(sort_checksum<false>() != 0);
+#elif ETOOLS_CX_CASE == 6 // LSD radix sort
+static_assert(sort_checksum<true>() != 0);
+#elif ETOOLS_CX_CASE == 7 // counting sort by bucket
+static_assert(partition_checksum() == n);
+#else
+#error "unknown ETOOLS_CX_CASE"
+#endif
+
+int main() { return 0; }
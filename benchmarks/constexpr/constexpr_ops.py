@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""Measure the constant-evaluation cost of the compile-time table builders.
+
+For every case in constexpr_builders.cpp and every key count, bisects the
+smallest -fconstexpr-ops-limit (GCC) or -fconstexpr-steps (Clang) that still
+compiles, and times a -fsyntax-only compile at a generous limit.
+
+    python3 constexpr_ops.py --cxx g++ --include /path/to/repo [--sizes 64 256] [--json out.json]
+"""
+import argparse
+import json
+import os
+import subprocess
+import sys
+import time
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SOURCE = os.path.join(HERE, "constexpr_builders.cpp")
+
+CASES = {
+    0: "keys only",
+    1: "fks builder",
+    2: "llut builder",
+    3: "all_distinct_probe",
+    4: "all_distinct_sorted",
+    5: "sort_array (introsort)",
+    6: "radix_sort_array",
+    7: "counting_sort_by_bucket",
+}
+
+CEILING = 4_000_000_000
+
+
+def limit_flag(cxx):
+    out = subprocess.run([cxx, "--version"], capture_output=True, text=True).stdout
+    if "clang" in out.lower():
+        return ["-fconstexpr-steps={}"], []
+    return ["-fconstexpr-ops-limit={}"], ["-fconstexpr-loop-limit=2147483647"]
+
+
+def compile_ok(args, case, n, limit):
+    cmd = [args.cxx, "-std=c++17", "-fsyntax-only", "-I" + args.include,
+           "-DETOOLS_CX_CASE={}".format(case), "-DETOOLS_CX_N={}".format(n)]
+    cmd += [f.format(limit) for f in args.limit_flags] + args.extra_flags + [SOURCE]
+    start = time.perf_counter()
+    ok = subprocess.run(cmd, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL).returncode == 0
+    return ok, time.perf_counter() - start
+
+
+def min_ops(args, case, n):
+    """Smallest accepted limit, to within --precision relative error; None if the case fails outright."""
+    ok, seconds = compile_ok(args, case, n, CEILING)
+    if not ok:
+        return None, None
+    lo, hi = 1, CEILING
+    while hi - lo > max(1, int(hi * args.precision)):
+        mid = (lo + hi) // 2
+        if compile_ok(args, case, n, mid)[0]:
+            hi = mid
+        else:
+            lo = mid
+    return hi, seconds
+
+
+def main():
+    p = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    p.add_argument("--cxx", default=os.environ.get("CXX", "g++"))
+    p.add_argument("--include", default=os.path.normpath(os.path.join(HERE, "..", "..")))
+    p.add_argument("--sizes", type=int, nargs="+", default=[64, 256, 1024])
+    p.add_argument("--cases", type=int, nargs="+", default=sorted(CASES))
+    p.add_argument("--precision", type=float, default=0.005)
+    p.add_argument("--json", help="also write the results to this file")
+    args = p.parse_args()
+    args.limit_flags, args.extra_flags = limit_flag(args.cxx)
+
+    results = []
+    print("{:<26} {:>6} {:>14} {:>10}".format("case", "N", "min ops", "time [s]"))
+    for case in args.cases:
+        for n in args.sizes:
+            ops, seconds = min_ops(args, case, n)
+            results.append({"case": CASES[case], "n": n, "ops": ops, "seconds": seconds})
+            print("{:<26} {:>6} {:>14} {:>10}".format(
+                CASES[case], n, "failed" if ops is None else ops,
+                "-" if seconds is None else "{:.2f}".format(seconds)), flush=True)
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump({"compiler": args.cxx, "results": results}, f, indent=2)
+    return 0 if all(r["ops"] is not None for r in results) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
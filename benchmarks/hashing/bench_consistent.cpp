@@ -0,0 +1,100 @@
+// Sharding: mix_u64(key) % n vs jump / rendezvous / bounded-load hashing.
+//
+// Part 1 reports throughput of the batch APIs (Mop/s == million keys/s) for
+// 16 shards. Part 2 reports which fraction of 256K keys changes shard when a
+// 17th shard is added and when one of the 16 is removed (the last one for
+// modulo and jump, whose numbering forbids holes; node 5 for rendezvous).
+// The ideal is 1/17 = 5.9% on add and 1/16 = 6.3% on remove.
+#include <bench.hpp>
+#include <etools/hashing/consistent.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace etools::hashing;
+
+BENCH_NOINLINE void modulo_batch(const std::uint64_t* keys, std::size_t count, std::uint32_t n, std::uint32_t* out) {
+    for (std::size_t i = 0; i < count; ++i) out[i] = static_cast<std::uint32_t>(mix_u64(keys[i]) % n);
+}
+
+static double moved(const std::vector<std::uint32_t>& a, const std::vector<std::uint32_t>& b) {
+    std::size_t m = 0;
+    for (std::size_t i = 0; i < a.size(); ++i) m += a[i] != b[i];
+    return 100.0 * static_cast<double>(m) / static_cast<double>(a.size());
+}
+
+int main() {
+    constexpr std::uint32_t shards = 16;
+    constexpr std::size_t count = 1 << 16;
+
+    bench::rng rng;
+    std::vector<std::uint64_t> keys(count);
+    for (auto& k : keys) k = rng();
+    std::vector<std::uint32_t> out(count);
+
+    std::uint64_t ids[shards + 1];
+    hrw_node nodes[shards + 1];
+    for (std::uint32_t i = 0; i <= shards; ++i) {
+        ids[i] = mix_u64(0x5EED + i);
+        nodes[i] = {ids[i], 1.0 + (i % 3)};
+    }
+
+    bench::run("modulo            n=16", count, [&] {
+        modulo_batch(keys.data(), count, shards, out.data());
+        bench::do_not_optimize(out[0]);
+    });
+    bench::run("jump_hash         n=16", count, [&] {
+        jump_hash(keys.data(), count, shards, out.data());
+        bench::do_not_optimize(out[0]);
+    });
+    bench::run("rendezvous        n=16", count, [&] {
+        rendezvous_hash(keys.data(), count, ids, shards, out.data());
+        bench::do_not_optimize(out[0]);
+    });
+    bench::run("rendezvous (w)    n=16", count, [&] {
+        rendezvous_hash(keys.data(), count, nodes, shards, out.data());
+        bench::do_not_optimize(out[0]);
+    });
+    bounded_load_hash<64> lb{shards, 0.25};
+    bench::run("bounded_load e=.25 n=16", count, [&] {
+        lb.clear();
+        lb.assign(keys.data(), count, out.data());
+        bench::do_not_optimize(out[0]);
+    });
+
+    // --- remapping ---------------------------------------------------------
+    constexpr std::size_t remap_keys = 1 << 18;
+    keys.resize(remap_keys);
+    for (auto& k : keys) k = rng();
+    std::vector<std::uint32_t> base(remap_keys), grown(remap_keys), shrunk(remap_keys);
+
+    auto report = [&](const char* name) {
+        std::printf("%-24s moved on add %5.1f%%   on remove %5.1f%%\n", name, moved(base, grown), moved(base, shrunk));
+    };
+
+    modulo_batch(keys.data(), remap_keys, shards, base.data());
+    modulo_batch(keys.data(), remap_keys, shards + 1, grown.data());
+    modulo_batch(keys.data(), remap_keys, shards - 1, shrunk.data());
+    report("modulo");
+
+    jump_hash(keys.data(), remap_keys, shards, base.data());
+    jump_hash(keys.data(), remap_keys, shards + 1, grown.data());
+    jump_hash(keys.data(), remap_keys, shards - 1, shrunk.data());
+    report("jump_hash");
+
+    // Compare node ids rather than positions: removing node 5 shifts the later indices.
+    std::uint64_t without5[shards - 1];
+    for (std::uint32_t i = 0, j = 0; i < shards; ++i) if (i != 5) without5[j++] = ids[i];
+    rendezvous_hash(keys.data(), remap_keys, ids, shards, base.data());
+    rendezvous_hash(keys.data(), remap_keys, ids, shards + 1, grown.data());
+    rendezvous_hash(keys.data(), remap_keys, without5, shards - 1, shrunk.data());
+    for (auto& s : shrunk) s = s >= 5 ? s + 1 : s;
+    report("rendezvous");
+
+    bounded_load_hash<64> a{shards, 0.25}, b{shards + 1, 0.25}, c{shards - 1, 0.25};
+    a.assign(keys.data(), remap_keys, base.data());
+    b.assign(keys.data(), remap_keys, grown.data());
+    c.assign(keys.data(), remap_keys, shrunk.data());
+    report("bounded_load e=.25");
+    return 0;
+}
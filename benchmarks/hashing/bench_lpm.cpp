@@ -0,0 +1,87 @@
+// Longest-prefix match over an IPv4-like forwarding table.
+//
+// Baseline: a binary trie, one heap node per prefix bit, walked bit by bit
+// while remembering the last route seen. lpm_table: binary search over the
+// populated prefix lengths, one perfect-hash probe per step.
+// 100k routes with a BGP-like length mix (mostly /24, then /16../23), plus a
+// default route; queries are addresses under random routes.
+#include <bench.hpp>
+#include <etools/hashing/lpm.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+using namespace etools::hashing;
+
+namespace {
+
+constexpr std::size_t route_count = 100000;
+using table_t = lpm_table<std::uint32_t, route_count>;
+
+class binary_trie {
+public:
+    void insert(std::uint32_t prefix, std::uint8_t length, std::uint32_t route) {
+        node* n = &_root;
+        for (std::uint8_t bit = 0; bit < length; ++bit) {
+            std::unique_ptr<node>& child = n->child[(prefix >> (31 - bit)) & 1u];
+            if (!child) child = std::make_unique<node>();
+            n = child.get();
+        }
+        if (n->route == none) n->route = route;   // first route wins, like lpm_table
+    }
+
+    std::uint32_t operator()(std::uint32_t key) const {
+        const node* n = &_root;
+        std::uint32_t best = n->route;
+        for (int bit = 31; bit >= 0 && (n = n->child[(key >> bit) & 1u].get()); --bit)
+            if (n->route != none) best = n->route;
+        return best;
+    }
+
+    static constexpr std::uint32_t none = static_cast<std::uint32_t>(route_count);
+
+private:
+    struct node {
+        std::unique_ptr<node> child[2];
+        std::uint32_t route = none;
+    };
+    node _root;
+};
+
+BENCH_NOINLINE void trie_lookup(const binary_trie& t, const std::uint32_t* keys, std::size_t n, std::uint32_t* out) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = t(keys[i]);
+}
+
+BENCH_NOINLINE void lpm_lookup(const table_t& t, const std::uint32_t* keys, std::size_t n, std::uint32_t* out) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = static_cast<std::uint32_t>(t(keys[i]));
+}
+
+} // namespace
+
+int main() {
+    bench::rng rng;
+    std::vector<lpm_route<std::uint32_t>> routes{{0, 0}};
+    while (routes.size() < route_count) {
+        const std::uint64_t r = rng() % 100;
+        const auto length = static_cast<std::uint8_t>(r < 55 ? 24 : r < 90 ? 16 + rng() % 8 : r < 97 ? 8 + rng() % 8 : 25 + rng() % 8);
+        routes.push_back({static_cast<std::uint32_t>(rng()), length});
+    }
+
+    binary_trie trie;
+    for (std::size_t i = 0; i < routes.size(); ++i) trie.insert(routes[i].prefix, routes[i].length, static_cast<std::uint32_t>(i));
+    const auto table = std::make_unique<table_t>(routes.data(), routes.size());
+
+    constexpr std::size_t count = 1 << 16;
+    std::vector<std::uint32_t> keys(count), a(count), b(count);
+    for (auto& k : keys) k = routes[rng() % route_count].prefix ^ static_cast<std::uint32_t>(rng() >> (56 + rng() % 8));
+
+    bench::run("binary trie", count, [&] {
+        trie_lookup(trie, keys.data(), count, a.data());
+        bench::do_not_optimize(a[0]);
+    });
+    bench::run("lpm_table", count, [&] {
+        lpm_lookup(*table, keys.data(), count, b.data());
+        bench::do_not_optimize(b[0]);
+    });
+    return a == b ? 0 : 1;
+}
@@ -0,0 +1,75 @@
+// Classifier membership: 12 static key sets, "which sets contain k?".
+//
+// Baseline: one optimal_mph per set, 12 probes per query. Fused: one
+// multi_set table over the union, one probe returning the 12-bit mask.
+// Every set holds 96 uint16 keys drawn from [0, 4096), so sets overlap and
+// about a quarter of the queries hit at least one set.
+#include <bench.hpp>
+#include <etools/hashing/multi_set.hpp>
+#include <etools/hashing/optimal_mph.hpp>
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace etools::hashing;
+
+namespace {
+
+constexpr std::size_t set_count = 12;
+constexpr std::size_t set_size = 96;
+
+constexpr std::uint16_t key_of(std::size_t s, std::size_t i) {
+    return static_cast<std::uint16_t>((s * 331 + i * 41) % 4096); // distinct within a set
+}
+
+template<std::size_t S, std::size_t... I>
+struct generated_set {
+    static constexpr std::array<std::uint16_t, sizeof...(I)> keys{{key_of(S, I)...}};
+
+    static constexpr const auto& mph() { return optimal_mph<std::uint16_t>::instance<key_of(S, I)...>(); }
+};
+
+template<std::size_t S, std::size_t... I>
+constexpr generated_set<S, I...> make_set(std::index_sequence<I...>) { return {}; }
+
+template<std::size_t S>
+using set_t = decltype(make_set<S>(std::make_index_sequence<set_size>{}));
+
+template<std::size_t... S>
+BENCH_NOINLINE void separate(const std::uint16_t* keys, std::size_t count, std::uint16_t* out, std::index_sequence<S...>) {
+    for (std::size_t i = 0; i < count; ++i) {
+        std::uint16_t mask = 0;
+        ((mask |= static_cast<std::uint16_t>((set_t<S>::mph()(keys[i]) < set_size) << S)), ...);
+        out[i] = mask;
+    }
+}
+
+template<std::size_t... S>
+constexpr const auto& fused_table(std::index_sequence<S...>) {
+    return multi_set<std::uint16_t>::instance<set_t<S>...>();
+}
+
+BENCH_NOINLINE void fused(const std::uint16_t* keys, std::size_t count, std::uint16_t* out) {
+    constexpr const auto& table = fused_table(std::make_index_sequence<set_count>{});
+    for (std::size_t i = 0; i < count; ++i) out[i] = table(keys[i]);
+}
+
+} // namespace
+
+int main() {
+    constexpr std::size_t count = 1 << 14;
+    bench::rng rng;
+    std::vector<std::uint16_t> keys(count), a(count), b(count);
+    for (auto& k : keys) k = static_cast<std::uint16_t>(rng() % 4096);
+
+    bench::run("12 x optimal_mph", count, [&] {
+        separate(keys.data(), count, a.data(), std::make_index_sequence<set_count>{});
+        bench::do_not_optimize(a[0]);
+    });
+    bench::run("multi_set (1 probe)", count, [&] {
+        fused(keys.data(), count, b.data());
+        bench::do_not_optimize(b[0]);
+    });
+    return a == b ? 0 : 1;
+}
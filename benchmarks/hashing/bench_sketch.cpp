@@ -0,0 +1,90 @@
+// Streaming sketches vs exact counting with std::unordered_set / unordered_map.
+//
+// Reports update throughput (Mop/s == million keys/s) over a 64K-key batch
+// drawn from 1M distinct keys, where the exact containers grow to tens of
+// MiB; the cost of merging one per-thread sketch into a shared one; and the
+// accuracy each sketch reaches in fixed memory.
+#include <bench.hpp>
+#include <etools/hashing/count_min.hpp>
+#include <etools/hashing/hyperloglog.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace etools::hashing;
+
+int main() {
+    constexpr std::size_t count = 1 << 16;
+    constexpr std::uint64_t distinct = 1 << 20;
+
+    bench::rng rng;
+    std::vector<std::uint64_t> keys(count);
+    for (auto& k : keys) k = rng() % distinct;
+
+    std::unordered_set<std::uint64_t> set;
+    bench::run("unordered_set insert", count, [&] {
+        for (auto k : keys) set.insert(k);
+        bench::do_not_optimize(set.size());
+    });
+    auto hll = std::make_unique<hyperloglog<12>>();
+    bench::run("hyperloglog<12> update", count, [&] {
+        hll->update(keys.data(), count);
+        bench::do_not_optimize(hll);
+    });
+
+    std::unordered_map<std::uint64_t, std::uint32_t> map;
+    bench::run("unordered_map ++count", count, [&] {
+        for (auto k : keys) ++map[k];
+        bench::do_not_optimize(map.size());
+    });
+    auto cms = std::make_unique<count_min_sketch<1024, 4>>();
+    bench::run("count_min<1024,4> update", count, [&] {
+        cms->update(keys.data(), count);
+        bench::do_not_optimize(cms);
+    });
+    auto cs = std::make_unique<count_sketch<1024, 5>>();
+    bench::run("count_sketch<1024,5> update", count, [&] {
+        cs->update(keys.data(), count);
+        bench::do_not_optimize(cs);
+    });
+
+    // Merge cost per register / counter.
+    auto shared_hll = std::make_unique<hyperloglog<12>>();
+    bench::run("hyperloglog<12> merge", hyperloglog<12>::registers, [&] {
+        shared_hll->merge(*hll);
+        bench::do_not_optimize(shared_hll);
+    });
+    auto shared_cms = std::make_unique<count_min_sketch<1024, 4>>();
+    bench::run("count_min<1024,4> merge", 1024 * 4, [&] {
+        shared_cms->merge(*cms);
+        bench::do_not_optimize(shared_cms);
+    });
+
+    // --- accuracy ----------------------------------------------------------
+    std::unique_ptr<hyperloglog<12>> h = std::make_unique<hyperloglog<12>>();
+    for (std::uint64_t n : {1000ull, 100000ull, 10000000ull}) {
+        h->clear();
+        for (std::uint64_t i = 0; i < n; ++i) h->update(rng());
+        std::printf("hyperloglog<12> (4 KiB)   n=%-9llu error %5.2f%%\n",
+                    static_cast<unsigned long long>(n), 100.0 * std::fabs(h->estimate() - n) / n);
+    }
+
+    constexpr std::uint64_t hot = 1 << 14;
+    cms->clear();
+    std::vector<std::uint32_t> truth(hot);
+    for (std::size_t i = 0; i < count * 16; ++i) {
+        // Skewed stream: small keys are far more frequent.
+        const std::uint64_t k = (rng() % hot) & (rng() % hot);
+        cms->update(k);
+        ++truth[k];
+    }
+    double err = 0.0;
+    for (std::uint64_t k = 0; k < hot; ++k) err += cms->estimate(k) - truth[k];
+    std::printf("count_min<1024,4> (16 KiB) mean overestimate %.1f of %llu updates\n",
+                err / hot, static_cast<unsigned long long>(cms->total()));
+    return 0;
+}
@@ -0,0 +1,69 @@
+// Access cost of a lazily built global after it is built, and the cost of
+// building it at startup when nobody uses it.
+//
+// Accessors: lazy_slot::get_or_init, a function-local static (the compiler's
+// guard variable), and std::call_once plus a pointer. Each access reads one
+// element of a 64 KiB table; the table is built on the first call.
+#include <bench.hpp>
+#include <etools/memory/lazy_slot.hpp>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+
+using namespace etools::memory;
+
+namespace {
+
+using table = std::array<std::uint32_t, 1 << 14>;
+
+table build_table() {
+    table t{};
+    std::uint32_t x = 1;
+    for (auto& v : t) v = x = x * 1664525u + 1013904223u;
+    return t;
+}
+
+lazy_slot<table> lazy_table;
+
+BENCH_NOINLINE const table& via_lazy_slot() { return lazy_table.get_or_init(build_table); }
+
+BENCH_NOINLINE const table& via_local_static() {
+    static const table t = build_table();
+    return t;
+}
+
+std::once_flag once;
+table* once_table = nullptr;
+
+BENCH_NOINLINE const table& via_call_once() {
+    std::call_once(once, [] { static table t = build_table(); once_table = &t; });
+    return *once_table;
+}
+
+template<typename Get>
+double per_access(Get get) {
+    constexpr std::size_t n = 1 << 20;
+    std::uint32_t sum = 0;
+    const double ns = bench::best_ns(15, [&] {
+        for (std::size_t i = 0; i < n; ++i) sum += get()[i & 0x3FFF];
+        bench::do_not_optimize(sum);
+    });
+    return ns / n;
+}
+
+} // namespace
+
+int main() {
+    std::printf("%-36s %8.2f ns/access\n", "lazy_slot::get_or_init", per_access(via_lazy_slot));
+    std::printf("%-36s %8.2f ns/access\n", "function-local static", per_access(via_local_static));
+    std::printf("%-36s %8.2f ns/access\n", "std::call_once + pointer", per_access(via_call_once));
+
+    // What an eager global would cost at startup, paid here only because we ask.
+    const double build = bench::best_ns(15, [] {
+        lazy_slot<table> fresh;
+        bench::do_not_optimize(fresh.get_or_init(build_table)[0]);
+    });
+    std::printf("%-36s %8.0f ns (skipped entirely if never accessed)\n", "building the 64 KiB table once", build);
+    return 0;
+}
@@ -0,0 +1,100 @@
+// lz block codec and record frame on packed record batches.
+//
+// A record is one buffer::pack of a telemetry sample: timestamp (u64, slowly
+// increasing), source id (u32, 64 sources), kind and flags (u16), value
+// (double, quantised), position (2 x float, small drift). A batch is 16k
+// records back to back (512 KiB), the shape of a recorded log segment or a
+// coalesced network frame. Throughput is uncompressed bytes per second.
+#include <bench.hpp>
+#include <etools/memory/lz.hpp>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace etools::memory;
+
+namespace {
+
+constexpr std::size_t record_count = 1 << 14;
+
+std::vector<std::byte> make_batch(std::vector<std::size_t>& sizes) {
+    bench::rng rng;
+    std::vector<std::byte> batch;
+    buffer rec{std::make_unique<std::byte[]>(64), 64};
+    std::uint64_t ts = 1'700'000'000'000'000'000ull;
+    float x = 0, y = 0;
+    for (std::size_t i = 0; i < record_count; ++i) {
+        const std::uint64_t r = rng();
+        ts += 1000 + (r & 0xFFF);
+        x += static_cast<float>(static_cast<int>(r >> 20 & 7) - 3) * 0.25f;
+        y += static_cast<float>(static_cast<int>(r >> 23 & 7) - 3) * 0.25f;
+        const auto n = rec.pack(ts, static_cast<std::uint32_t>(r >> 58), static_cast<std::uint16_t>(r >> 40 & 3),
+                                std::uint16_t{0}, static_cast<double>(r >> 48 & 0xFF) * 0.5, x, y);
+        batch.insert(batch.end(), rec.data(), rec.data() + n);
+        sizes.push_back(n);
+    }
+    return batch;
+}
+
+void report(const char* name, double ns_per_byte) {
+    std::printf("%-48s %10.2f GB/s\n", name, 1.0 / ns_per_byte);
+}
+
+} // namespace
+
+int main() {
+    std::vector<std::size_t> sizes;
+    const auto batch = make_batch(sizes);
+    const std::size_t n = batch.size();
+    std::array<std::uint32_t, 4096> cells{};
+
+    std::vector<std::byte> copy(n), packed(lz_compress_bound(n)), out(n + 64);
+    std::size_t packed_size = 0;
+
+    report("memcpy (reference)", bench::best_ns(15, [&] {
+        std::memcpy(copy.data(), batch.data(), n);
+        bench::do_not_optimize(copy[0]);
+    }) / static_cast<double>(n));
+
+    report("lz_compress, 512 KiB batch", bench::best_ns(15, [&] {
+        packed_size = lz_compress(batch.data(), n, packed.data(), packed.size(), lz_table{cells});
+        bench::do_not_optimize(packed_size);
+    }) / static_cast<double>(n));
+
+    bool ok = true;
+    report("lz_decompress, 512 KiB batch", bench::best_ns(15, [&] {
+        const auto m = lz_decompress(packed.data(), packed_size, out.data(), out.size());
+        ok = ok && m && *m == n;
+        bench::do_not_optimize(out[0]);
+    }) / static_cast<double>(n));
+    ok = ok && std::memcmp(out.data(), batch.data(), n) == 0;
+    std::printf("%-48s %10.2f : 1   (%zu -> %zu bytes)\n", "block ratio", double(n) / double(packed_size), n, packed_size);
+
+    // Frame: the same records one write() each, 64 KiB blocks.
+    constexpr std::size_t block = 64 * 1024;
+    std::vector<std::byte> scratch(lz_frame_writer_scratch(block)), frame, decode(block);
+    frame.reserve(n);
+    std::uint64_t in = 0;
+    report("lz_frame_writer, per record, 64 KiB blocks", bench::best_ns(15, [&] {
+        frame.clear();
+        lz_frame_writer w{[&frame](const std::byte* p, std::size_t k) { frame.insert(frame.end(), p, p + k); },
+                          lz_table{cells}, scratch.data(), block};
+        for (std::size_t i = 0, off = 0; i < sizes.size(); off += sizes[i++]) w.write(batch.data() + off, sizes[i]);
+        w.finish();
+        in = w.bytes_in();
+    }) / static_cast<double>(n));
+
+    std::size_t records = 0;
+    report("lz_frame_reader, per record", bench::best_ns(15, [&] {
+        records = 0;
+        lz_frame_reader r{buffer_view{frame.data(), frame.size()}, decode.data(), decode.size()};
+        while (const auto rec = r.next()) { bench::do_not_optimize(rec->data()); ++records; }
+    }) / static_cast<double>(n));
+    std::printf("%-48s %10.2f : 1   (%llu -> %zu bytes, %zu records)\n", "frame ratio",
+                double(in) / double(frame.size()), static_cast<unsigned long long>(in), frame.size(), records);
+
+    return ok && records == record_count ? 0 : 1;
+}
@@ -0,0 +1,143 @@
+// Compact wire mode and integer array codecs.
+//
+// Records: one telemetry sample of mostly small integers (source id, sequence
+// delta, kind, two status flags, a signed reading, a counter), packed flat and
+// in compact mode; reports bytes per record and ns per pack / unpack.
+//
+// Arrays: 64k uint32_t values, 90% below 256 (ids, deltas), the rest up to
+// 2^24. Decoding as LEB128 one value at a time vs one Stream VByte block;
+// the SIMD path needs -mssse3 (or -march=native) on x86, NEON on AArch64.
+#include <bench.hpp>
+#include <etools/memory/buffer.hpp>
+#include <etools/memory/buffer_view.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace etools::memory;
+
+namespace {
+
+constexpr std::size_t record_count = 1 << 12;
+constexpr std::size_t value_count = 1 << 16;
+
+struct sample {
+    std::uint32_t source;
+    std::uint32_t seq_delta;
+    std::uint16_t kind;
+    bool valid;
+    bool alarm;
+    std::int32_t reading;
+    std::uint64_t counter;
+};
+
+std::vector<sample> make_samples() {
+    bench::rng rng;
+    std::vector<sample> out(record_count);
+    std::uint64_t counter = 0;
+    for (auto& s : out) {
+        const std::uint64_t r = rng();
+        counter += 1 + (r & 15);
+        s = {static_cast<std::uint32_t>(r >> 58), 1, static_cast<std::uint16_t>(r >> 40 & 7), true, (r >> 50 & 31) == 0,
+             static_cast<std::int32_t>(r >> 20 & 0x3FF) - 512, counter};
+    }
+    return out;
+}
+
+BENCH_NOINLINE std::size_t leb128_decode_all(const std::byte* p, std::size_t size, std::uint32_t* out, std::size_t count) {
+    const std::byte* const start = p;
+    for (std::size_t i = 0; i < count; ++i) {
+        std::uint64_t v;
+        const std::size_t n = varint_decode(p, size - static_cast<std::size_t>(p - start), v);
+        if (!n) return 0;
+        out[i] = static_cast<std::uint32_t>(v);
+        p += n;
+    }
+    return static_cast<std::size_t>(p - start);
+}
+
+} // namespace
+
+int main() {
+    const auto samples = make_samples();
+    std::vector<buffer<>> flat, compacted;
+    for (std::size_t i = 0; i < record_count; ++i) {
+        flat.emplace_back(std::make_unique<std::byte[]>(64), 64);
+        compacted.emplace_back(std::make_unique<std::byte[]>(64), 64);
+    }
+
+    std::size_t flat_bytes = 0, compact_bytes = 0;
+    const double flat_pack = bench::best_ns(15, [&] {
+        flat_bytes = 0;
+        for (std::size_t i = 0; i < record_count; ++i) {
+            const auto& s = samples[i];
+            flat_bytes += flat[i].pack(s.source, s.seq_delta, s.kind, s.valid, s.alarm, s.reading, s.counter);
+        }
+    }) / record_count;
+    const double compact_pack = bench::best_ns(15, [&] {
+        compact_bytes = 0;
+        for (std::size_t i = 0; i < record_count; ++i) {
+            const auto& s = samples[i];
+            compact_bytes += compacted[i].pack(compact, s.source, s.seq_delta, s.kind, s.valid, s.alarm, s.reading, s.counter);
+        }
+    }) / record_count;
+
+    std::uint64_t sum = 0;
+    const double flat_unpack = bench::best_ns(15, [&] {
+        for (const auto& b : flat) {
+            const auto t = buffer_view{b.data(), b.size()}
+                .unpack<std::uint32_t, std::uint32_t, std::uint16_t, bool, bool, std::int32_t, std::uint64_t>();
+            sum += std::get<6>(*t) + static_cast<std::uint64_t>(std::get<5>(*t));
+        }
+    }) / record_count;
+    const double compact_unpack = bench::best_ns(15, [&] {
+        for (const auto& b : compacted) {
+            const auto t = buffer_view{b.data(), b.size()}
+                .unpack<std::uint32_t, std::uint32_t, std::uint16_t, bool, bool, std::int32_t, std::uint64_t>(compact);
+            sum += std::get<6>(*t) + static_cast<std::uint64_t>(std::get<5>(*t));
+        }
+    }) / record_count;
+    bench::do_not_optimize(sum);
+
+    std::printf("%-36s %8.1f B/record %8.1f ns pack %8.1f ns unpack\n", "record, flat",
+                double(flat_bytes) / record_count, flat_pack, flat_unpack);
+    std::printf("%-36s %8.1f B/record %8.1f ns pack %8.1f ns unpack\n", "record, compact",
+                double(compact_bytes) / record_count, compact_pack, compact_unpack);
+
+    // Arrays.
+    bench::rng rng;
+    std::vector<std::uint32_t> values(value_count), out(value_count);
+    for (auto& v : values) {
+        const std::uint64_t r = rng();
+        v = (r & 15) < 14 ? static_cast<std::uint32_t>(r >> 56) : static_cast<std::uint32_t>(r >> 40);
+    }
+    std::vector<std::byte> leb(value_count * varint_max_size), svb(stream_vbyte_bound(value_count));
+    std::size_t leb_size = 0;
+    for (const auto v : values) leb_size += varint_encode(v, leb.data() + leb_size);
+    const std::size_t svb_size = stream_vbyte_encode(values.data(), value_count, svb.data());
+
+    const double raw_ns = bench::best_ns(15, [&] {
+        std::memcpy(out.data(), values.data(), value_count * sizeof(std::uint32_t));
+        bench::do_not_optimize(out[0]);
+    }) / value_count;
+    bool ok = true;
+    const double leb_ns = bench::best_ns(15, [&] {
+        ok = ok && leb128_decode_all(leb.data(), leb_size, out.data(), value_count) == leb_size;
+        bench::do_not_optimize(out[0]);
+    }) / value_count;
+    const double svb_ns = bench::best_ns(15, [&] {
+        ok = ok && stream_vbyte_decode(svb.data(), svb_size, out.data(), value_count) == svb_size;
+        bench::do_not_optimize(out[0]);
+    }) / value_count;
+    ok = ok && out == values;
+
+    std::printf("%-36s %8.2f B/value %8.2f ns/value (%6.0f M values/s)\n", "uint32 array, raw memcpy",
+                4.0, raw_ns, 1e3 / raw_ns);
+    std::printf("%-36s %8.2f B/value %8.2f ns/value (%6.0f M values/s)\n", "uint32 array, LEB128 varint_decode",
+                double(leb_size) / value_count, leb_ns, 1e3 / leb_ns);
+    std::printf("%-36s %8.2f B/value %8.2f ns/value (%6.0f M values/s)\n", "uint32 array, stream_vbyte_decode",
+                double(svb_size) / value_count, svb_ns, 1e3 / svb_ns);
+    return ok ? 0 : 1;
+}
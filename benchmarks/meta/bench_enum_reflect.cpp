@@ -0,0 +1,87 @@
+// Enum <-> string: hand-written switch / strcmp chain vs enum_reflect tables.
+//
+// The enum has 24 sparse enumerators (log-level-like codes). The baselines are
+// what a codebase writes by hand: a `switch` for to_string and a chain of
+// string compares for from_string. enum_reflect answers both with one
+// perfect-hash probe (plus one compare for from_string).
+#include <bench.hpp>
+#include <etools/meta/enum_reflect.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+using namespace etools::meta;
+
+enum class code : std::uint8_t {
+    trace = 1, debug = 3, info = 5, notice = 8, warning = 13, error = 21,
+    critical = 34, alert = 55, emergency = 89, audit = 90, metric = 91, span = 92,
+    event_begin = 100, event_end = 101, heartbeat = 110, config = 120, reload = 121,
+    shutdown = 130, startup = 131, panic = 140, assert_fail = 150, oom = 160,
+    timeout = 170, retry = 180,
+};
+
+#define CODES(X) X(trace) X(debug) X(info) X(notice) X(warning) X(error) X(critical) \
+    X(alert) X(emergency) X(audit) X(metric) X(span) X(event_begin) X(event_end)        \
+    X(heartbeat) X(config) X(reload) X(shutdown) X(startup) X(panic) X(assert_fail)     \
+    X(oom) X(timeout) X(retry)
+
+BENCH_NOINLINE const char* switch_to_string(code c) {
+    switch (c) {
+    #define CASE(n) case code::n: return #n;
+        CODES(CASE)
+    #undef CASE
+    }
+    return "";
+}
+
+BENCH_NOINLINE bool strcmp_from_string(const char* s, code& out) {
+    #define CMP(n) if (std::strcmp(s, #n) == 0) { out = code::n; return true; }
+    CODES(CMP)
+    #undef CMP
+    return false;
+}
+
+BENCH_NOINLINE std::string_view table_to_string(code c) { return to_string(c); }
+
+BENCH_NOINLINE bool table_from_string(std::string_view s, code& out) {
+    const auto r = from_string<code>(s);
+    if (r) out = *r;
+    return r.has_value();
+}
+
+int main() {
+    constexpr std::size_t count = 1 << 16;
+    bench::rng rng;
+    std::vector<code> values(count);
+    for (auto& v : values) v = enum_values_v<code>[rng() % enum_count_v<code>];
+
+    bench::run("to_string   switch", count, [&] {
+        std::size_t acc = 0;
+        for (code c : values) acc += switch_to_string(c)[0];
+        bench::do_not_optimize(acc);
+    });
+    bench::run("to_string   enum_reflect", count, [&] {
+        std::size_t acc = 0;
+        for (code c : values) acc += table_to_string(c)[0];
+        bench::do_not_optimize(acc);
+    });
+
+    std::vector<const char*> names(count);
+    for (std::size_t i = 0; i < count; ++i) names[i] = switch_to_string(values[i]);
+
+    bench::run("from_string strcmp chain", count, [&] {
+        std::size_t acc = 0;
+        code c{};
+        for (const char* s : names) acc += strcmp_from_string(s, c) + static_cast<std::size_t>(c);
+        bench::do_not_optimize(acc);
+    });
+    bench::run("from_string enum_reflect", count, [&] {
+        std::size_t acc = 0;
+        code c{};
+        for (const char* s : names) acc += table_from_string(s, c) + static_cast<std::size_t>(c);
+        bench::do_not_optimize(acc);
+    });
+    return 0;
+}
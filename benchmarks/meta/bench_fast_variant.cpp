@@ -0,0 +1,84 @@
+// Visit latency: fast_variant::visit vs std::visit over the same alternatives.
+//
+// A pre-generated array of variants is visited with a summing visitor twice:
+// with uniformly random active indices (branch-mispredict bound, shows the
+// cost of the indirect jump) and with long runs of one alternative
+// (predictable, shows the pure dispatch overhead). Alternatives are distinct
+// wrapper types so neither implementation can merge the cases.
+#include <bench.hpp>
+#include <etools/meta/fast_variant.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+#include <variant>
+#include <vector>
+
+using namespace etools;
+
+template<std::size_t I>
+struct alt { std::uint32_t v; };
+
+template<typename Seq> struct make_variants;
+template<std::size_t... Is>
+struct make_variants<std::index_sequence<Is...>> {
+    using fast = meta::fast_variant<alt<Is>...>;
+    using stdv = std::variant<alt<Is>...>;
+};
+
+// Per-alternative work differs slightly so the visitor is not a single shared body.
+struct summer {
+    template<std::size_t I>
+    std::uint32_t operator()(const alt<I>& a) const noexcept { return a.v * (I + 1); }
+};
+
+template<typename Fast, typename Std, std::size_t... Is>
+void push_nth(Fast& fast, Std& stdv, std::size_t k, std::uint32_t v, std::index_sequence<Is...>) {
+    ((k == Is ? (fast.emplace_back(std::in_place_index<Is>, alt<Is>{v}),
+                 stdv.emplace_back(std::in_place_index<Is>, alt<Is>{v}), true) : false) || ...);
+}
+
+template<std::size_t N>
+void run_alternatives(std::size_t count, bool runs) {
+    using fast_t = typename make_variants<std::make_index_sequence<N>>::fast;
+    using std_t  = typename make_variants<std::make_index_sequence<N>>::stdv;
+
+    std::vector<fast_t> fast;
+    std::vector<std_t> stdv;
+    fast.reserve(count);
+    stdv.reserve(count);
+
+    bench::rng rng;
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::size_t k = runs ? (i * N / count) : rng() % N;
+        const auto v = static_cast<std::uint32_t>(rng());
+        push_nth(fast, stdv, k, v, std::make_index_sequence<N>{});
+    }
+
+    char name[96];
+    const char* order = runs ? "runs  " : "random";
+    std::snprintf(name, sizeof(name), "std::visit          %s alternatives=%zu", order, N);
+    bench::run(name, count, [&] {
+        std::uint32_t s = 0;
+        for (const auto& v : stdv) s += std::visit(summer{}, v);
+        bench::do_not_optimize(s);
+    });
+
+    std::snprintf(name, sizeof(name), "fast_variant::visit %s alternatives=%zu", order, N);
+    bench::run(name, count, [&] {
+        std::uint32_t s = 0;
+        for (const auto& v : fast) s += v.visit(summer{});
+        bench::do_not_optimize(s);
+    });
+
+}
+
+int main() {
+    constexpr std::size_t count = 1u << 16;
+    for (bool runs : {false, true}) {
+        run_alternatives<4>(count, runs);
+        run_alternatives<12>(count, runs);
+        run_alternatives<24>(count, runs);
+        run_alternatives<64>(count, runs);
+    }
+    return 0;
+}
@@ -0,0 +1,91 @@
+// Event-mask dispatch: enumerate_flags + switch vs flag_dispatch.
+//
+// Eight out-of-line handlers are bound to bits of a 32-bit event enum spread
+// across the word. Random masks with 1 or 3 fired events are dispatched. The
+// baseline walks every position returned by enumerate_flags and switches on
+// the set ones; flag_dispatch jumps straight to the fired handlers via ctz.
+#include <bench.hpp>
+#include <etools/meta/flag_dispatch.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace etools::meta;
+
+enum class ev : std::uint32_t {
+    e0 = 1u << 0,  e1 = 1u << 3,  e2 = 1u << 7,  e3 = 1u << 11,
+    e4 = 1u << 16, e5 = 1u << 21, e6 = 1u << 26, e7 = 1u << 31
+};
+template <>
+struct etools::meta::enable_flags<ev> : std::true_type {};
+
+template<int I>
+BENCH_NOINLINE void handle(std::uint64_t& acc) { acc = acc * 31 + I; }
+
+using dispatcher = flag_dispatch<ev,
+    flag_handler<ev::e0, &handle<0>>, flag_handler<ev::e1, &handle<1>>,
+    flag_handler<ev::e2, &handle<2>>, flag_handler<ev::e3, &handle<3>>,
+    flag_handler<ev::e4, &handle<4>>, flag_handler<ev::e5, &handle<5>>,
+    flag_handler<ev::e6, &handle<6>>, flag_handler<ev::e7, &handle<7>>>;
+
+using prioritized = flag_dispatch<ev,
+    flag_handler<ev::e0, &handle<0>>, flag_handler<ev::e1, &handle<1>>,
+    flag_handler<ev::e2, &handle<2>>, flag_handler<ev::e3, &handle<3>>,
+    flag_handler<ev::e4, &handle<4>>, flag_handler<ev::e5, &handle<5>>,
+    flag_handler<ev::e6, &handle<6>>, flag_handler<ev::e7, &handle<7>, 1>>;
+
+static void switch_dispatch(ev mask, std::uint64_t& acc) {
+    const auto bits = enumerate_flags(mask);
+    for (ev b : bits) {
+        switch (b) {
+            case ev::e0: handle<0>(acc); break;
+            case ev::e1: handle<1>(acc); break;
+            case ev::e2: handle<2>(acc); break;
+            case ev::e3: handle<3>(acc); break;
+            case ev::e4: handle<4>(acc); break;
+            case ev::e5: handle<5>(acc); break;
+            case ev::e6: handle<6>(acc); break;
+            case ev::e7: handle<7>(acc); break;
+            default: break;
+        }
+    }
+}
+
+static void run_fired(std::size_t count, unsigned fired) {
+    bench::rng rng;
+    std::vector<ev> masks(count);
+    const auto all = extract_flags(dispatcher::mask);
+    for (auto& m : masks) {
+        m = ev{};
+        for (unsigned k = 0; k < fired; ++k) m |= all.first[rng() % all.second];
+    }
+
+    char name[96];
+    std::snprintf(name, sizeof(name), "enumerate_flags + switch  fired<=%u", fired);
+    bench::run(name, count, [&] {
+        std::uint64_t acc = 0;
+        for (ev m : masks) switch_dispatch(m, acc);
+        bench::do_not_optimize(acc);
+    });
+
+    std::snprintf(name, sizeof(name), "flag_dispatch             fired<=%u", fired);
+    bench::run(name, count, [&] {
+        std::uint64_t acc = 0;
+        for (ev m : masks) dispatcher::dispatch(m, acc);
+        bench::do_not_optimize(acc);
+    });
+
+    std::snprintf(name, sizeof(name), "flag_dispatch prioritized fired<=%u", fired);
+    bench::run(name, count, [&] {
+        std::uint64_t acc = 0;
+        for (ev m : masks) prioritized::dispatch(m, acc);
+        bench::do_not_optimize(acc);
+    });
+}
+
+int main() {
+    constexpr std::size_t count = 1 << 16;
+    run_fired(count, 1);
+    run_fired(count, 3);
+    return 0;
+}
@@ -0,0 +1,72 @@
+// Capability-set algebra: flag_set<E, 256> vs std::bitset<256>.
+//
+// Each op computes `(a & b) ^ ~c` over arrays of random sets and tests the
+// result with any()/all(), mirroring a feature-gating check. A second case
+// iterates the set bits of sparse sets (4 of 256 set).
+#include <bench.hpp>
+#include <etools/meta/flag_set.hpp>
+#include <bitset>
+#include <cstdint>
+#include <vector>
+
+using namespace etools::meta;
+
+enum class feature : std::uint16_t {};
+using fset = flag_set<feature, 256>;
+using bset = std::bitset<256>;
+
+int main() {
+    constexpr std::size_t count = 1 << 14;
+    bench::rng rng;
+
+    std::vector<fset> fa(count), fb(count), fc(count), fsparse(count);
+    std::vector<bset> ba(count), bb(count), bc(count), bsparse(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        for (std::size_t bit = 0; bit < 256; ++bit) {
+            const auto r = rng();
+            const auto f = static_cast<feature>(bit);
+            if (r & 1) { fa[i].set(f); ba[i].set(bit); }
+            if (r & 2) { fb[i].set(f); bb[i].set(bit); }
+            if (r & 4) { fc[i].set(f); bc[i].set(bit); }
+        }
+        for (int k = 0; k < 4; ++k) {
+            const std::size_t bit = rng() & 255;
+            fsparse[i].set(static_cast<feature>(bit));
+            bsparse[i].set(bit);
+        }
+    }
+
+    bench::run("std::bitset<256>  (a & b) ^ ~c, any+all", count, [&] {
+        std::size_t hits = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const bset r = (ba[i] & bb[i]) ^ ~bc[i];
+            hits += r.any() + r.all();
+        }
+        bench::do_not_optimize(hits);
+    });
+
+    bench::run("flag_set<256>     (a & b) ^ ~c, any+all", count, [&] {
+        std::size_t hits = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const fset r = (fa[i] & fb[i]) ^ ~fc[i];
+            hits += r.any() + r.all();
+        }
+        bench::do_not_optimize(hits);
+    });
+
+    bench::run("std::bitset<256>  iterate 4 set bits", count, [&] {
+        std::size_t acc = 0;
+        for (const auto& s : bsparse)
+            for (std::size_t bit = 0; bit < 256; ++bit)
+                if (s.test(bit)) acc += bit;
+        bench::do_not_optimize(acc);
+    });
+
+    bench::run("flag_set<256>     iterate 4 set bits", count, [&] {
+        std::size_t acc = 0;
+        for (const auto& s : fsparse)
+            s.for_each([&](feature f) { acc += static_cast<std::size_t>(f); });
+        bench::do_not_optimize(acc);
+    });
+    return 0;
+}
@@ -0,0 +1,70 @@
+// Set-bit iteration: per-position scan vs flag_range over 64-bit masks.
+//
+// Each mask is a random uint64_t event set with a given number of set bits.
+// The scan baseline tests every bit position (the old enumerate_flags loop);
+// flag_range / for_each_flag only visit the set bits, so their cost should
+// track the popcount rather than the width.
+#include <bench.hpp>
+#include <etools/meta/flags.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using namespace etools::meta;
+
+enum class events : std::uint64_t {};
+template <>
+struct etools::meta::enable_flags<events> : std::true_type {};
+
+static std::vector<events> make_masks(std::size_t count, unsigned bits) {
+    bench::rng rng;
+    std::vector<events> masks(count);
+    for (auto& m : masks) {
+        std::uint64_t v = 0;
+        while (popcount(static_cast<events>(v)) < bits) v |= 1ull << (rng() & 63);
+        m = static_cast<events>(v);
+    }
+    return masks;
+}
+
+static void run_density(std::size_t count, unsigned bits) {
+    const auto masks = make_masks(count, bits);
+    char name[96];
+
+    std::snprintf(name, sizeof(name), "per-position scan    popcount=%u", bits);
+    bench::run(name, count, [&] {
+        std::uint64_t acc = 0;
+        for (events m : masks)
+            for (std::size_t i = 0; i < 64; ++i) {
+                const auto bit = static_cast<events>(1ull << i);
+                if ((m & bit) != events{}) acc += static_cast<std::uint64_t>(bit) ^ i;
+            }
+        bench::do_not_optimize(acc);
+    });
+
+    std::snprintf(name, sizeof(name), "flag_range           popcount=%u", bits);
+    bench::run(name, count, [&] {
+        std::uint64_t acc = 0;
+        for (events m : masks) {
+            const flag_range r(m);
+            for (auto it = r.begin(); it != r.end(); ++it)
+                acc += static_cast<std::uint64_t>(*it) ^ it.index();
+        }
+        bench::do_not_optimize(acc);
+    });
+
+    std::snprintf(name, sizeof(name), "for_each_flag        popcount=%u", bits);
+    bench::run(name, count, [&] {
+        std::uint64_t acc = 0;
+        for (events m : masks)
+            for_each_flag(m, [&](events e, std::size_t i) { acc += static_cast<std::uint64_t>(e) ^ i; });
+        bench::do_not_optimize(acc);
+    });
+}
+
+int main() {
+    constexpr std::size_t count = 1 << 16;
+    for (unsigned bits : {1u, 2u, 8u, 32u})
+        run_density(count, bits);
+    return 0;
+}
@@ -0,0 +1,76 @@
+// "Smallest registered key >= x": fold over the types vs sorted_value_table.
+//
+// N types carry pseudo-random 32-bit keys. The baseline is what such a query
+// looks like without a sorted table: a fold expression over the pack that
+// keeps the best candidate seen so far (N compares, all inlined).
+// sorted_value_table answers the same query with one branch-free binary
+// search over a constexpr key array and an index lookup.
+#include <bench.hpp>
+#include <etools/meta/sorted_value_table.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+using namespace etools::meta;
+
+constexpr std::uint32_t mix(std::uint32_t x) {
+    x ^= x >> 16; x *= 0x7feb352dU; x ^= x >> 15; x *= 0x846ca68bU; x ^= x >> 16;
+    return x;
+}
+
+template<std::size_t I>
+struct item { static constexpr std::uint32_t key = mix(static_cast<std::uint32_t>(I) + 1) >> 8; };
+
+template<typename T>
+struct key_of { static constexpr std::uint32_t value = T::key; };
+
+template<typename... Ts>
+BENCH_NOINLINE std::size_t fold_find(std::uint32_t x) {
+    std::size_t best = sizeof...(Ts), i = 0;
+    std::uint32_t best_key = ~0u;
+    ((Ts::key >= x && Ts::key < best_key ? (best = i, best_key = Ts::key) : 0u, ++i), ...);
+    return best;
+}
+
+template<typename Table>
+BENCH_NOINLINE std::size_t table_find(std::uint32_t x) {
+    return Table::find_at_least(x);
+}
+
+template<std::size_t... Is>
+static void run_n(std::size_t count, std::index_sequence<Is...>) {
+    using table = sorted_value_table<key_of, item<Is>...>;
+    constexpr std::size_t n = sizeof...(Is);
+
+    bench::rng rng;
+    std::vector<std::uint32_t> queries(count);
+    for (auto& q : queries) q = static_cast<std::uint32_t>(rng()) >> 8;
+
+    std::size_t a = 0, b = 0;
+    for (std::uint32_t q : queries) { a += fold_find<item<Is>...>(q); b += table_find<table>(q); }
+    if (a != b) { std::printf("mismatch at N=%zu\n", n); return; }
+
+    char name[96];
+    std::snprintf(name, sizeof(name), "fold over types     N=%zu", n);
+    bench::run(name, count, [&] {
+        std::size_t acc = 0;
+        for (std::uint32_t q : queries) acc += fold_find<item<Is>...>(q);
+        bench::do_not_optimize(acc);
+    });
+
+    std::snprintf(name, sizeof(name), "sorted_value_table  N=%zu", n);
+    bench::run(name, count, [&] {
+        std::size_t acc = 0;
+        for (std::uint32_t q : queries) acc += table_find<table>(q);
+        bench::do_not_optimize(acc);
+    });
+}
+
+int main() {
+    constexpr std::size_t count = 1 << 16;
+    run_n(count, std::make_index_sequence<8>{});
+    run_n(count, std::make_index_sequence<64>{});
+    run_n(count, std::make_index_sequence<256>{});
+    return 0;
+}
@@ -0,0 +1,109 @@
+// Per-element visitation vs visit_batched over arrays of variants.
+//
+// Eight alternatives with distinct per-type work. Two index distributions:
+// uniform random (worst case for per-element dispatch) and skewed, where one
+// alternative covers ~90% of the elements and the rest share the remainder
+// (dispatch is mostly predictable, so batching has less to win).
+#include <bench.hpp>
+#include <etools/meta/fast_variant.hpp>
+#include <etools/meta/visit_batched.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+#include <variant>
+#include <vector>
+
+using namespace etools;
+
+template<std::size_t I>
+struct alt { std::uint32_t v; };
+
+constexpr std::size_t alternatives = 8;
+
+template<typename Seq> struct make_variants;
+template<std::size_t... Is>
+struct make_variants<std::index_sequence<Is...>> {
+    using fast = meta::fast_variant<alt<Is>...>;
+    using stdv = std::variant<alt<Is>...>;
+};
+using fast_t = make_variants<std::make_index_sequence<alternatives>>::fast;
+using std_t  = make_variants<std::make_index_sequence<alternatives>>::stdv;
+
+// Each alternative does a different small computation into a shared accumulator.
+struct worker {
+    std::uint64_t* acc;
+    template<std::size_t I>
+    void operator()(const alt<I>& a) const noexcept {
+        if constexpr (I % 4 == 0)      *acc += a.v;
+        else if constexpr (I % 4 == 1) *acc ^= a.v * 0x9E3779B1u;
+        else if constexpr (I % 4 == 2) *acc += a.v >> (I & 7);
+        else                           *acc -= a.v | I;
+    }
+};
+
+template<typename Vec, std::size_t... Is>
+void push_nth(Vec& out, std::size_t k, std::uint32_t v, std::index_sequence<Is...>) {
+    ((k == Is ? (out.emplace_back(std::in_place_index<Is>, alt<Is>{v}), true) : false) || ...);
+}
+
+template<typename Vec>
+Vec generate(std::size_t count, bool skewed) {
+    Vec out;
+    out.reserve(count);
+    bench::rng rng;
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::uint64_t r = rng();
+        const std::size_t k = skewed ? ((r % 10) ? 0 : 1 + (r >> 8) % (alternatives - 1)) : r % alternatives;
+        push_nth(out, k, static_cast<std::uint32_t>(r >> 32), std::make_index_sequence<alternatives>{});
+    }
+    return out;
+}
+
+void run_distribution(std::size_t count, bool skewed) {
+    const auto stdv = generate<std::vector<std_t>>(count, skewed);
+    const auto fast = generate<std::vector<fast_t>>(count, skewed);
+    const char* dist = skewed ? "skewed" : "random";
+    char name[96];
+
+    std::snprintf(name, sizeof(name), "std::visit per element     %s n=%zu", dist, count);
+    bench::run(name, count, [&] {
+        std::uint64_t acc = 0;
+        for (const auto& v : stdv) std::visit(worker{&acc}, v);
+        bench::do_not_optimize(acc);
+    });
+
+    std::snprintf(name, sizeof(name), "visit_batched std::variant %s n=%zu", dist, count);
+    bench::run(name, count, [&] {
+        std::uint64_t acc = 0;
+        meta::visit_batched(stdv.data(), stdv.size(), worker{&acc});
+        bench::do_not_optimize(acc);
+    });
+
+    std::snprintf(name, sizeof(name), "fast_variant per element   %s n=%zu", dist, count);
+    bench::run(name, count, [&] {
+        std::uint64_t acc = 0;
+        for (const auto& v : fast) v.visit(worker{&acc});
+        bench::do_not_optimize(acc);
+    });
+
+    std::snprintf(name, sizeof(name), "visit_batched fast_variant %s n=%zu", dist, count);
+    bench::run(name, count, [&] {
+        std::uint64_t acc = 0;
+        meta::visit_batched(fast.data(), fast.size(), worker{&acc});
+        bench::do_not_optimize(acc);
+    });
+
+    std::snprintf(name, sizeof(name), "visit_batched<4096> fast   %s n=%zu", dist, count);
+    bench::run(name, count, [&] {
+        std::uint64_t acc = 0;
+        meta::visit_batched<4096>(fast.data(), fast.size(), worker{&acc});
+        bench::do_not_optimize(acc);
+    });
+}
+
+int main() {
+    constexpr std::size_t count = 1u << 18;
+    run_distribution(count, false);
+    run_distribution(count, true);
+    return 0;
+}
@@ -0,0 +1,87 @@
+// Runtime index -> integral_constant: || fold vs with_index.
+//
+// The fold is the idiom with_index replaces:
+//   ((i == Is ? (f(integral_constant<Is>{}), true) : false) || ...);
+// Two bodies are dispatched on uniformly random indices:
+// - mix:  a distinct one-line accumulator update per index;
+// - scan: a short per-index loop over a slot array with an early return,
+//         the shape of dispatch_factory's emplace.
+#include <bench.hpp>
+#include <etools/meta/with_index.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+using namespace etools::meta;
+
+struct mix_step {
+    std::uint64_t& acc;
+    std::uint64_t* slots;
+    template<std::size_t I>
+    void operator()(std::integral_constant<std::size_t, I>) const noexcept {
+        acc = (acc ^ (I * 0x9E3779B97F4A7C15ull)) * (2 * I + 1);
+    }
+};
+
+struct scan_step {
+    std::uint64_t& acc;
+    std::uint64_t* slots;
+    template<std::size_t I>
+    void operator()(std::integral_constant<std::size_t, I>) const noexcept {
+        for (std::size_t k = 0; k < I % 5 + 1; ++k) {
+            if (slots[(I + k) % 8] == 0) { slots[(I + k) % 8] = I; acc += k; return; }
+        }
+        acc ^= I;
+    }
+};
+
+template<typename Step, std::size_t... Is>
+BENCH_NOINLINE void fold_dispatch(std::size_t i, std::uint64_t& acc, std::uint64_t* slots, std::index_sequence<Is...>) {
+    Step f{acc, slots};
+    ((i == Is ? (f(std::integral_constant<std::size_t, Is>{}), true) : false) || ...);
+}
+
+template<typename Step, std::size_t N>
+BENCH_NOINLINE void table_dispatch(std::size_t i, std::uint64_t& acc, std::uint64_t* slots) {
+    with_index<N>(i, Step{acc, slots});
+}
+
+template<typename Step, std::size_t N>
+static void run_n(const char* body, std::size_t count) {
+    bench::rng rng;
+    std::vector<std::size_t> indices(count);
+    for (auto& i : indices) i = static_cast<std::size_t>(rng() % N);
+
+    char name[96];
+    std::snprintf(name, sizeof(name), "|| fold    %-4s N=%zu", body, N);
+    bench::run(name, count, [&] {
+        std::uint64_t acc = 1, slots[8]{};
+        for (std::size_t i : indices) {
+            fold_dispatch<Step>(i, acc, slots, std::make_index_sequence<N>{});
+            slots[i % 8] = 0;
+        }
+        bench::do_not_optimize(acc);
+    });
+
+    std::snprintf(name, sizeof(name), "with_index %-4s N=%zu", body, N);
+    bench::run(name, count, [&] {
+        std::uint64_t acc = 1, slots[8]{};
+        for (std::size_t i : indices) {
+            table_dispatch<Step, N>(i, acc, slots);
+            slots[i % 8] = 0;
+        }
+        bench::do_not_optimize(acc);
+    });
+}
+
+int main() {
+    constexpr std::size_t count = 1 << 16;
+    run_n<mix_step, 8>("mix", count);
+    run_n<mix_step, 64>("mix", count);
+    run_n<mix_step, 512>("mix", count);
+    run_n<scan_step, 8>("scan", count);
+    run_n<scan_step, 64>("scan", count);
+    run_n<scan_step, 512>("scan", count);
+    return 0;
+}
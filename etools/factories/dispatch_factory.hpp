@@ -25,7 +25,7 @@
 *   Bare types are accepted and treated as `capacity<T, 1>`.
 *
 * ## Compile-time Considerations
-* - Dispatch is implemented via a fold expression across all registered types.
+* - Dispatch goes through `meta::with_index`: one jump, instantiated once per registered type.
 * - For very large registries (1,000+ types with many constructor variations),
 *   compile times may become significant. On non-professional systems this can
 *   impact developer experience. The generated code remains efficient at runtime.
@@ -36,6 +36,8 @@
 * - `etools::factories::dispatch_factory<Base, Extractor, Regs...>` - full implementation.
 * - Typelist adapter: `dispatch_factory<Base, Extractor, meta::typelist<Ts...>>` unwraps
 *   the list and delegates to the primary.
+* - `etools::factories::keyed_dispatch_factory<Base, Regs...>` - the common case where every
+*   type declares `static constexpr key`; no extractor needs to be written.
 *
 * ## Example
 * @code
@@ -103,7 +105,10 @@
 #include "utils/capacity.hpp"
 #include "../meta/typelist.hpp"
 #include "../meta/traits.hpp"
+#include "../meta/capabilities.hpp"
+#include "../meta/with_index.hpp"
 #include "../hashing/optimal_mph.hpp"
+#include "../trace/hooks.hpp"
 #include <algorithm>
 #include <array>
 #include <memory>
@@ -299,25 +304,6 @@ namespace etools::factories {
         */
         void reset(key_t key, slot_index_t slot_index) noexcept;
         /**
-        * @brief Invoke `fn(std::integral_constant<std::size_t, I>{})` for the unique `I`
-        *        in `Is...` where `I == index`, then stop. No-op if `index` is not in `Is`.
-        *
-        * @tparam Fn    Callable accepting a `std::integral_constant<std::size_t, I>`.
-        * @tparam Is    Compile-time index sequence; typically `0..type_count-1`.
-        *
-        * @param[in] index  Runtime index to match.
-        * @param[in] fn     Action to invoke on the matching index.
-        *
-        * @note `noexcept` is conditional: propagates from `Fn`. Callers that supply a
-        *       `noexcept` lambda (e.g. `reset`) remain noexcept; callers that supply a
-        *       potentially-throwing lambda (e.g. `dispatch`) inherit that possibility.
-        * @note Zero runtime overhead: `Fn` is monomorphized and the constant is folded
-        *       by the compiler at any optimization level.
-        */
-        template<std::size_t... Is, typename Fn>
-        static void index_dispatch(std::size_t index, std::index_sequence<Is...>, Fn&& fn)
-            noexcept(noexcept(fn(std::integral_constant<std::size_t, 0>{})));
-        /**
         * @brief Accessor for the canonical compile-time lookup artifact.
         *
         * @return `constexpr const&` to the MPH singleton for the extracted keys.
@@ -334,7 +320,7 @@ namespace etools::factories {
         *         constructible from `Args` or all its slots are occupied.
         *
         * @note `noexcept` mirrors `emplace`: noexcept iff every type constructible from
-        *       `Args...` is also nothrow-constructible. The lambda passed to `index_dispatch`
+        *       `Args...` is also nothrow-constructible. The lambda passed to `meta::with_index`
         *       carries the same spec, so the noexcept guarantee threads all the way through.
         */
         template<typename... Args>
@@ -370,6 +356,24 @@ namespace etools::factories {
     class dispatch_factory<Base, Extractor, meta::typelist<Ts...>>
         : public dispatch_factory<Base, Extractor, Ts...> {};
 
+    /**
+    * @brief `dispatch_factory` keyed by each registered type's own `static constexpr key`.
+    *
+    * Uses `meta::static_key` (see `meta/capabilities.hpp`) as the extractor, so types
+    * opt in just by declaring the member; a type without one fails with a
+    * `static_key` diagnostic. Accepts the same registrations as `dispatch_factory`,
+    * including `capacity<T, N>` tags and a single `meta::typelist`.
+    *
+    * @par Example
+    * @code
+    * struct cat : animal { static constexpr std::uint16_t key = 1; };
+    * struct dog : animal { static constexpr std::uint16_t key = 2; };
+    * keyed_dispatch_factory<animal, cat, capacity<dog, 3>> f;
+    * @endcode
+    */
+    template<typename Base, typename... Regs>
+    using keyed_dispatch_factory = dispatch_factory<Base, meta::static_key, Regs...>;
+
 } // namespace etools::factories
 
 #include "dispatch_factory.tpp"
@@ -22,6 +22,7 @@ namespace etools::factories {
     template <typename Base, template<typename> typename Extractor, typename... Regs>
     void dispatch_factory<Base, Extractor, Regs...>::cell_deleter::operator()(Base*) const noexcept
     {
+        trace::span<trace::event::factory_release> span{static_cast<std::uint64_t>(key)};
         factory->reset(key, slot_index); // unique_ptr only calls this when ptr != nullptr, so factory is always valid here
     }
 
@@ -40,6 +41,7 @@ namespace etools::factories {
         noexcept(nothrow_emplace_v<Args...>)
         -> handle_t
     {
+        trace::span<trace::event::factory_emplace> span{static_cast<std::uint64_t>(key)};
         constexpr const auto& table = mpht();
         std::size_t index = table(key);
         if (index >= type_count) return handle_t{};
@@ -56,23 +58,15 @@ namespace etools::factories {
         std::size_t index = table(key);
         // Key and slot originate from a successful emplace - both must be valid.
         assert(index < type_count);
-        index_dispatch(index, std::index_sequence_for<Regs...>{},
+        meta::with_index<type_count>(index,
             [this, slot_index](auto I) noexcept {
                 auto& arr = std::get<I()>(_slots);
                 assert(slot_index < arr.size());
                 arr[slot_index].reset();
+                trace::instant<trace::event::pool_release>(slot_index);
             });
     }
 
-    template <typename Base, template<typename> typename Extractor, typename... Regs>
-    template <std::size_t... Is, typename Fn>
-    void dispatch_factory<Base, Extractor, Regs...>::index_dispatch(
-        std::size_t index, std::index_sequence<Is...>, Fn&& fn)
-        noexcept(noexcept(fn(std::integral_constant<std::size_t, 0>{})))
-    {
-        ((index == Is ? (fn(std::integral_constant<std::size_t, Is>{}), true) : false) || ...);
-    }
-
     template <typename Base, template <typename> typename Extractor, typename... Regs>
     constexpr const auto& dispatch_factory<Base, Extractor, Regs...>::mpht() noexcept
     {
@@ -91,7 +85,7 @@ namespace etools::factories {
         // For k constructor signatures and n types: O(k*n) compile time.
         // Future: replace nth_t with meta::pack_at_t to amortize to O(n+k).
         Base* result = nullptr;
-        index_dispatch(index, std::index_sequence_for<Regs...>{},
+        meta::with_index<type_count>(index,
             [this, &result, &out_slot, &args...](auto I)
                 noexcept(nothrow_emplace_v<Args...>)
             {
@@ -102,6 +96,7 @@ namespace etools::factories {
                         if (!arr[i].has_value()) {
                             result   = &arr[i].emplace(std::forward<Args>(args)...);
                             out_slot = static_cast<slot_index_t>(i);
+                            trace::instant<trace::event::pool_acquire>(i);
                             return;
                         }
                     }
@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file consistent.hpp
+*
+* @brief Consistent hashing for sharding: jump hash, weighted rendezvous (HRW) hash and bounded-load hashing.
+*
+* @ingroup etools_hashing etools::hashing
+*
+* `mix_u64(key) % n` moves almost every key when `n` changes. The schemes here
+* move only the keys that have to move:
+*
+* | Scheme | State | Cost per key | Keys moved when a shard is added |
+* |---|---|---|---|
+* | `jump_hash` | none | O(log n) | `1/(n+1)`, all to the new shard |
+* | `rendezvous_hash` | node ids (and weights) | O(n) | `w_new / Σw`, all to the new node; removing any node moves only its keys |
+* | `bounded_load_hash` | per-bucket load counters | O(1) expected | about `1/(n+1)` plus overflow spill; no bucket exceeds `ceil((1+ε)·m/n)` |
+*
+* `jump_hash` is the Lamping-Veach algorithm and only supports adding or
+* removing the *last* bucket. Use `rendezvous_hash` when arbitrary nodes can
+* leave or nodes have different weights, and `bounded_load_hash` when a hot
+* shard must not receive more than its fair share. Every function has a batch
+* overload taking a pointer and a count.
+*
+* ### Example
+* @code
+* #include "etools/hashing/consistent.hpp"
+* using namespace etools::hashing;
+*
+* std::uint32_t shard = jump_hash(mix_u64(user_id), 16);
+*
+* const hrw_node nodes[] = {{0xA1, 1.0}, {0xB2, 2.0}, {0xC3, 1.0}};  // B gets half the keys
+* std::uint32_t owner = rendezvous_hash(user_id, nodes, 3);
+*
+* bounded_load_hash<64> lb{16, 0.25};                  // 16 buckets, 25% slack
+* std::uint32_t worker = lb.assign(request_id);        // ... lb.release(worker) when done
+* @endcode
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_HASHING_CONSISTENT_HPP_
+#define ETOOLS_HASHING_CONSISTENT_HPP_
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "utils.hpp" // mix_u64
+
+namespace etools::hashing {
+
+    /**
+    * @brief Jump consistent hash (Lamping & Veach, 2014).
+    *
+    * Maps `key` to a bucket in `[0, buckets)`. Growing `buckets` from `n` to
+    * `n + 1` moves exactly the keys that land in bucket `n`.
+    *
+    * @param[in] key     Key; the algorithm seeds an LCG with it, so keys need
+    *                    not be pre-mixed, but mixing (`mix_u64`) is harmless.
+    * @param[in] buckets Bucket count, at least 1.
+    * @return Bucket index.
+    *
+    * @note Output matches the reference implementation bit for bit.
+    */
+    [[nodiscard]] constexpr std::uint32_t jump_hash(std::uint64_t key, std::uint32_t buckets) noexcept;
+
+    /**
+    * @brief Batch `jump_hash`: `out[i] = jump_hash(keys[i], buckets)` for `i < count`.
+    */
+    inline void jump_hash(const std::uint64_t* keys, std::size_t count, std::uint32_t buckets, std::uint32_t* out) noexcept;
+
+    /**
+    * @struct hrw_node
+    *
+    * @brief A rendezvous hashing participant: a stable identifier and a relative weight.
+    *
+    * The id, not the node's position in the array, decides which keys it owns,
+    * so nodes can be reordered, added or removed anywhere.
+    */
+    struct hrw_node {
+        std::uint64_t id;     ///< Stable node identifier.
+        double weight = 1.0;  ///< Relative share of keys; must be positive.
+    };
+
+    /**
+    * @brief Rendezvous (highest random weight) hash over equally weighted nodes.
+    *
+    * Every node scores `mix_u64(mix_u64(key) ^ mix_u64(id))`; the highest score wins.
+    *
+    * @param[in] key Key.
+    * @param[in] ids Node identifiers.
+    * @param[in] n   Number of nodes, at least 1.
+    * @return Index into `ids` of the owning node.
+    */
+    [[nodiscard]] inline std::uint32_t rendezvous_hash(std::uint64_t key, const std::uint64_t* ids, std::uint32_t n) noexcept;
+
+    /**
+    * @brief Weighted rendezvous hash (Schindelhauer & Schomaker logarithmic method).
+    *
+    * Node `i` scores `w_i / -ln(u_i)` with `u_i` uniform in (0, 1) derived
+    * from the same mix as the unweighted form, so each node receives a share
+    * of keys proportional to its weight.
+    *
+    * @param[in] key   Key.
+    * @param[in] nodes Nodes with ids and weights.
+    * @param[in] n     Number of nodes, at least 1.
+    * @return Index into `nodes` of the owning node.
+    */
+    [[nodiscard]] inline std::uint32_t rendezvous_hash(std::uint64_t key, const hrw_node* nodes, std::uint32_t n) noexcept;
+
+    /// @brief Batch unweighted `rendezvous_hash` over `keys[0..count)`.
+    inline void rendezvous_hash(const std::uint64_t* keys, std::size_t count,
+                                const std::uint64_t* ids, std::uint32_t n, std::uint32_t* out) noexcept;
+
+    /// @brief Batch weighted `rendezvous_hash` over `keys[0..count)`.
+    inline void rendezvous_hash(const std::uint64_t* keys, std::size_t count,
+                                const hrw_node* nodes, std::uint32_t n, std::uint32_t* out) noexcept;
+
+    /**
+    * @class bounded_load_hash
+    *
+    * @brief Consistent hashing with bounded loads (Mirrokni, Thorup & Zadimoghaddam, 2018).
+    *
+    * Tracks how many live keys each bucket holds. `assign(key)` tries the
+    * bucket `jump_hash` picks; if that bucket already holds
+    * `capacity() = ceil((1 + epsilon) * (size() + 1) / buckets())` keys, it
+    * retries with rehashed keys and, after `buckets()` misses, takes the next
+    * bucket with room. No bucket ever exceeds `capacity()`, and with no
+    * overflow the assignment equals `jump_hash(mix_u64(key), buckets())`.
+    *
+    * Storage is a fixed array of `MaxBuckets` counters - no allocation.
+    *
+    * @tparam MaxBuckets Largest supported bucket count.
+    */
+    template<std::size_t MaxBuckets>
+    class bounded_load_hash {
+        static_assert(MaxBuckets > 0, "bounded_load_hash: MaxBuckets must be at least 1");
+
+    public:
+        /**
+        * @brief Empty table over `buckets` buckets.
+        *
+        * @param[in] buckets Bucket count in `[1, MaxBuckets]`.
+        * @param[in] epsilon Allowed overload above the average; must be positive.
+        */
+        explicit bounded_load_hash(std::uint32_t buckets, double epsilon = 0.25) noexcept;
+
+        /**
+        * @brief Places `key` and counts it against its bucket.
+        *
+        * Assigning the same key twice counts it twice; pair each `assign` with
+        * one `release`.
+        *
+        * @return Bucket index in `[0, buckets())`.
+        */
+        std::uint32_t assign(std::uint64_t key) noexcept;
+
+        /// @brief Batch `assign` over `keys[0..count)`, in order.
+        void assign(const std::uint64_t* keys, std::size_t count, std::uint32_t* out) noexcept;
+
+        /**
+        * @brief Removes one key from `bucket`.
+        *
+        * @pre `load(bucket) > 0`.
+        */
+        void release(std::uint32_t bucket) noexcept;
+
+        /// @brief Forgets every key; loads drop to zero.
+        void clear() noexcept;
+
+        /// @brief Number of buckets.
+        [[nodiscard]] std::uint32_t buckets() const noexcept;
+
+        /// @brief Number of keys currently assigned.
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /// @brief Keys currently assigned to `bucket`.
+        [[nodiscard]] std::uint32_t load(std::uint32_t bucket) const noexcept;
+
+        /// @brief Per-bucket limit that the next `assign` enforces.
+        [[nodiscard]] std::uint32_t capacity() const noexcept;
+
+    private:
+        std::array<std::uint32_t, MaxBuckets> _load{};
+        std::size_t _size = 0;
+        std::uint32_t _buckets;
+        double _factor; // 1 + epsilon
+    };
+
+} // namespace etools::hashing
+
+#include "consistent.tpp"
+#endif // ETOOLS_HASHING_CONSISTENT_HPP_
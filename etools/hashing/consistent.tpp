@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file consistent.tpp
+*
+* @brief Definition of consistent.hpp methods.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_HASHING_CONSISTENT_TPP_
+#define ETOOLS_HASHING_CONSISTENT_TPP_
+#include "consistent.hpp"
+#include <cassert>
+#include <cmath>
+
+namespace etools::hashing {
+
+    namespace details {
+
+        /// @brief Per-(key, node) score shared by both rendezvous forms; `mixed_key = mix_u64(key)`.
+        constexpr std::uint64_t hrw_score(std::uint64_t mixed_key, std::uint64_t id) noexcept {
+            return mix_u64(mixed_key ^ mix_u64(id));
+        }
+
+        /// @brief Weighted score `w / -ln(u)`, `u` taken from the top 53 bits of the raw score, never 0 or 1.
+        inline double hrw_weighted_score(std::uint64_t mixed_key, const hrw_node& node) noexcept {
+            const double u = (static_cast<double>(hrw_score(mixed_key, node.id) >> 11) + 0.5) * 0x1p-53;
+            return node.weight / -std::log(u);
+        }
+
+        /// @brief Key sequence of the `probe`-th attempt of `bounded_load_hash::assign`.
+        constexpr std::uint64_t bounded_probe_key(std::uint64_t key, std::uint32_t probe) noexcept {
+            return mix_u64(key + probe * 0x9E3779B97F4A7C15ULL);
+        }
+
+    } // namespace details
+
+    constexpr std::uint32_t jump_hash(std::uint64_t key, std::uint32_t buckets) noexcept {
+        assert(buckets > 0 && "jump_hash(): bucket count must be positive");
+        std::int64_t b = -1, j = 0;
+        while (j < static_cast<std::int64_t>(buckets)) {
+            b = j;
+            key = key * 2862933555777941757ULL + 1;
+            j = static_cast<std::int64_t>(static_cast<double>(b + 1) *
+                (static_cast<double>(std::int64_t{1} << 31) / static_cast<double>((key >> 33) + 1)));
+        }
+        return static_cast<std::uint32_t>(b);
+    }
+
+    inline void jump_hash(const std::uint64_t* keys, std::size_t count, std::uint32_t buckets, std::uint32_t* out) noexcept {
+        for (std::size_t i = 0; i < count; ++i) out[i] = jump_hash(keys[i], buckets);
+    }
+
+    inline std::uint32_t rendezvous_hash(std::uint64_t key, const std::uint64_t* ids, std::uint32_t n) noexcept {
+        assert(n > 0 && "rendezvous_hash(): node count must be positive");
+        const std::uint64_t mk = mix_u64(key);
+        std::uint32_t best = 0;
+        std::uint64_t best_score = details::hrw_score(mk, ids[0]);
+        for (std::uint32_t i = 1; i < n; ++i) {
+            const std::uint64_t s = details::hrw_score(mk, ids[i]);
+            if (s > best_score) { best_score = s; best = i; }
+        }
+        return best;
+    }
+
+    inline std::uint32_t rendezvous_hash(std::uint64_t key, const hrw_node* nodes, std::uint32_t n) noexcept {
+        assert(n > 0 && "rendezvous_hash(): node count must be positive");
+        const std::uint64_t mk = mix_u64(key);
+        std::uint32_t best = 0;
+        double best_score = details::hrw_weighted_score(mk, nodes[0]);
+        for (std::uint32_t i = 1; i < n; ++i) {
+            const double s = details::hrw_weighted_score(mk, nodes[i]);
+            if (s > best_score) { best_score = s; best = i; }
+        }
+        return best;
+    }
+
+    inline void rendezvous_hash(const std::uint64_t* keys, std::size_t count,
+                                const std::uint64_t* ids, std::uint32_t n, std::uint32_t* out) noexcept {
+        for (std::size_t i = 0; i < count; ++i) out[i] = rendezvous_hash(keys[i], ids, n);
+    }
+
+    inline void rendezvous_hash(const std::uint64_t* keys, std::size_t count,
+                                const hrw_node* nodes, std::uint32_t n, std::uint32_t* out) noexcept {
+        for (std::size_t i = 0; i < count; ++i) out[i] = rendezvous_hash(keys[i], nodes, n);
+    }
+
+    template<std::size_t MaxBuckets>
+    bounded_load_hash<MaxBuckets>::bounded_load_hash(std::uint32_t buckets, double epsilon) noexcept
+        : _buckets{buckets}, _factor{1.0 + epsilon}
+    {
+        assert(buckets > 0 && buckets <= MaxBuckets && "bounded_load_hash: bucket count out of range");
+        assert(epsilon > 0.0 && "bounded_load_hash: epsilon must be positive");
+    }
+
+    template<std::size_t MaxBuckets>
+    std::uint32_t bounded_load_hash<MaxBuckets>::capacity() const noexcept {
+        return static_cast<std::uint32_t>(std::ceil(_factor * static_cast<double>(_size + 1) / _buckets));
+    }
+
+    template<std::size_t MaxBuckets>
+    std::uint32_t bounded_load_hash<MaxBuckets>::assign(std::uint64_t key) noexcept {
+        const std::uint32_t cap = capacity();
+        std::uint32_t b = 0;
+        for (std::uint32_t probe = 0; probe < _buckets; ++probe) {
+            b = jump_hash(details::bounded_probe_key(key, probe), _buckets);
+            if (_load[b] < cap) break;
+        }
+        // cap * buckets > size, so some bucket has room; walk to it after too many misses.
+        while (_load[b] >= cap) b = (b + 1 == _buckets) ? 0 : b + 1;
+        ++_load[b];
+        ++_size;
+        return b;
+    }
+
+    template<std::size_t MaxBuckets>
+    void bounded_load_hash<MaxBuckets>::assign(const std::uint64_t* keys, std::size_t count, std::uint32_t* out) noexcept {
+        for (std::size_t i = 0; i < count; ++i) out[i] = assign(keys[i]);
+    }
+
+    template<std::size_t MaxBuckets>
+    void bounded_load_hash<MaxBuckets>::release(std::uint32_t bucket) noexcept {
+        assert(bucket < _buckets && _load[bucket] > 0 && "bounded_load_hash::release(): bucket holds no key");
+        --_load[bucket];
+        --_size;
+    }
+
+    template<std::size_t MaxBuckets>
+    void bounded_load_hash<MaxBuckets>::clear() noexcept {
+        _load.fill(0);
+        _size = 0;
+    }
+
+    template<std::size_t MaxBuckets>
+    std::uint32_t bounded_load_hash<MaxBuckets>::buckets() const noexcept {
+        return _buckets;
+    }
+
+    template<std::size_t MaxBuckets>
+    std::size_t bounded_load_hash<MaxBuckets>::size() const noexcept {
+        return _size;
+    }
+
+    template<std::size_t MaxBuckets>
+    std::uint32_t bounded_load_hash<MaxBuckets>::load(std::uint32_t bucket) const noexcept {
+        assert(bucket < _buckets && "bounded_load_hash::load(): bucket out of range");
+        return _load[bucket];
+    }
+
+} // namespace etools::hashing
+
+#endif // ETOOLS_HASHING_CONSISTENT_TPP_
@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file count_min.hpp
+*
+* @brief Fixed-memory frequency sketches: count-min and count sketch.
+*
+* @ingroup etools_hashing etools::hashing
+*
+* Both sketches keep `Depth` rows of `Width` counters and answer "how often
+* was this key seen?" without storing keys. A key is hashed once with
+* `mix_u64`; row `i` then uses `mix_u32(lo + i * hi)` of the two halves
+* (Kirsch-Mitzenmacher double hashing) to pick its counter.
+*
+* | Sketch | Estimate | Error |
+* |---|---|---|
+* | `count_min_sketch` | minimum over rows; never underestimates | overestimates by at most `e/Width * total()` with probability `1 - e^-Depth` |
+* | `count_sketch` | median of signed counters; unbiased | about `total_l2 / sqrt(Width)`; better for skewed streams |
+*
+* ### Concurrency
+* Counters are relaxed atomics. `update` assumes one writing thread per
+* sketch and compiles to plain loads and stores. `merge(other)` uses atomic
+* additions, so many threads can fold their own sketches into one shared
+* sketch concurrently, without a lock. The merge target must not receive
+* `update` calls meanwhile: its load/store pair could overwrite a merged
+* increment. `estimate` may run at any time.
+*
+* ### Example
+* @code
+* #include "etools/hashing/count_min.hpp"
+* using namespace etools::hashing;
+*
+* count_min_sketch<1024, 4> shared;                // 16 KiB
+* thread_local count_min_sketch<1024, 4> mine;
+* mine.update(keys, count);
+* shared.merge(mine);
+* mine.clear();                                   // else the next merge counts these updates again
+* if (shared.estimate(k) > shared.total() / 100) { ... }   // >1% of traffic: heavy hitter
+* @endcode
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_HASHING_COUNT_MIN_HPP_
+#define ETOOLS_HASHING_COUNT_MIN_HPP_
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "utils.hpp" // mix_u64, mix_u32
+
+namespace etools::hashing {
+
+    namespace details {
+
+        /**
+        * @brief Shared storage and hashing of `count_min_sketch` and `count_sketch`.
+        *
+        * @tparam Width   Counters per row; a power of two, at most 2^31.
+        * @tparam Depth   Number of rows.
+        * @tparam Counter Counter type.
+        */
+        template<std::size_t Width, std::size_t Depth, typename Counter>
+        class frequency_rows {
+            static_assert(Width != 0 && (Width & (Width - 1)) == 0 && Width <= (std::size_t{1} << 31),
+                "frequency sketch: Width must be a power of two no larger than 2^31");
+            static_assert(Depth > 0, "frequency sketch: Depth must be at least 1");
+            static_assert(std::is_integral_v<Counter>, "frequency sketch: Counter must be an integral type");
+
+        public:
+            static constexpr std::size_t width = Width;
+            static constexpr std::size_t depth = Depth;
+
+            frequency_rows() noexcept = default;
+            frequency_rows(const frequency_rows&) = delete;
+            frequency_rows& operator=(const frequency_rows&) = delete;
+
+            /// @brief Number of updates (sum of all `count`s) recorded, including merged ones.
+            [[nodiscard]] std::uint64_t total() const noexcept;
+
+            /// @brief Resets every counter and `total()` to zero.
+            void clear() noexcept;
+
+        protected:
+            /// @brief Per-row hash of `key`: low bits pick the column, bit 31 is the count-sketch sign.
+            static std::array<std::uint32_t, Depth> row_hashes(std::uint64_t key) noexcept;
+
+            void add(std::size_t i, Counter delta) noexcept;
+            void add_total(std::uint64_t n) noexcept;
+            void merge_rows(const frequency_rows& other) noexcept;
+            [[nodiscard]] Counter at(std::size_t i) const noexcept;
+
+            alignas(64) std::array<std::atomic<Counter>, Width * Depth> _cells{};
+            std::atomic<std::uint64_t> _total{0};
+        };
+
+    } // namespace details
+
+    /**
+    * @class count_min_sketch
+    *
+    * @brief Count-min sketch (Cormode & Muthukrishnan): estimates are upper bounds.
+    *
+    * @tparam Width   Counters per row; a power of two.
+    * @tparam Depth   Number of rows.
+    * @tparam Counter Unsigned counter type; wraps on overflow.
+    */
+    template<std::size_t Width, std::size_t Depth = 4, typename Counter = std::uint32_t>
+    class count_min_sketch : public details::frequency_rows<Width, Depth, Counter> {
+        static_assert(std::is_unsigned_v<Counter>, "count_min_sketch: Counter must be unsigned");
+
+    public:
+        /// @brief Adds `count` occurrences of `key`. One writer per sketch.
+        void update(std::uint64_t key, Counter count = 1) noexcept;
+
+        /// @brief Adds one occurrence of each of `keys[0..n)`.
+        void update(const std::uint64_t* keys, std::size_t n) noexcept;
+
+        /// @brief Estimated occurrences of `key`; never below the true count.
+        [[nodiscard]] Counter estimate(std::uint64_t key) const noexcept;
+
+        /**
+        * @brief Adds all of `other`'s counters into this sketch. Lock-free; safe to call concurrently.
+        *
+        * @warning No thread may `update` this sketch meanwhile; `update`'s non-atomic
+        *          load/store pair can drop increments that `merge` adds.
+        */
+        void merge(const count_min_sketch& other) noexcept;
+
+    private:
+        void add_key(std::uint64_t key, Counter count) noexcept;
+    };
+
+    /**
+    * @class count_sketch
+    *
+    * @brief Count sketch (Charikar, Chen & Farach-Colton): unbiased signed estimates.
+    *
+    * @tparam Width   Counters per row; a power of two.
+    * @tparam Depth   Number of rows; odd values give a true median.
+    * @tparam Counter Signed counter type.
+    */
+    template<std::size_t Width, std::size_t Depth = 5, typename Counter = std::int32_t>
+    class count_sketch : public details::frequency_rows<Width, Depth, Counter> {
+        static_assert(std::is_signed_v<Counter>, "count_sketch: Counter must be signed");
+
+    public:
+        /// @brief Adds `count` occurrences of `key`. One writer per sketch.
+        void update(std::uint64_t key, Counter count = 1) noexcept;
+
+        /// @brief Adds one occurrence of each of `keys[0..n)`.
+        void update(const std::uint64_t* keys, std::size_t n) noexcept;
+
+        /// @brief Estimated occurrences of `key`: median over rows (upper median for even `Depth`).
+        [[nodiscard]] Counter estimate(std::uint64_t key) const noexcept;
+
+        /**
+        * @brief Adds all of `other`'s counters into this sketch. Lock-free; safe to call concurrently.
+        *
+        * @warning No thread may `update` this sketch meanwhile; `update`'s non-atomic
+        *          load/store pair can drop increments that `merge` adds.
+        */
+        void merge(const count_sketch& other) noexcept;
+
+    private:
+        void add_key(std::uint64_t key, Counter count) noexcept;
+
+        /// @brief `+1` or `-1` from bit 31 of a row hash.
+        static constexpr Counter row_sign(std::uint32_t row_hash) noexcept;
+    };
+
+} // namespace etools::hashing
+
+#include "count_min.tpp"
+#endif // ETOOLS_HASHING_COUNT_MIN_HPP_
@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file count_min.tpp
+*
+* @brief Definition of count_min.hpp methods.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_HASHING_COUNT_MIN_TPP_
+#define ETOOLS_HASHING_COUNT_MIN_TPP_
+#include "count_min.hpp"
+
+namespace etools::hashing {
+
+    namespace details {
+
+        template<std::size_t Width, std::size_t Depth, typename Counter>
+        inline std::array<std::uint32_t, Depth>
+        frequency_rows<Width, Depth, Counter>::row_hashes(std::uint64_t key) noexcept {
+            const std::uint64_t h = mix_u64(key);
+            const auto lo = static_cast<std::uint32_t>(h);
+            const auto hi = static_cast<std::uint32_t>(h >> 32) | 1u;
+            std::array<std::uint32_t, Depth> out{};
+            for (std::size_t i = 0; i < Depth; ++i)
+                out[i] = mix_u32(lo + static_cast<std::uint32_t>(i) * hi);
+            return out;
+        }
+
+        template<std::size_t Width, std::size_t Depth, typename Counter>
+        inline void frequency_rows<Width, Depth, Counter>::add(std::size_t i, Counter delta) noexcept {
+            // Single writer: a relaxed load/store pair, not a locked read-modify-write.
+            auto& c = _cells[i];
+            c.store(static_cast<Counter>(c.load(std::memory_order_relaxed) + delta), std::memory_order_relaxed);
+        }
+
+        template<std::size_t Width, std::size_t Depth, typename Counter>
+        inline void frequency_rows<Width, Depth, Counter>::add_total(std::uint64_t n) noexcept {
+            _total.store(_total.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+        }
+
+        template<std::size_t Width, std::size_t Depth, typename Counter>
+        inline Counter frequency_rows<Width, Depth, Counter>::at(std::size_t i) const noexcept {
+            return _cells[i].load(std::memory_order_relaxed);
+        }
+
+        template<std::size_t Width, std::size_t Depth, typename Counter>
+        void frequency_rows<Width, Depth, Counter>::merge_rows(const frequency_rows& other) noexcept {
+            for (std::size_t i = 0; i < Width * Depth; ++i) {
+                const Counter v = other._cells[i].load(std::memory_order_relaxed);
+                if (v) _cells[i].fetch_add(v, std::memory_order_relaxed);
+            }
+            _total.fetch_add(other._total.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+
+        template<std::size_t Width, std::size_t Depth, typename Counter>
+        std::uint64_t frequency_rows<Width, Depth, Counter>::total() const noexcept {
+            return _total.load(std::memory_order_relaxed);
+        }
+
+        template<std::size_t Width, std::size_t Depth, typename Counter>
+        void frequency_rows<Width, Depth, Counter>::clear() noexcept {
+            for (auto& c : _cells) c.store(0, std::memory_order_relaxed);
+            _total.store(0, std::memory_order_relaxed);
+        }
+
+    } // namespace details
+
+    template<std::size_t Width, std::size_t Depth, typename Counter>
+    inline void count_min_sketch<Width, Depth, Counter>::add_key(std::uint64_t key, Counter count) noexcept {
+        const auto rows = this->row_hashes(key);
+        for (std::size_t i = 0; i < Depth; ++i)
+            this->add(i * Width + (rows[i] & (Width - 1)), count);
+    }
+
+    template<std::size_t Width, std::size_t Depth, typename Counter>
+    inline void count_min_sketch<Width, Depth, Counter>::update(std::uint64_t key, Counter count) noexcept {
+        add_key(key, count);
+        this->add_total(count);
+    }
+
+    template<std::size_t Width, std::size_t Depth, typename Counter>
+    void count_min_sketch<Width, Depth, Counter>::update(const std::uint64_t* keys, std::size_t n) noexcept {
+        for (std::size_t k = 0; k < n; ++k) add_key(keys[k], 1);
+        this->add_total(n);
+    }
+
+    template<std::size_t Width, std::size_t Depth, typename Counter>
+    Counter count_min_sketch<Width, Depth, Counter>::estimate(std::uint64_t key) const noexcept {
+        const auto rows = this->row_hashes(key);
+        Counter best = this->at(rows[0] & (Width - 1));
+        for (std::size_t i = 1; i < Depth; ++i) {
+            const Counter v = this->at(i * Width + (rows[i] & (Width - 1)));
+            if (v < best) best = v;
+        }
+        return best;
+    }
+
+    template<std::size_t Width, std::size_t Depth, typename Counter>
+    void count_min_sketch<Width, Depth, Counter>::merge(const count_min_sketch& other) noexcept {
+        this->merge_rows(other);
+    }
+
+    template<std::size_t Width, std::size_t Depth, typename Counter>
+    constexpr Counter count_sketch<Width, Depth, Counter>::row_sign(std::uint32_t row_hash) noexcept {
+        return static_cast<Counter>(1 - 2 * static_cast<int>(row_hash >> 31));
+    }
+
+    template<std::size_t Width, std::size_t Depth, typename Counter>
+    inline void count_sketch<Width, Depth, Counter>::add_key(std::uint64_t key, Counter count) noexcept {
+        const auto rows = this->row_hashes(key);
+        for (std::size_t i = 0; i < Depth; ++i) {
+            // The sign is a coin flip per key: multiply rather than branch.
+            this->add(i * Width + (rows[i] & (Width - 1)), static_cast<Counter>(count * row_sign(rows[i])));
+        }
+    }
+
+    template<std::size_t Width, std::size_t Depth, typename Counter>
+    inline void count_sketch<Width, Depth, Counter>::update(std::uint64_t key, Counter count) noexcept {
+        add_key(key, count);
+        this->add_total(static_cast<std::uint64_t>(count));
+    }
+
+    template<std::size_t Width, std::size_t Depth, typename Counter>
+    void count_sketch<Width, Depth, Counter>::update(const std::uint64_t* keys, std::size_t n) noexcept {
+        for (std::size_t k = 0; k < n; ++k) add_key(keys[k], 1);
+        this->add_total(n);
+    }
+
+    template<std::size_t Width, std::size_t Depth, typename Counter>
+    Counter count_sketch<Width, Depth, Counter>::estimate(std::uint64_t key) const noexcept {
+        const auto rows = this->row_hashes(key);
+        std::array<Counter, Depth> v{};
+        for (std::size_t i = 0; i < Depth; ++i) {
+            const Counter c = this->at(i * Width + (rows[i] & (Width - 1)));
+            v[i] = static_cast<Counter>(c * row_sign(rows[i]));
+        }
+        // Depth is small: insertion sort, then the middle element.
+        for (std::size_t i = 1; i < Depth; ++i) {
+            const Counter x = v[i];
+            std::size_t j = i;
+            for (; j > 0 && x < v[j - 1]; --j) v[j] = v[j - 1];
+            v[j] = x;
+        }
+        return v[Depth / 2];
+    }
+
+    template<std::size_t Width, std::size_t Depth, typename Counter>
+    void count_sketch<Width, Depth, Counter>::merge(const count_sketch& other) noexcept {
+        this->merge_rows(other);
+    }
+
+} // namespace etools::hashing
+
+#endif // ETOOLS_HASHING_COUNT_MIN_TPP_
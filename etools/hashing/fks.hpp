@@ -30,10 +30,12 @@
 *
 * **Surface**
 * - `etools::hashing::fks<Key>` - Facade. Use `fks<Key>::instance<Keys...>()` to
-*   obtain a `constexpr const&` to the canonical, per-key-set singleton.
-* - `etools::hashing::details::fks_impl<Key, Keys...>` - implementation. Immutable,
+*   obtain a `constexpr const&` to the canonical, per-key-set singleton, or
+*   `fks<Key>::instance<Provider>()` for a key provider (see `key_provider.hpp`).
+* - `etools::hashing::details::fks_table<Key, Provider>` - implementation. Immutable,
 *   constexpr-constructible structure that owns the arrays and exposes `operator()`,
-*   `size()`, `capacity()`, `not_found()`, and `buckets()`.
+*   `size()`, `capacity()`, `not_found()`, and `buckets()`. `fks_impl<Key, Keys...>`
+*   names the table of a pack.
 *
 * **References**
 * - Fredman, Komlós, Szemerédi. “Storing a Sparse Table with O(1) Access Time.”
@@ -84,8 +86,11 @@
 #include <type_traits>
 
 #include "utils.hpp"            // mix_native, top_bits, ceil_pow2, etc. (constexpr)
+#include "key_provider.hpp"     // key_pack, is_key_provider_v
 #include "../meta/traits.hpp"   // meta::smallest_uint_t<N>
 #include "../meta/utility.hpp"  // meta::all_distinct(...)
+#include "../meta/algorithm.hpp" // meta::counting_sort_by_bucket, meta::exclusive_prefix_sum
+#include "../trace/hooks.hpp"     // trace::lookup
 
 namespace etools::hashing {
     
@@ -105,54 +110,35 @@ namespace etools::hashing {
     */
     namespace details {
         /**
-        * @brief Count how many keys fall into each first-level bucket.
+        * @brief Mix every key once with `mix_native`.
         *
-        * Distributes keys into M = BucketCount buckets using `bucket_of` and
-        * returns per-bucket counts. Used to size second-level tables.
+        * The mixed value drives both the first-level bucket (low bits) and the
+        * second-level position (top bits of `mixed * a_b`), so it is computed a
+        * single time per key instead of once per bucket pass and seed attempt.
         *
         * @tparam KeyType Unsigned key type.
         * @tparam N       Number of keys.
-        * @tparam BucketCount Power-of-two number of buckets.
         * @param keys Input keys in pack order.
-        * @return Array of size BucketCount with counts per bucket.
-        */
-        template <typename KeyType, std::size_t N, std::size_t BucketCount>
-        [[nodiscard]] constexpr std::array<std::size_t, BucketCount>
-        compute_bucket_counts(const std::array<KeyType, N>& keys) noexcept;
-        
-        /**
-        * @brief Compute CSR-style offsets from per-bucket counts.
-        *
-        * Produces an array `off` where `off[b]` is the starting index in a compact
-        * storage region for bucket `b`. The final element `off[BucketCount]` equals
-        * the total number of items.
-        *
-        * @tparam BucketCount Power-of-two number of buckets.
-        * @param counts Per-bucket counts.
-        * @return Array of size BucketCount+1 with prefix sums.
+        * @return Array of size N with the mixed keys.
         */
-        template <std::size_t BucketCount>
-        [[nodiscard]] constexpr std::array<std::size_t, BucketCount + 1>
-        offsets_from_counts(const std::array<std::size_t, BucketCount>& counts) noexcept;
-        
+        template <typename KeyType, std::size_t N>
+        [[nodiscard]] constexpr std::array<std::size_t, N>
+        mix_keys(const std::array<KeyType, N>& keys) noexcept;
+
         /**
-        * @brief Build a CSR (Compressed Sparse Row) "items" array of key indices grouped by bucket.
+        * @brief Group key indices by first-level bucket (CSR layout).
         *
-        * Returns indices 0..N-1 placed contiguously by their bucket, using
-        * the offsets computed by @ref offsets_from_counts.
+        * A stable counting sort (`meta::counting_sort_by_bucket`) over the mixed
+        * keys: per-bucket counts, CSR offsets (`offsets[BucketCount]` equals N)
+        * and key indices grouped by bucket, in one call.
         *
-        * @tparam KeyType Unsigned key type.
-        * @tparam N       Number of keys.
+        * @tparam N           Number of keys.
         * @tparam BucketCount Power-of-two number of buckets.
-        * @param keys Input keys.
-        * @param counts Per-bucket counts.
-        * @param off CSR offsets.
-        * @return Array of size N with key indices grouped by bucket.
+        * @param mixed Keys pre-mixed by @ref mix_keys.
         */
-        template <typename KeyType, std::size_t N, std::size_t BucketCount>
-        [[nodiscard]] constexpr std::array<std::size_t, N>
-        items_csr(const std::array<KeyType, N>& keys,
-            const std::array<std::size_t, BucketCount + 1>& off) noexcept;
+        template <std::size_t N, std::size_t BucketCount>
+        [[nodiscard]] constexpr meta::bucket_partition<N, BucketCount>
+        partition_keys(const std::array<std::size_t, N>& mixed) noexcept;
             
         /**
         * @brief Decide per-bucket second-level table width `r_b`.
@@ -169,37 +155,25 @@ namespace etools::hashing {
         compute_rbits(const std::array<std::size_t, BucketCount>& counts) noexcept;
         
         /**
-        * @brief Sum of all second-level table sizes.
+        * @brief Offsets of the second-level tables in the flat slot array.
         *
-        * Computes `total = Σ_b (1 << r_b)`.
+        * Exclusive prefix sum of `(1 << r_b)`: `offsets[b]` is the first slot of
+        * bucket b and `offsets[BucketCount]` is the total slot count.
         *
         * @tparam BucketCount Power-of-two number of buckets.
         * @param r Per-bucket bit widths `r_b`.
-        * @return Total slot count across all buckets.
+        * @return Array of size BucketCount+1 with slot offsets.
         */
         template <std::size_t BucketCount>
-        [[nodiscard]] constexpr std::size_t
-        total_slots_from_rbits(const std::array<std::uint8_t, BucketCount>& r) noexcept;
-        
-        /**
-        * @brief Compute base offsets for second-level tables.
-        *
-        * Returns `base[b]` giving the starting offset of bucket b’s second-level
-        * table in the flat `slot_to_index` array, using a prefix sum of `(1 << r_b)`.
-        *
-        * @tparam BucketCount Power-of-two number of buckets.
-        * @param r Per-bucket bit widths `r_b`.
-        * @return Array of size BucketCount with base offsets.
-        */
-        template <std::size_t BucketCount>
-        [[nodiscard]] constexpr std::array<std::size_t, BucketCount>
-        base_from_rbits(const std::array<std::uint8_t, BucketCount>& r) noexcept;
+        [[nodiscard]] constexpr std::array<std::size_t, BucketCount + 1>
+        slot_offsets_from_rbits(const std::array<std::uint8_t, BucketCount>& r) noexcept;
         
         /**
-        * @brief Implementation type: immutable, constexpr-built FKS table for a fixed key pack.
+        * @brief Implementation type: immutable, constexpr-built FKS table for a fixed key set.
         *
-        * @tparam KeyType Unsigned integral key type.
-        * @tparam Keys Distinct keys; pack order defines dense indices `[0..N-1]`.
+        * @tparam KeyType  Unsigned integral key type.
+        * @tparam Provider Key provider: `static constexpr std::array<KeyType, N> keys`
+        *                  of distinct keys; array order defines dense indices `[0..N-1]`.
         *
         * ```cpp
         * using Impl = etools::hashing::details::fks_impl<std::uint8_t, 2, 5, 7>;
@@ -209,17 +183,17 @@ namespace etools::hashing {
         *
         * @note This class is constructed at compile time. Instances are exposed via the facade.
         * @note Lookups are O(1). Non-members return `not_found()` (equal to `size()`).
-        * @warning Do not instantiate directly; use `fks<KeyType>::instance<Keys...>()`.
+        * @warning Do not instantiate directly; use `fks<KeyType>::instance<...>()`.
         */
-        template <typename KeyType, KeyType... Keys>
-        class fks_impl {    
+        template <typename KeyType, typename Provider>
+        class fks_table {
         public:
             /**
             * @brief Number of keys in the perfect set (also used as the sentinel).
             *
             * Cross-backend contract: matches `llut::size()`.
             *
-            * @return Count of NTTP keys `N`.
+            * @return Count of keys `N`.
             */
             [[nodiscard]] static constexpr std::size_t size() noexcept;
             
@@ -267,22 +241,22 @@ namespace etools::hashing {
             *
             * @warning The structure is immutable and exposed as a singleton reference.
             */
-            fks_impl(const fks_impl&) = delete;
+            fks_table(const fks_table&) = delete;
 
             /**
             * @brief Deleted copy assignment (non-assignable).
             */
-            fks_impl& operator=(const fks_impl&) = delete;
+            fks_table& operator=(const fks_table&) = delete;
 
             /**
             * @brief Deleted move constructor (non-movable).
             */
-            fks_impl(fks_impl&&) = delete;
+            fks_table(fks_table&&) = delete;
 
             /**
             * @brief Deleted move assignment (non-movable).
             */
-            fks_impl& operator=(fks_impl&&) = delete;
+            fks_table& operator=(fks_table&&) = delete;
             
         private:
             /**
@@ -339,7 +313,7 @@ namespace etools::hashing {
             *
             * @note Construction is constexpr; no dynamic memory is used.
             */
-            constexpr fks_impl() noexcept;
+            constexpr fks_table() noexcept;
         
             /**
             * @brief Compute the local position within a bucket for a given key.
@@ -355,7 +329,7 @@ namespace etools::hashing {
             *
             * @return A value-initialized implementation object (used to form the singleton).
             */
-            template <typename K, K... Ks> friend constexpr fks_impl<K, Ks...> make_fks_impl() noexcept;
+            template <typename K, typename P> friend constexpr fks_table<K, P> make_fks_table() noexcept;
 
             /**
             * @brief facade friendship for access to the canonical singleton.
@@ -372,29 +346,44 @@ namespace etools::hashing {
             * @brief Compile-time sanity: key type is unsigned integral.
             */
             static_assert(std::is_unsigned_v<KeyType>, "KeyType must be unsigned integral");
+
+            /**
+            * @brief Compile-time sanity: the provider exposes `std::array<KeyType, N> keys`.
+            */
+            static_assert(is_key_provider_v<Provider, KeyType>,
+                "Provider must expose static constexpr std::array<KeyType, N> keys");
         };
-        
+
         /**
-        * @brief constexpr factory: constructs an `fks_impl` by value.
+        * @brief FKS table of an NTTP key pack.
         *
-        * @tparam Key Unsigned integral key type.
+        * @tparam Key  Unsigned integral key type.
         * @tparam Keys Distinct keys; pack order defines indices.
-        * @return A value-initialized `fks_impl<Key, Keys...>`.
         */
         template <typename Key, Key... Keys>
-        constexpr fks_impl<Key, Keys...> make_fks_impl() noexcept;
+        using fks_impl = fks_table<Key, key_pack<Key, Keys...>>;
+        
+        /**
+        * @brief constexpr factory: constructs an `fks_table` by value.
+        *
+        * @tparam Key      Unsigned integral key type.
+        * @tparam Provider Key provider; array order defines indices.
+        * @return A value-initialized `fks_table<Key, Provider>`.
+        */
+        template <typename Key, typename Provider>
+        constexpr fks_table<Key, Provider> make_fks_table() noexcept;
         
         /**
         * @brief Canonical singleton for a given key set.
         *
-        * @tparam Key Unsigned integral key type.
-        * @tparam Keys Distinct keys; pack order defines indices.
+        * @tparam Key      Unsigned integral key type.
+        * @tparam Provider Key provider; array order defines indices.
         *
         * @note `inline constexpr` variable template with static storage duration.
-        * @warning Internal - prefer using the facade `fks<Key>::instance<Keys...>()`.
+        * @warning Internal - prefer using the facade `fks<Key>::instance<...>()`.
         */
-        template <typename Key, Key... Keys>
-        inline constexpr auto fks_impl_singleton = make_fks_impl<Key, Keys...>();
+        template <typename Key, typename Provider>
+        inline constexpr auto fks_table_singleton = make_fks_table<Key, Provider>();
             
     } // namespace details
         
@@ -430,6 +419,25 @@ namespace etools::hashing {
         */
         template <KeyType... Keys>
         [[nodiscard]] static constexpr const details::fks_impl<KeyType, Keys...>& instance() noexcept;
+
+        /**
+        * @brief Obtain the canonical lookup instance for the keys of a key provider.
+        *
+        * The table is identified by `Provider` rather than by the key values, which keeps
+        * symbol names and compile times small for large key sets.
+        *
+        * @tparam Provider Type with `static constexpr std::array<KeyType, N> keys` of distinct
+        *                  keys; the array order defines dense indices `[0..N-1]`.
+        * @return `constexpr const details::fks_table<KeyType, Provider>&` to the singleton.
+        *
+        * ```cpp
+        * struct ids { static constexpr std::array<std::uint32_t, 3> keys{{10, 20, 30}}; };
+        * constexpr const auto& H = etools::hashing::fks<std::uint32_t>::instance<ids>();
+        * static_assert(H(20) == 1);
+        * ```
+        */
+        template <typename Provider>
+        [[nodiscard]] static constexpr const details::fks_table<KeyType, Provider>& instance() noexcept;
         
         /**
         * @brief Deleted default constructor - this facade is not meant to be instantiated.
@@ -20,44 +20,17 @@
 #include "fks.hpp"
 namespace etools::hashing {
     namespace details{
-        template <typename KeyType, std::size_t N, std::size_t BucketCount>
-        constexpr std::array<std::size_t, BucketCount> compute_bucket_counts(
-            const std::array<KeyType, N> &keys
-        ) noexcept {
-            std::array<std::size_t, BucketCount> counts{};
-            for (std::size_t i = 0; i < N; ++i) {
-                const std::size_t b = bucket_of<KeyType>(keys[i], BucketCount);
-                counts[b]++;
-            }
-            return counts;
-        }
-        
-        template <std::size_t BucketCount>
-        constexpr std::array<std::size_t, BucketCount + 1> offsets_from_counts(
-            const std::array<std::size_t, BucketCount> &counts
-        ) noexcept{
-            std::array<std::size_t, BucketCount + 1> off{};
-            off[0] = 0;
-            for (std::size_t b = 0; b < BucketCount; ++b) {
-                off[b + 1] = off[b] + counts[b];
-            }
-            return off;
+        template <typename KeyType, std::size_t N>
+        constexpr std::array<std::size_t, N> mix_keys(const std::array<KeyType, N>& keys) noexcept {
+            std::array<std::size_t, N> mixed{};
+            for (std::size_t i = 0; i < N; ++i) mixed[i] = mix_native(keys[i]);
+            return mixed;
         }
-        
-        template <typename KeyType, std::size_t N, std::size_t BucketCount>
-        constexpr std::array<std::size_t, N> items_csr(
-            const std::array<KeyType, N> &keys,
-            const std::array<std::size_t, BucketCount + 1> &off
-        ) noexcept
-        {
-            std::array<std::size_t, N> items{};
-            std::array<std::size_t, BucketCount> fill{};
-            for (std::size_t i = 0; i < N; ++i) {
-                const std::size_t b = bucket_of<KeyType>(keys[i], BucketCount);
-                const std::size_t pos = off[b] + (fill[b]++);
-                items[pos] = i;
-            }
-            return items;
+
+        template <std::size_t N, std::size_t BucketCount>
+        constexpr meta::bucket_partition<N, BucketCount> partition_keys(const std::array<std::size_t, N>& mixed) noexcept {
+            // Same bucket as bucket_of(key, BucketCount), without re-mixing.
+            return meta::counting_sort_by_bucket<BucketCount>(mixed, [](std::size_t m) { return m & (BucketCount - 1); });
         }
         
         template <std::size_t BucketCount>
@@ -72,56 +45,32 @@ namespace etools::hashing {
         }
         
         template <std::size_t BucketCount>
-        constexpr std::size_t total_slots_from_rbits(const std::array<std::uint8_t, BucketCount> &r) noexcept{
-            std::size_t T = 0;
-            for (std::size_t b = 0; b < BucketCount; ++b) {
-                T += (std::size_t{1} << r[b]);
-            }
-            return T;
-        }
-        
-        template <std::size_t BucketCount>
-        constexpr std::array<std::size_t, BucketCount> base_from_rbits(const std::array<std::uint8_t, BucketCount> &r) noexcept{
-            std::array<std::size_t, BucketCount> base{};
-            std::size_t acc = 0;
-            for (std::size_t b = 0; b < BucketCount; ++b) {
-                base[b] = acc;
-                acc += (std::size_t{1} << r[b]);
-            }
-            return base;
+        constexpr std::array<std::size_t, BucketCount + 1> slot_offsets_from_rbits(const std::array<std::uint8_t, BucketCount> &r) noexcept{
+            std::array<std::size_t, BucketCount> sizes{};
+            for (std::size_t b = 0; b < BucketCount; ++b) sizes[b] = std::size_t{1} << r[b];
+            return meta::exclusive_prefix_sum(sizes);
         }
 
-        template <typename Key, Key... Keys>
-        constexpr fks_impl<Key, Keys...> make_fks_impl() noexcept{
-            return fks_impl<Key, Keys...>{}; 
+        template <typename Key, typename Provider>
+        constexpr fks_table<Key, Provider> make_fks_table() noexcept{
+            return fks_table<Key, Provider>{}; 
         }
 
-        template <typename KeyType, KeyType... Keys>
-        constexpr fks_impl<KeyType, Keys...>::fks_impl() noexcept {
-            // Distinctness check (no static data members => no ODR headaches)
-            {
-                constexpr std::array<KeyType, size()> key_set{{ Keys... }};
-                static_assert(meta::all_distinct_fast(key_set), "FKS keys must be distinct");
-            }
+        template <typename KeyType, typename Provider>
+        constexpr fks_table<KeyType, Provider>::fks_table() noexcept {
+            // Distinctness check
+            static_assert(meta::all_distinct_fast(Provider::keys), "FKS keys must be distinct");
             
-            // 1) Pack and first-level counts
-            constexpr std::array<KeyType, size()> keys{ { Keys... } };
-            constexpr auto counts = compute_bucket_counts<KeyType, size(), buckets()>(keys);
-            constexpr auto offs = offsets_from_counts<buckets()>(counts);
+            // 1) Read the keys, mix once, group by first-level bucket
+            constexpr std::array<KeyType, size()> keys = Provider::keys;
+            constexpr auto mixed = mix_keys(keys);
+            constexpr auto part = partition_keys<size(), buckets()>(mixed);
             
             // 2) Second-level sizing and layout
-            constexpr auto rbits = compute_rbits<buckets()>(counts);
-            constexpr auto base = base_from_rbits<buckets()>(rbits);
-            
-            // 3) CSR of key indices grouped by bucket
-            constexpr auto items = items_csr<KeyType, size(), buckets()>(keys, offs);
+            constexpr auto rbits = compute_rbits<buckets()>(part.counts);
+            constexpr auto base = slot_offsets_from_rbits<buckets()>(rbits);
             
-            // 4) init metadata + membership
-            for (std::size_t b = 0; b < buckets(); ++b) {
-                _local_bits[b] = rbits[b];
-                _base_offset[b] = base[b];
-                _local_multiplier[b] = std::size_t{1}; // set per-bucket below
-            }
+            // 3) init membership
             for (std::size_t i = 0; i < size(); ++i) {
                 _keys_by_index[i] = keys[i];
             }
@@ -129,85 +78,94 @@ namespace etools::hashing {
                 _slot_to_index[i] = static_cast<index_t>(not_found()); // sentinel
             }
             
-            // 5) choose per-bucket odd multiplier a_b; place keys
+            // 4) per-bucket metadata; choose odd multiplier a_b and place keys
             std::array<std::size_t, size()> local{};
             for (std::size_t b = 0; b < buckets(); ++b) {
-                const std::size_t s = counts[b];
-                if (s == 0) { _local_multiplier[b] = std::size_t{1}; continue; }
+                _local_bits[b] = rbits[b];
+                _base_offset[b] = base[b];
+                _local_multiplier[b] = std::size_t{1};
+
+                const std::size_t s = part.counts[b];
+                if (s == 0) continue;
                 
                 const std::uint8_t r = rbits[b];
-                const std::size_t off = offs[b];
+                const std::size_t off = part.offsets[b];
                 const std::size_t b0 = base[b];
                 
                 std::size_t chosen = std::size_t{1};
                 for (std::size_t seed = 1;; ++seed) {
                     const std::size_t a = (mix_native(seed) | std::size_t{1}); // odd
-                    // candidate local positions
-                    for (std::size_t j = 0; j < s; ++j) {
-                        const std::size_t idx = items[off + j];
-                        const std::size_t m = mix_native(keys[idx]);
-                        local[j] = top_bits<std::size_t>(m * a, r);
-                    }
-                    // check distinct
+                    // candidate local positions; buckets of up to 8 keys (r <= 6)
+                    // detect collisions in a single-word bitmap as they are placed
                     bool ok = true;
-                    for (std::size_t i = 0; i < s && ok; ++i)
-                    for (std::size_t j = i + 1; j < s; ++j)
-                    if (local[i] == local[j]) { ok = false; break; }
+                    std::uint64_t seen = 0;
+                    for (std::size_t j = 0; j < s && ok; ++j) {
+                        local[j] = top_bits<std::size_t>(mixed[part.items[off + j]] * a, r);
+                        if (r <= 6) {
+                            const std::uint64_t bit = std::uint64_t{1} << local[j];
+                            ok = !(seen & bit);
+                            seen |= bit;
+                        }
+                    }
+                    if (r > 6)
+                        for (std::size_t i = 0; i < s && ok; ++i)
+                        for (std::size_t j = i + 1; j < s; ++j)
+                        if (local[i] == local[j]) { ok = false; break; }
                     if (ok) { chosen = a; break; }
                 }
                 
                 _local_multiplier[b] = chosen;
                 for (std::size_t j = 0; j < s; ++j) {
-                    const std::size_t idx = items[off + j];           // final dense index
+                    const std::size_t idx = part.items[off + j];      // final dense index
                     const std::size_t pos = b0 + local[j];            // global slot
                     _slot_to_index[pos] = static_cast<index_t>(idx);
                 }
             }
         }
         
-        template <typename KeyType, KeyType... Keys>
-        constexpr std::size_t fks_impl<KeyType, Keys...>::size() noexcept {
-            return sizeof...(Keys); 
+        template <typename KeyType, typename Provider>
+        constexpr std::size_t fks_table<KeyType, Provider>::size() noexcept {
+            return Provider::keys.size(); 
         }
         
-        template <typename KeyType, KeyType... Keys>
-        constexpr std::size_t fks_impl<KeyType, Keys...>::not_found() noexcept {
+        template <typename KeyType, typename Provider>
+        constexpr std::size_t fks_table<KeyType, Provider>::not_found() noexcept {
             return size(); 
         }
         
-        template <typename KeyType, KeyType... Keys>
-        constexpr std::size_t fks_impl<KeyType, Keys...>::buckets() noexcept{
+        template <typename KeyType, typename Provider>
+        constexpr std::size_t fks_table<KeyType, Provider>::buckets() noexcept{
             return ceil_pow2<std::size_t>(size() ? size() : 1);
         }
         
-        template <typename KeyType, KeyType... Keys>
-        constexpr std::size_t fks_impl<KeyType, Keys...>::capacity() noexcept {
-            constexpr std::array<KeyType, size()> keys{ { Keys... } };
-            constexpr auto counts = compute_bucket_counts<KeyType, size(), buckets()>(keys);
-            constexpr auto rbits = compute_rbits<buckets()>(counts);
-            return total_slots_from_rbits<buckets()>(rbits);
+        template <typename KeyType, typename Provider>
+        constexpr std::size_t fks_table<KeyType, Provider>::capacity() noexcept {
+            constexpr auto part = partition_keys<size(), buckets()>(mix_keys(Provider::keys));
+            constexpr auto rbits = compute_rbits<buckets()>(part.counts);
+            return slot_offsets_from_rbits<buckets()>(rbits)[buckets()];
         }
         
-        template <typename KeyType, KeyType... Keys>
+        template <typename KeyType, typename Provider>
         constexpr std::size_t
-        fks_impl<KeyType, Keys...>::local_pos(std::size_t b, KeyType key) const noexcept {
+        fks_table<KeyType, Provider>::local_pos(std::size_t b, KeyType key) const noexcept {
             const std::size_t r = _local_bits[b];
             const std::size_t a = _local_multiplier[b];
             const std::size_t mixed = mix_native<std::size_t>(static_cast<std::size_t>(key));
             return top_bits<std::size_t>(mixed * a, r);
         }
         
-        template <typename KeyType, KeyType... Keys>
+        template <typename KeyType, typename Provider>
         constexpr std::size_t
-        fks_impl<KeyType, Keys...>::operator()(KeyType key) const noexcept {
+        fks_table<KeyType, Provider>::operator()(KeyType key) const noexcept {
             const std::size_t mixed  = mix_native<std::size_t>(static_cast<std::size_t>(key));
             const std::size_t b = mixed & (buckets() - 1);
             const std::size_t base = _base_offset[b];
             const std::size_t pos = base + local_pos(b, key);
             const index_t v = _slot_to_index[pos];
-            if (v == static_cast<index_t>(size())) return size();   // empty slot
+            if (v == static_cast<index_t>(size()))                  // empty slot
+                return trace::lookup(size(), not_found(), key);
             const std::size_t i = static_cast<std::size_t>(v);
-            return (_keys_by_index[i] == key) ? i : size();         // membership guard
+            return trace::lookup((_keys_by_index[i] == key) ? i : size(), not_found(), key); // membership guard
         }
         
     } // namespace details;
@@ -215,7 +173,13 @@ namespace etools::hashing {
     template <typename KeyType>
     template <KeyType... Keys>
     constexpr const details::fks_impl<KeyType, Keys...>& fks<KeyType>::instance() noexcept {
-        return details::fks_impl_singleton<KeyType, Keys...>;
+        return details::fks_table_singleton<KeyType, key_pack<KeyType, Keys...>>;
+    }
+
+    template <typename KeyType>
+    template <typename Provider>
+    constexpr const details::fks_table<KeyType, Provider>& fks<KeyType>::instance() noexcept {
+        return details::fks_table_singleton<KeyType, Provider>;
     }
 } // namespace etools::hashing
 
@@ -16,7 +16,13 @@
 #ifndef ETOOLS_HASHING_HASHING_HPP_
 #define ETOOLS_HASHING_HASHING_HPP_
 #include "utils.hpp"
+#include "key_provider.hpp"
 #include "fks.hpp"
 #include "llut.hpp"
 #include "optimal_mph.hpp"
+#include "consistent.hpp"
+#include "hyperloglog.hpp"
+#include "count_min.hpp"
+#include "multi_set.hpp"
+#include "lpm.hpp"
 #endif // ETOOLS_HASHING_HASHING_HPP_
\ No newline at end of file
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file hyperloglog.hpp
+*
+* @brief Fixed-memory HyperLogLog cardinality sketch with lock-free updates and merges.
+*
+* @ingroup etools_hashing etools::hashing
+*
+* `hyperloglog<P>` estimates the number of distinct keys seen, using `2^P`
+* one-byte registers and no allocation. The standard error is about
+* `1.04 / sqrt(2^P)`: 1.6% at the default `P = 12` (4 KiB).
+*
+* ### Layout and concurrency
+* Registers are packed eight to a `std::atomic<std::uint64_t>` word in one
+* dense, cache-line aligned array. A register only ever grows, and after the
+* first few thousand keys it almost never does, so:
+*
+* - `update` is a relaxed load; a compare-exchange happens only when the
+*   register actually grows. Any number of threads may update the same sketch.
+* - `merge(other)` takes the per-byte maximum of eight registers at a time
+*   with SWAR arithmetic and publishes each word with a compare-exchange, so
+*   per-thread sketches can be folded into a shared one concurrently, without
+*   a lock, while other threads keep updating either side.
+*
+* ### Example
+* @code
+* #include "etools/hashing/hyperloglog.hpp"
+* using namespace etools::hashing;
+*
+* hyperloglog<> total;                    // shared
+* thread_local hyperloglog<> mine;        // per thread, no contention
+* mine.update(keys, count);
+* total.merge(mine);
+* double distinct = total.estimate();
+* @endcode
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_HASHING_HYPERLOGLOG_HPP_
+#define ETOOLS_HASHING_HYPERLOGLOG_HPP_
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "utils.hpp" // mix_u64
+
+namespace etools::hashing {
+
+    /**
+    * @class hyperloglog
+    *
+    * @brief HyperLogLog distinct-count sketch over 64-bit keys hashed with `mix_u64`.
+    *
+    * @tparam Precision Index bits `P`; `2^P` registers. Must be in `[4, 18]`.
+    */
+    template<std::uint8_t Precision = 12>
+    class hyperloglog {
+        static_assert(Precision >= 4 && Precision <= 18, "hyperloglog: Precision must be in [4, 18]");
+
+    public:
+        /// @brief Number of registers, `2^Precision`.
+        static constexpr std::size_t registers = std::size_t{1} << Precision;
+
+        /// @brief All registers zero: `estimate() == 0`.
+        hyperloglog() noexcept = default;
+
+        hyperloglog(const hyperloglog&) = delete;
+        hyperloglog& operator=(const hyperloglog&) = delete;
+
+        /// @brief Records `key`. Safe to call concurrently with any other member.
+        void update(std::uint64_t key) noexcept;
+
+        /// @brief Records `keys[0..count)`.
+        void update(const std::uint64_t* keys, std::size_t count) noexcept;
+
+        /**
+        * @brief Folds `other` into this sketch (register-wise maximum).
+        *
+        * Afterwards this sketch estimates the size of the union of both
+        * streams. Lock-free; safe to call concurrently from many threads.
+        */
+        void merge(const hyperloglog& other) noexcept;
+
+        /**
+        * @brief Estimated number of distinct keys recorded.
+        *
+        * Raw HyperLogLog estimate with linear counting below `2.5 * registers`.
+        * No large-range correction is needed with 64-bit hashes.
+        */
+        [[nodiscard]] double estimate() const noexcept;
+
+        /// @brief Value of register `i` (number of leading zeros + 1 of the best hash seen).
+        [[nodiscard]] std::uint8_t reg(std::size_t i) const noexcept;
+
+        /// @brief Resets every register to zero.
+        void clear() noexcept;
+
+    private:
+        static constexpr std::size_t words = registers / 8;
+
+        alignas(64) std::array<std::atomic<std::uint64_t>, words> _words{};
+    };
+
+} // namespace etools::hashing
+
+#include "hyperloglog.tpp"
+#endif // ETOOLS_HASHING_HYPERLOGLOG_HPP_
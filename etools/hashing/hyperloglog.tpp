@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file hyperloglog.tpp
+*
+* @brief Definition of hyperloglog.hpp methods.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_HASHING_HYPERLOGLOG_TPP_
+#define ETOOLS_HASHING_HYPERLOGLOG_TPP_
+#include "hyperloglog.hpp"
+#include <cassert>
+#include <cmath>
+
+namespace etools::hashing::details {
+
+    /// @brief Count of leading zero bits of a non-zero 64-bit value.
+    constexpr std::uint8_t hll_clz(std::uint64_t x) noexcept {
+    #if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::uint8_t>(__builtin_clzll(x));
+    #else
+        std::uint8_t n = 0;
+        while (!(x & (std::uint64_t{1} << 63))) { x <<= 1; ++n; }
+        return n;
+    #endif
+    }
+
+    /**
+    * @brief Byte-wise maximum of two words whose bytes are all below 0x80 (SWAR).
+    *
+    * `(a | H) - b` cannot borrow across bytes, and leaves the high bit of a
+    * byte set exactly where `a >= b`.
+    */
+    constexpr std::uint64_t hll_max_bytes(std::uint64_t a, std::uint64_t b) noexcept {
+        constexpr std::uint64_t high = 0x8080808080808080ULL;
+        const std::uint64_t ge = ((a | high) - b) & high;
+        const std::uint64_t mask = (ge >> 7) * 0xFFu;
+        return (a & mask) | (b & ~mask);
+    }
+
+    /// @brief `alpha_m` bias constant of the raw HyperLogLog estimator.
+    constexpr double hll_alpha(std::size_t m) noexcept {
+        return m == 16 ? 0.673
+             : m == 32 ? 0.697
+             : m == 64 ? 0.709
+             : 0.7213 / (1.0 + 1.079 / static_cast<double>(m));
+    }
+
+} // namespace etools::hashing::details
+
+namespace etools::hashing {
+
+    template<std::uint8_t Precision>
+    inline void hyperloglog<Precision>::update(std::uint64_t key) noexcept {
+        const std::uint64_t h = mix_u64(key);
+        const std::size_t idx = static_cast<std::size_t>(h >> (64 - Precision));
+        const std::uint64_t rest = h << Precision;
+        const std::uint64_t rho = rest ? details::hll_clz(rest) + 1u : 64u - Precision + 1u;
+
+        std::atomic<std::uint64_t>& word = _words[idx / 8];
+        const unsigned shift = static_cast<unsigned>(idx % 8) * 8;
+        std::uint64_t cur = word.load(std::memory_order_relaxed);
+        while (((cur >> shift) & 0xFFu) < rho) {
+            const std::uint64_t next = (cur & ~(std::uint64_t{0xFF} << shift)) | (rho << shift);
+            if (word.compare_exchange_weak(cur, next, std::memory_order_relaxed)) break;
+        }
+    }
+
+    template<std::uint8_t Precision>
+    void hyperloglog<Precision>::update(const std::uint64_t* keys, std::size_t count) noexcept {
+        for (std::size_t i = 0; i < count; ++i) update(keys[i]);
+    }
+
+    template<std::uint8_t Precision>
+    void hyperloglog<Precision>::merge(const hyperloglog& other) noexcept {
+        for (std::size_t w = 0; w < words; ++w) {
+            const std::uint64_t theirs = other._words[w].load(std::memory_order_relaxed);
+            if (!theirs) continue;
+            std::uint64_t cur = _words[w].load(std::memory_order_relaxed);
+            for (;;) {
+                const std::uint64_t next = details::hll_max_bytes(cur, theirs);
+                if (next == cur || _words[w].compare_exchange_weak(cur, next, std::memory_order_relaxed)) break;
+            }
+        }
+    }
+
+    template<std::uint8_t Precision>
+    double hyperloglog<Precision>::estimate() const noexcept {
+        double sum = 0.0;
+        std::size_t zeros = 0;
+        for (std::size_t w = 0; w < words; ++w) {
+            const std::uint64_t v = _words[w].load(std::memory_order_relaxed);
+            for (unsigned b = 0; b < 64; b += 8) {
+                const unsigned r = static_cast<unsigned>((v >> b) & 0xFFu);
+                sum += std::ldexp(1.0, -static_cast<int>(r));
+                zeros += r == 0;
+            }
+        }
+        constexpr double m = static_cast<double>(registers);
+        const double raw = details::hll_alpha(registers) * m * m / sum;
+        if (raw <= 2.5 * m && zeros != 0) return m * std::log(m / static_cast<double>(zeros));
+        return raw;
+    }
+
+    template<std::uint8_t Precision>
+    std::uint8_t hyperloglog<Precision>::reg(std::size_t i) const noexcept {
+        assert(i < registers && "hyperloglog::reg(): register index out of range");
+        return static_cast<std::uint8_t>(_words[i / 8].load(std::memory_order_relaxed) >> (i % 8 * 8));
+    }
+
+    template<std::uint8_t Precision>
+    void hyperloglog<Precision>::clear() noexcept {
+        for (auto& w : _words) w.store(0, std::memory_order_relaxed);
+    }
+
+} // namespace etools::hashing
+
+#endif // ETOOLS_HASHING_HYPERLOGLOG_TPP_
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file key_provider.hpp
+*
+* @brief Key-provider types: compile-time key sets named by a type instead of an NTTP pack.
+*
+* @ingroup etools_hashing etools::hashing
+*
+* @details
+* The compile-time tables (`llut`, `fks`, `optimal_mph`, `multi_set`) accept
+* their keys either as an NTTP pack or as a *key provider*: any type with
+*
+* @code
+* static constexpr std::array<Key, N> keys;
+* @endcode
+*
+* A table built from a provider is identified by the provider type alone, so
+* a set of thousands of keys gets an ordinary, short mangled name and every
+* translation unit that names it stays cheap to compile. The keys can come
+* from anywhere a constant expression can reach: a literal, a generated
+* header, or a `constexpr` function.
+*
+* `key_pack<Key, Keys...>` is the provider the pack overloads use internally.
+*
+* **Example**
+* @code
+* #include "etools/hashing/key_provider.hpp"
+*
+* struct opcodes {
+*     static constexpr std::array<std::uint32_t, 3> keys{{0x10, 0x2A, 0x7F}};
+* };
+* static_assert(etools::hashing::is_key_provider_v<opcodes, std::uint32_t>);
+* @endcode
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_HASHING_KEY_PROVIDER_HPP_
+#define ETOOLS_HASHING_KEY_PROVIDER_HPP_
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace etools::hashing {
+
+    /**
+    * @brief Key provider holding an NTTP pack.
+    *
+    * @tparam KeyType Key type.
+    * @tparam Keys    The keys, in pack order.
+    */
+    template <typename KeyType, KeyType... Keys>
+    struct key_pack {
+        /// @brief The keys, in pack order.
+        static constexpr std::array<KeyType, sizeof...(Keys)> keys{{Keys...}};
+    };
+
+    /**
+    * @brief Whether `Provider` exposes `static constexpr std::array<KeyType, N> keys`.
+    *
+    * @tparam Provider Candidate provider type.
+    * @tparam KeyType  Expected key type.
+    */
+    template <typename Provider, typename KeyType, typename = void>
+    struct is_key_provider : std::false_type {};
+
+    /// @cond INTERNAL
+    template <typename Provider, typename KeyType>
+    struct is_key_provider<Provider, KeyType,
+        std::enable_if_t<std::is_same_v<std::remove_cv_t<decltype(Provider::keys)>,
+                                        std::array<KeyType, std::tuple_size<std::remove_cv_t<decltype(Provider::keys)>>::value>>>>
+        : std::true_type {};
+    /// @endcond
+
+    /// @brief Shorthand for `is_key_provider<Provider, KeyType>::value`.
+    template <typename Provider, typename KeyType>
+    inline constexpr bool is_key_provider_v = is_key_provider<Provider, KeyType>::value;
+
+} // namespace etools::hashing
+
+#endif // ETOOLS_HASHING_KEY_PROVIDER_HPP_
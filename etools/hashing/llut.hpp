@@ -12,12 +12,14 @@
 * of integral/enum-like keys into dense indices `[0..N-1]` without hashing or branching.
 *
 * #### Components
-* - `etools::hashing::details::llut_impl<Key, Keys...>` - the immutable, constexpr-constructible
+* - `etools::hashing::details::llut_table<Key, Provider>` - the immutable, constexpr-constructible
 *   implementation type. It owns a direct-indexed `std::array` of length `max(Keys) + 1`.
-*   Present keys map to their dense indices (defined by pack order), and holes store a
-*   sentinel equal to `N = sizeof...(Keys)`.
+*   Present keys map to their dense indices (defined by key order), and holes store a
+*   sentinel equal to `N`, the number of keys. `llut_impl<Key, Keys...>` names the table
+*   of an NTTP pack.
 * - `etools::hashing::llut<Key>` - a thin facade that returns a reference to a canonical
-*   `inline constexpr` singleton `llut_impl<Key, Keys...>` via `generate<Keys...>()`.
+*   `inline constexpr` singleton via `instance<Keys...>()`, or `instance<Provider>()` for a
+*   key provider (see `key_provider.hpp`).
 *
 * #### Design notes
 * - All structure/lookup properties are exposed as `static constexpr` members:
@@ -29,7 +31,7 @@
 *   is uniform across backends.
 * - The singleton is defined as a **namespace-scope `inline constexpr` variable template**,
 *   so it has static storage duration and is usable in constant evaluation. Calls to
-*   `llut<Key>::generate<Keys...>()` return a `constexpr const&` to this object.
+*   `llut<Key>::instance<...>()` return a `constexpr const&` to this object.
 *
 * Example:
 * ```cpp
@@ -52,7 +54,6 @@
 *
 * dependencies
 * This file expects:
-* - `meta::tpack_max<Key, Keys...>()` returning the maximum of `Keys...` at compile time.
 * - `meta::smallest_uint_t<N>` - smallest unsigned type that can represent `[0..N]`.
 * - `meta::all_distinct_fast(std::array<Key, N>)` for O(N) pairwise distinctness checking.
 */
@@ -61,11 +62,12 @@
 
 #include <array>
 #include <cstddef>
-#include <initializer_list>
 #include <type_traits>
 
 #include "../meta/utility.hpp" // meta::all_distinct(...)
-#include "../meta/traits.hpp"  // smallest_uint_t<...>, meta::tpack_max<...>
+#include "../meta/traits.hpp"  // smallest_uint_t<...>
+#include "../trace/hooks.hpp"  // trace::lookup
+#include "key_provider.hpp"    // key_pack, is_key_provider_v
 
 namespace etools::hashing {
     // facade (forward)
@@ -82,25 +84,26 @@ namespace etools::hashing {
         /**
         * @brief Forward declaration of implementation.
         */
-        template <typename Key, Key... Keys>
-        class llut_impl;
+        template <typename Key, typename Provider>
+        class llut_table;
             
         /**
         * @brief Forward declaration of factory.
         */
-        template <typename Key, Key... Keys>
-        constexpr llut_impl<Key, Keys...> make_llut_impl() noexcept;
+        template <typename Key, typename Provider>
+        constexpr llut_table<Key, Provider> make_llut_table() noexcept;
 
         /**
-        * @class llut_impl
+        * @class llut_table
         *
-        * @tparam KeyType Unsigned integral key type (e.g., `uint8_t`, `uint16_t`, `uint32_t`).
-        * @tparam Keys Parameter pack of **distinct** key values. Pack order defines indices.
+        * @tparam KeyType  Unsigned integral key type (e.g., `uint8_t`, `uint16_t`, `uint32_t`).
+        * @tparam Provider Key provider: `static constexpr std::array<KeyType, N> keys` of
+        *                  **distinct** key values. Array order defines indices.
         *
-        * @brief Immutable, constexpr-constructible direct table mapping `Keys...` to indices.
+        * @brief Immutable, constexpr-constructible direct table mapping the provider's keys to indices.
         *
         * The backing array length is `capacity() == max(Keys) + 1`. Each present key maps
-        * to its index in `[0..size()-1]`, where `size() == sizeof...(Keys)`. Holes are
+        * to its index in `[0..size()-1]`, where `size() == N`. Holes are
         * filled with the sentinel `not_found()` == `size()`.
         *
         * Invariants:
@@ -113,18 +116,18 @@ namespace etools::hashing {
         *
         * @note Lookup: `O(1)`.
         *
-        * @warning When `max(Keys...)` is significantly larger then `sizeof...(Keys)` it
+        * @warning When `max(Keys)` is significantly larger then the number of keys it
         * is heavily advised to prefer `fks` generator.
         */
-        template<typename KeyType, KeyType... Keys>
-        class llut_impl{
+        template<typename KeyType, typename Provider>
+        class llut_table{
 
             /**
             * @typedef index_t
             *
             * @brief Index storage type (smallest unsigned that can represent `[0..size()]`).
             */
-            using index_t = meta::smallest_uint_t<sizeof...(Keys)>;
+            using index_t = meta::smallest_uint_t<Provider::keys.size()>;
         public:
 
             /**
@@ -133,7 +136,7 @@ namespace etools::hashing {
             * Cross-backend contract: matches `fks::size()`. Use this rather than
             * `capacity()` when iterating dense indices `[0..size())`.
             *
-            * @return Number of keys `N = sizeof...(Keys)`.
+            * @return Number of keys `N`.
             */
             [[nodiscard]] static constexpr std::size_t size() noexcept;
 
@@ -166,27 +169,27 @@ namespace etools::hashing {
             [[nodiscard]] constexpr std::size_t operator()(KeyType key) const noexcept;
 
             /** @brief Deleted copy constructor. */
-            llut_impl(const llut_impl&) = delete;
+            llut_table(const llut_table&) = delete;
             /** @brief Deleted copy assignment.  */
-            llut_impl& operator=(const llut_impl&) = delete;
+            llut_table& operator=(const llut_table&) = delete;
             /** @brief Deleted move constructor. */
-            llut_impl(llut_impl&&) = delete;
+            llut_table(llut_table&&) = delete;
             /** @brief Deleted move assignment.  */
-            llut_impl& operator=(llut_impl&&) = delete;
+            llut_table& operator=(llut_table&&) = delete;
 
         private:
             
             /**
             * @brief Private default constructor; builds the table at compile time.
             */
-            constexpr llut_impl() noexcept;
+            constexpr llut_table() noexcept;
             
             /**
             * @brief Construct the backing array in pure `constexpr` fashion.
             *
             * - Initializes all slots to `not_found()`.
             *
-            * - Assigns indices in the order of `Keys...` using LTR guaranteed evaluation.
+            * - Assigns indices in the order of `Provider::keys`.
             *
             * @return Fully populated `std::array<index_t, capacity()>`.
             */
@@ -195,8 +198,8 @@ namespace etools::hashing {
             /**
             * @brief Friend factory allowed to invoke the private constructor.
             */
-            template <typename K, K... Ks>
-            friend constexpr llut_impl<K, Ks...> make_llut_impl() noexcept;
+            template <typename K, typename P>
+            friend constexpr llut_table<K, P> make_llut_table() noexcept;
 
             /**
             * @brief Backing direct-index table (`[0..capacity()-1]`), filled with dense indices or sentinel.
@@ -204,34 +207,45 @@ namespace etools::hashing {
             std::array<index_t, capacity()> _table;
 
             static_assert(std::is_unsigned_v<KeyType>, "KeyType must be unsigned integral type");
+            static_assert(is_key_provider_v<Provider, KeyType>,
+                "Provider must expose static constexpr std::array<KeyType, N> keys");
             static_assert(size() > 0, "Number of keys must exceed 0");
         };
 
         /**
-        * @brief Factory that constructs `llut_impl` by value in a `constexpr` way.
+        * @brief LLUT of an NTTP key pack.
         *
-        * @return A value-initialized `llut_impl<Key, Keys...>`.
+        * @tparam Key  Unsigned integral key type.
+        * @tparam Keys Distinct keys; pack order defines indices.
         */
         template <typename Key, Key... Keys>
-        [[nodiscard]] constexpr llut_impl<Key, Keys...> make_llut_impl() noexcept;
+        using llut_impl = llut_table<Key, key_pack<Key, Keys...>>;
+
+        /**
+        * @brief Factory that constructs `llut_table` by value in a `constexpr` way.
+        *
+        * @return A value-initialized `llut_table<Key, Provider>`.
+        */
+        template <typename Key, typename Provider>
+        [[nodiscard]] constexpr llut_table<Key, Provider> make_llut_table() noexcept;
         
         /**
-        * @brief Canonical singleton: one `inline constexpr` instance per `<Key, Keys...>` in the program.
+        * @brief Canonical singleton: one `inline constexpr` instance per `<Key, Provider>` in the program.
         *
         * This variable template has static storage duration and is ODR-merged across TUs.
-        * It is usable in constant evaluation. The facade `llut<Key>::generate<Keys...>()`
+        * It is usable in constant evaluation. The facade `llut<Key>::instance<...>()`
         * returns a `constexpr const&` to this object.
         */
-        template <typename Key, Key... Keys>
-        inline constexpr auto llut_impl_singleton = make_llut_impl<Key, Keys...>();
+        template <typename Key, typename Provider>
+        inline constexpr auto llut_table_singleton = make_llut_table<Key, Provider>();
         
     } // namespace details
 
     /**
     * @class llut
     *
-    * @brief Thin facade that returns the canonical `llut_impl<KeyType, Keys...>` instance by const reference
-    * via its `generate` method.
+    * @brief Thin facade that returns the canonical `llut_table` instance by const reference
+    * via its `instance` methods.
     * 
     * @tparam KeyType Unsigned integral key type..
     */
@@ -246,6 +260,19 @@ namespace etools::hashing {
         template<KeyType... Keys>
         [[nodiscard]] static constexpr const details::llut_impl<KeyType, Keys...>& instance() noexcept;
 
+        /**
+        * @brief Obtain the canonical table for the keys of a key provider.
+        *
+        * The table is identified by `Provider` rather than by the key values, which keeps
+        * symbol names and compile times small for large key sets.
+        *
+        * @tparam Provider Type with `static constexpr std::array<KeyType, N> keys` of distinct
+        *                  keys; array order defines dense indices.
+        * @return `constexpr const details::llut_table<KeyType, Provider>&` reference to the singleton.
+        */
+        template<typename Provider>
+        [[nodiscard]] static constexpr const details::llut_table<KeyType, Provider>& instance() noexcept;
+
         /**
         * @brief Deleted default constructor - this facade is not meant to be instantiated.
         */
@@ -18,52 +18,52 @@
 #include "llut.hpp"
 namespace etools::hashing{
     namespace details{
-        template <typename KeyType, KeyType... Keys>
-        constexpr std::size_t llut_impl<KeyType, Keys...>::size() noexcept{
-            return sizeof...(Keys);
+        template <typename KeyType, typename Provider>
+        constexpr std::size_t llut_table<KeyType, Provider>::size() noexcept{
+            return Provider::keys.size();
         }
 
-        template <typename KeyType, KeyType... Keys>
-        constexpr std::size_t llut_impl<KeyType, Keys...>::not_found() noexcept{
+        template <typename KeyType, typename Provider>
+        constexpr std::size_t llut_table<KeyType, Provider>::not_found() noexcept{
             return size();
         }
 
-        template <typename KeyType, KeyType... Keys>
-        constexpr std::size_t llut_impl<KeyType, Keys...>::capacity() noexcept{
-            return meta::tpack_max<KeyType, Keys...>() + 1;
+        template <typename KeyType, typename Provider>
+        constexpr std::size_t llut_table<KeyType, Provider>::capacity() noexcept{
+            std::size_t max_key = 0;
+            for (KeyType k : Provider::keys) if (static_cast<std::size_t>(k) > max_key) max_key = static_cast<std::size_t>(k);
+            return max_key + 1;
         }
 
-        template <typename KeyType, KeyType... Keys>
-        constexpr std::size_t llut_impl<KeyType, Keys...>::operator()(KeyType key) const noexcept{
+        template <typename KeyType, typename Provider>
+        constexpr std::size_t llut_table<KeyType, Provider>::operator()(KeyType key) const noexcept{
             const std::size_t k = static_cast<std::size_t>(key);
-            if (k >= capacity()) return not_found();
+            if (k >= capacity()) return trace::lookup(not_found(), not_found(), key);
             const index_t v = _table[k];
-            return (v == static_cast<index_t>(size())) ? not_found() : static_cast<std::size_t>(v);
+            return trace::lookup((v == static_cast<index_t>(size())) ? not_found() : static_cast<std::size_t>(v),
+                                 not_found(), key);
         }
 
-        template <typename KeyType, KeyType... Keys>
-        constexpr llut_impl<KeyType, Keys...>::llut_impl() noexcept
+        template <typename KeyType, typename Provider>
+        constexpr llut_table<KeyType, Provider>::llut_table() noexcept
             : _table{make_table()}
         {
         }
 
-        template <typename KeyType, KeyType... Keys>
-        constexpr auto llut_impl<KeyType, Keys...>::make_table() noexcept -> std::array<index_t, capacity()>{
-            constexpr std::array<KeyType, size()> klist{{ Keys... }};
-            static_assert(meta::all_distinct_fast(klist), "Keys must be distinct");
+        template <typename KeyType, typename Provider>
+        constexpr auto llut_table<KeyType, Provider>::make_table() noexcept -> std::array<index_t, capacity()>{
+            static_assert(meta::all_distinct_fast(Provider::keys), "Keys must be distinct");
             std::array<index_t, capacity()> table{};
             for (std::size_t i = 0; i < capacity(); i++) table[i] = static_cast<index_t>(not_found());
-            std::size_t idx = 0;
-            (void)std::initializer_list<int>{
-                (table[static_cast<std::size_t>(Keys)] = static_cast<index_t>(idx++), 0)...
-            };
+            for (std::size_t idx = 0; idx < size(); ++idx)
+                table[static_cast<std::size_t>(Provider::keys[idx])] = static_cast<index_t>(idx);
             return table;
         }
 
-        template <typename Key, Key... Keys>
-        constexpr llut_impl<Key, Keys...> make_llut_impl() noexcept
+        template <typename Key, typename Provider>
+        constexpr llut_table<Key, Provider> make_llut_table() noexcept
         {
-            return llut_impl<Key, Keys...>{};
+            return llut_table<Key, Provider>{};
         }
 
     }
@@ -71,7 +71,14 @@ namespace etools::hashing{
     template<KeyType... Keys>
     constexpr const details::llut_impl<KeyType, Keys...>& llut<KeyType>::instance() noexcept
     {
-        return details::llut_impl_singleton<KeyType, Keys...>;
+        return details::llut_table_singleton<KeyType, key_pack<KeyType, Keys...>>;
+    }
+
+    template<typename KeyType>
+    template<typename Provider>
+    constexpr const details::llut_table<KeyType, Provider>& llut<KeyType>::instance() noexcept
+    {
+        return details::llut_table_singleton<KeyType, Provider>;
     }
 }
 #endif // ETOOLS_HASHING_LLUT_TPP_
\ No newline at end of file
@@ -0,0 +1,256 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file lpm.hpp
+*
+* @brief Static longest-prefix match: a binary search over prefix lengths, one
+*        perfect hash per populated length.
+*
+* @ingroup etools_hashing etools::hashing
+*
+* @details
+* A routing table maps a key (an address) to the route with the longest prefix
+* matching it. A binary trie walks one node per bit, up to `W` dependent
+* pointer loads for `W`-bit keys. `lpm_table` follows Waldvogel et al.
+* ("Scalable High Speed IP Routing Lookups", 1997) instead: keep one exact
+* hash table per populated prefix length and binary-search over the lengths,
+* for `O(log W)` hash probes per lookup.
+*
+* **Markers**
+* A binary search only works if a hit at length `l` means "a longer match may
+* exist" and a miss means "none does". Every route therefore leaves a *marker*
+* (its own prefix cut to `l`) at each length `l` the search visits before it
+* reaches the route's length and turns right. Each marker carries its *best
+* matching prefix* (bmp), the route of the longest real prefix not longer than
+* the marker, so a search that follows a marker and then fails still knows its
+* answer without backtracking. Markers cost at most `floor(log2(L))` extra
+* entries per route for `L` populated lengths.
+*
+* **Layout**
+* - Every populated length owns a hash-and-displace region, like
+*   `multi_set_table`: the mixed prefix picks a bucket by its low bits, the
+*   bucket's odd multiplier `a` picks a slot by the top bits of
+*   `(mixed ^ a) * a` (the XOR keeps a zero prefix from sticking to slot 0).
+* - Slots hold the entries themselves, `{prefix, route, length}`, so a probe
+*   is one multiplier load and one slot load; the prefix and length verify it.
+* - The tables are read-only after construction and share two flat arrays,
+*   so a lookup touches no pointers.
+*
+* **Builders**
+* - `lpm_table<Key, MaxRoutes>{routes, n}` - from any route array, in a
+*   constant expression or at run time. The entries are sorted and marked in
+*   the slot array itself; placement keeps a `capacity() / 8`-byte occupancy
+*   bitmap on the stack.
+* - `make_lpm_table(std::array<lpm_route<Key>, N>)` - deduces `MaxRoutes = N`.
+*
+* **Example**
+* @code
+* #include "etools/hashing/lpm.hpp"
+* using route = etools::hashing::lpm_route<std::uint32_t>;
+*
+* constexpr auto fib = etools::hashing::make_lpm_table(std::array<route, 3>{{
+*     {0x00000000u, 0},     // 0: default
+*     {0x0A000000u, 8},     // 1: 10.0.0.0/8
+*     {0x0A010000u, 16},    // 2: 10.1.0.0/16
+* }});
+* static_assert(fib(0x0A010203u) == 2);
+* static_assert(fib(0x0A020304u) == 1);
+* static_assert(fib(0xC0A80001u) == 0);
+* @endcode
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_HASHING_LPM_HPP_
+#define ETOOLS_HASHING_LPM_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "utils.hpp"              // mix_native, top_bits, ceil_pow2, ceil_log2, bit_width
+#include "../meta/algorithm.hpp"  // meta::sort_array, meta::lower_bound_index
+#include "../meta/traits.hpp"     // meta::smallest_uint_t
+#include "../trace/hooks.hpp"     // trace::lookup
+
+namespace etools::hashing {
+
+    /**
+    * @brief One route: the top `length` bits of `prefix`, most significant bit first.
+    *
+    * @tparam KeyType Unsigned integral key type.
+    *
+    * Bits of `prefix` below the prefix length are ignored.
+    */
+    template <typename KeyType>
+    struct lpm_route {
+        KeyType prefix{};          ///< Prefix bits, left-aligned.
+        std::uint8_t length = 0;   ///< Prefix length in `[0, digits(KeyType)]`; `0` matches every key.
+    };
+
+    /**
+    * @brief Worst-case stored entries (routes and markers) per route for `KeyType`.
+    *
+    * The search over at most `digits + 1` lengths visits at most
+    * `bit_width(digits + 1)` of them; all but the last may need a marker.
+    */
+    template <typename KeyType>
+    [[nodiscard]] constexpr std::size_t lpm_entries_per_route() noexcept {
+        return bit_width<std::size_t>(static_cast<std::size_t>(std::numeric_limits<KeyType>::digits) + 1);
+    }
+
+    /**
+    * @brief Static longest-prefix-match table.
+    *
+    * @tparam KeyType    Unsigned integral key type.
+    * @tparam MaxRoutes  Maximum number of routes; also the `not_found()` value.
+    * @tparam MaxEntries Maximum number of stored entries, routes plus markers.
+    *                    The default covers any route set.
+    */
+    template <typename KeyType, std::size_t MaxRoutes,
+              std::size_t MaxEntries = MaxRoutes * lpm_entries_per_route<KeyType>()>
+    class lpm_table {
+        static_assert(std::is_unsigned_v<KeyType>, "KeyType must be unsigned integral");
+        static_assert(MaxRoutes >= 1, "lpm_table: MaxRoutes must be at least 1");
+        static_assert(MaxEntries >= MaxRoutes, "lpm_table: MaxEntries must cover MaxRoutes");
+
+    public:
+        /// @brief Key type.
+        using key_type = KeyType;
+
+        /// @brief Route type.
+        using route_type = lpm_route<KeyType>;
+
+        /**
+        * @brief Builds the table from `n` routes.
+        *
+        * If several routes share a prefix and length, the first one wins.
+        *
+        * @param[in] routes Route array; route `i` is reported as index `i`.
+        * @param[in] n      Number of routes.
+        * @pre `n <= MaxRoutes` and every length is at most `digits(KeyType)`
+        *      (asserted; offending routes are dropped).
+        */
+        constexpr lpm_table(const route_type* routes, std::size_t n) noexcept;
+
+        /**
+        * @brief Builds the table from a full route array.
+        *
+        * @param[in] routes `MaxRoutes` routes.
+        */
+        constexpr explicit lpm_table(const std::array<route_type, MaxRoutes>& routes) noexcept;
+
+        /**
+        * @brief Longest-prefix match.
+        *
+        * @param[in] key Query key.
+        * @return Index of the longest route matching `key`, or `not_found()`.
+        */
+        [[nodiscard]] constexpr std::size_t operator()(KeyType key) const noexcept;
+
+        /// @brief Distinct routes stored.
+        [[nodiscard]] constexpr std::size_t size() const noexcept;
+
+        /// @brief Stored entries, routes plus markers.
+        [[nodiscard]] constexpr std::size_t entries() const noexcept;
+
+        /// @brief Populated prefix lengths; a lookup makes at most `bit_width(lengths())` probes.
+        [[nodiscard]] constexpr std::size_t lengths() const noexcept;
+
+        /// @brief Sentinel index (`MaxRoutes`) returned when no route matches.
+        [[nodiscard]] static constexpr std::size_t not_found() noexcept;
+
+        /// @brief Slots available to the per-length tables.
+        [[nodiscard]] static constexpr std::size_t capacity() noexcept;
+
+    private:
+        static constexpr std::size_t key_bits = static_cast<std::size_t>(std::numeric_limits<KeyType>::digits);
+
+        using route_t = meta::smallest_uint_t<MaxRoutes>;
+
+        /// @brief A route or a marker; markers carry their bmp in `route`.
+        struct entry {
+            KeyType prefix{};
+            route_t route{};
+            std::uint8_t length = 0;
+        };
+
+        /// @brief One populated length and its hash region.
+        struct level {
+            KeyType mask{};               ///< Top `length` bits set.
+            std::size_t slot_base = 0;
+            std::size_t bucket_base = 0;
+            std::size_t bucket_mask = 0;
+            std::uint8_t slot_bits = 0;
+            std::uint8_t length = 0;
+        };
+
+        /// @brief Length marking empty slots; sorts after every real length.
+        static constexpr std::uint8_t unused = 0xFF;
+
+        /// @brief Multipliers tried per bucket before the build gives up on it (asserted).
+        static constexpr std::size_t max_seeds = std::size_t{1} << 16;
+
+        /// @brief Bound on the summed bucket counts of all levels.
+        static constexpr std::size_t bucket_capacity() noexcept;
+
+        /// @brief Mask with the top `length` bits of `KeyType` set.
+        [[nodiscard]] static constexpr KeyType mask_of(std::size_t length) noexcept;
+
+        /// @brief Mixed value of a prefix.
+        [[nodiscard]] static constexpr std::size_t mix_prefix(KeyType prefix) noexcept;
+
+        /// @brief Global bucket of an already mixed prefix at level `lv`.
+        [[nodiscard]] static constexpr std::size_t bucket_of(const level& lv, std::size_t mixed) noexcept;
+
+        /// @brief Global slot of an already mixed prefix at level `lv` under multiplier `a`.
+        [[nodiscard]] static constexpr std::size_t slot_of(const level& lv, std::size_t mixed, std::size_t a) noexcept;
+
+        /// @brief Empties `_slots[from, capacity())`.
+        constexpr void clear_tail(std::size_t from) noexcept;
+
+        /// @brief Sorts entries by `(length, prefix, route)` and keeps the first of each `(length, prefix)`.
+        constexpr void sort_unique() noexcept;
+
+        /// @brief Adds the markers the binary search needs for every route.
+        constexpr void add_markers() noexcept;
+
+        /// @brief Sets each marker's route to its best matching prefix.
+        constexpr void resolve_markers() noexcept;
+
+        /// @brief Sizes the per-length regions and places every entry.
+        constexpr void build_levels() noexcept;
+
+        /// @brief Populated lengths in ascending order.
+        std::array<level, key_bits + 1> _levels{};
+
+        /// @brief Per-bucket odd multipliers, all levels.
+        std::array<std::size_t, bucket_capacity()> _multiplier{};
+
+        /// @brief The per-length tables; during construction, the sorted entries in `[0, _entry_count)`.
+        std::array<entry, capacity()> _slots{};
+
+        std::size_t _size = 0;
+        std::size_t _entry_count = 0;
+        std::size_t _level_count = 0;
+    };
+
+    /**
+    * @brief Builds an `lpm_table` sized for exactly `N` routes.
+    *
+    * @param[in] routes Routes; route `i` is reported as index `i`.
+    */
+    template <typename KeyType, std::size_t N>
+    [[nodiscard]] constexpr lpm_table<KeyType, N> make_lpm_table(const std::array<lpm_route<KeyType>, N>& routes) noexcept;
+
+} // namespace etools::hashing
+
+#include "lpm.tpp"
+#endif // ETOOLS_HASHING_LPM_HPP_
@@ -0,0 +1,301 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file lpm.tpp
+*
+* @brief Definition of lpm.hpp methods.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_HASHING_LPM_TPP_
+#define ETOOLS_HASHING_LPM_TPP_
+#include "lpm.hpp"
+#include <cassert>
+
+namespace etools::hashing {
+
+    template <typename KeyType, std::size_t MaxRoutes, std::size_t MaxEntries>
+    constexpr std::size_t lpm_table<KeyType, MaxRoutes, MaxEntries>::not_found() noexcept {
+        return MaxRoutes;
+    }
+
+    template <typename KeyType, std::size_t MaxRoutes, std::size_t MaxEntries>
+    constexpr std::size_t lpm_table<KeyType, MaxRoutes, MaxEntries>::capacity() noexcept {
+        // ceil_pow2(c + c/4 + 1) <= 2c + c/2 + 1 per populated length.
+        return 2 * MaxEntries + MaxEntries / 2 + key_bits + 1;
+    }
+
+    template <typename KeyType, std::size_t MaxRoutes, std::size_t MaxEntries>
+    constexpr std::size_t lpm_table<KeyType, MaxRoutes, MaxEntries>::bucket_capacity() noexcept {
+        // ceil_pow2((c + 1) / 2) <= c per populated length.
+        return MaxEntries;
+    }
+
+    template <typename KeyType, std::size_t MaxRoutes, std::size_t MaxEntries>
+    constexpr std::size_t lpm_table<KeyType, MaxRoutes, MaxEntries>::size() const noexcept {
+        return _size;
+    }
+
+    template <typename KeyType, std::size_t MaxRoutes, std::size_t MaxEntries>
+    constexpr std::size_t lpm_table<KeyType, MaxRoutes, MaxEntries>::entries() const noexcept {
+        return _entry_count;
+    }
+
+    template <typename KeyType, std::size_t MaxRoutes, std::size_t MaxEntries>
+    constexpr std::size_t lpm_table<KeyType, MaxRoutes, MaxEntries>::lengths() const noexcept {
+        return _level_count;
+    }
+
+    template <typename KeyType, std::size_t MaxRoutes, std::size_t MaxEntries>
+    constexpr KeyType lpm_table<KeyType, MaxRoutes, MaxEntries>::mask_of(std::size_t length) noexcept {
+        return length == 0 ? KeyType{0} : static_cast<KeyType>(~std::uintmax_t{0} << (key_bits - length));
+    }
+
+    template <typename KeyType, std::size_t MaxRoutes, std::size_t MaxEntries>
+    constexpr std::size_t lpm_table<KeyType, MaxRoutes, MaxEntries>::mix_prefix(KeyType prefix) noexcept {
+        return mix_native<std::size_t>(static_cast<std::size_t>(prefix));
+    }
+
+    template <typename KeyType, std::size_t MaxRoutes, std::size_t MaxEntries>
+    constexpr std::size_t lpm_table<KeyType, MaxRoutes, MaxEntries>::bucket_of(const level& lv, std::size_t mixed) noexcept {
+        return lv.bucket_base + (mixed & lv.bucket_mask);
+    }
+
+    template <typename KeyType, std::size_t MaxRoutes, std::size_t MaxEntries>
+    constexpr std::size_t
+    lpm_table<KeyType, MaxRoutes, MaxEntries>::slot_of(const level& lv, std::size_t mixed, std::size_t a) noexcept {
+        // XOR first: a plain `mixed * a` sends the prefix mixing to 0 to slot 0 under every `a`.
+        return lv.slot_base + top_bits<std::size_t>((mixed ^ a) * a, lv.slot_bits);
+    }
+
+    template <typename KeyType, std::size_t MaxRoutes, std::size_t MaxEntries>
+    constexpr void lpm_table<KeyType, MaxRoutes, MaxEntries>::clear_tail(std::size_t from) noexcept {
+        for (std::size_t i = from; i < capacity(); ++i)
+            _slots[i] = entry{KeyType{0}, static_cast<route_t>(not_found()), unused};
+    }
+
+    template <typename KeyType, std::size_t MaxRoutes, std::size_t MaxEntries>
+    constexpr lpm_table<KeyType, MaxRoutes, MaxEntries>::lpm_table(const route_type* routes, std::size_t n) noexcept {
+        assert(n <= MaxRoutes && "lpm_table: more routes than MaxRoutes");
+        if (n > MaxRoutes) n = MaxRoutes;
+
+        // 1) Routes, masked to their length, then deduplicated.
+        for (std::size_t i = 0; i < n; ++i) {
+            const route_type& r = routes[i];
+            assert(r.length <= key_bits && "lpm_table: prefix longer than the key");
+            if (r.length > key_bits) continue;
+            _slots[_entry_count++] = entry{static_cast<KeyType>(r.prefix & mask_of(r.length)),
+                                             static_cast<route_t>(i), r.length};
+        }
+        clear_tail(_entry_count);
+        sort_unique();
+        _size = _entry_count;
+
+        // 2) Populated lengths, ascending.
+        for (std::size_t i = 0; i < _entry_count; ++i) {
+            const std::uint8_t len = _slots[i].length;
+            if (_level_count == 0 || _levels[_level_count - 1].length != len)
+                _levels[_level_count++].length = len;
+        }
+        for (std::size_t k = 0; k < _level_count; ++k) _levels[k].mask = mask_of(_levels[k].length);
+
+        // 3) Markers and their best matching prefixes, then the per-length tables.
+        add_markers();
+        resolve_markers();
+        build_levels();
+    }
+
+    template <typename KeyType, std::size_t MaxRoutes, std::size_t MaxEntries>
+    constexpr lpm_table<KeyType, MaxRoutes, MaxEntries>::lpm_table(const std::array<route_type, MaxRoutes>& routes) noexcept
+        : lpm_table(routes.data(), MaxRoutes) {}
+
+    template <typename KeyType, std::size_t MaxRoutes, std::size_t MaxEntries>
+    constexpr void lpm_table<KeyType, MaxRoutes, MaxEntries>::sort_unique() noexcept {
+        // Unused entries sort last; a route sorts before a marker (route index < not_found()).
+        meta::sort_array(_slots, [](const entry& x, const entry& y) {
+            if (x.length != y.length) return x.length < y.length;
+            if (x.prefix != y.prefix) return x.prefix < y.prefix;
+            return x.route < y.route;
+        });
+        std::size_t out = 0;
+        for (std::size_t i = 0; i < _entry_count; ++i) {
+            if (out > 0 && _slots[out - 1].length == _slots[i].length
+                        && _slots[out - 1].prefix == _slots[i].prefix) continue;
+            _slots[out++] = _slots[i];
+        }
+        _entry_count = out;
+        clear_tail(out);
+    }
+
+    template <typename KeyType, std::size_t MaxRoutes, std::size_t MaxEntries>
+    constexpr void lpm_table<KeyType, MaxRoutes, MaxEntries>::add_markers() noexcept {
+        // Replay the lookup's search towards each route's level; every left
+        // turn-off point (mid < target) must hit, so it gets a marker.
+        const std::size_t routes = _entry_count;
+        for (std::size_t i = 0, target = 0; i < routes; ++i) {
+            while (_levels[target].length != _slots[i].length) ++target;
+            std::size_t lo = 0, hi = _level_count;
+            while (lo < hi) {
+                const std::size_t mid = lo + (hi - lo) / 2;
+                if (mid == target) break;
+                if (mid > target) { hi = mid; continue; }
+                assert(_entry_count < MaxEntries && "lpm_table: MaxEntries too small for the markers");
+                if (_entry_count == MaxEntries) return;
+                _slots[_entry_count++] = entry{static_cast<KeyType>(_slots[i].prefix & _levels[mid].mask),
+                                                 static_cast<route_t>(not_found()), _levels[mid].length};
+                lo = mid + 1;
+            }
+        }
+        sort_unique();
+    }
+
+    template <typename KeyType, std::size_t MaxRoutes, std::size_t MaxEntries>
+    constexpr void lpm_table<KeyType, MaxRoutes, MaxEntries>::resolve_markers() noexcept {
+        const auto less = [](const entry& x, const entry& y) {
+            return x.length != y.length ? x.length < y.length : x.prefix < y.prefix;
+        };
+        // Entries are in ascending length, so a shorter marker is resolved
+        // before any longer one that finds it: the first entry found below a
+        // marker already carries the answer, whether it is a route or a marker.
+        for (std::size_t i = 0, k = 0; i < _entry_count; ++i) {
+            entry& e = _slots[i];
+            while (_levels[k].length != e.length) ++k;
+            if (e.route != static_cast<route_t>(not_found())) continue;
+            for (std::size_t j = k; j-- > 0;) {
+                const entry probe{static_cast<KeyType>(e.prefix & _levels[j].mask), route_t{}, _levels[j].length};
+                const std::size_t at = meta::lower_bound_index(_slots, probe, _entry_count, less);
+                if (at < _entry_count && !less(probe, _slots[at])) { e.route = _slots[at].route; break; }
+            }
+        }
+    }
+
+    template <typename KeyType, std::size_t MaxRoutes, std::size_t MaxEntries>
+    constexpr void lpm_table<KeyType, MaxRoutes, MaxEntries>::build_levels() noexcept {
+        // 1) Size each level's region: about two entries per bucket, load <= 0.8.
+        std::size_t first = 0, slot_base = 0, bucket_base = 0;
+        for (std::size_t k = 0; k < _level_count; ++k) {
+            level& lv = _levels[k];
+            std::size_t c = 0;
+            while (first + c < _entry_count && _slots[first + c].length == lv.length) ++c;
+            const std::size_t slots = ceil_pow2<std::size_t>(c + c / 4 + 1);
+            const std::size_t buckets = ceil_pow2<std::size_t>((c + 1) / 2);
+            lv.slot_base = slot_base;
+            lv.slot_bits = ceil_log2<std::uint8_t>(slots);
+            lv.bucket_base = bucket_base;
+            lv.bucket_mask = buckets - 1;
+            slot_base += slots;
+            bucket_base += buckets;
+            first += c;
+        }
+        assert(slot_base <= capacity() && bucket_base <= bucket_capacity());
+
+        // 2) Order each level's entries by bucket, largest buckets first.
+        //    `_multiplier` holds the bucket sizes until placement starts.
+        std::array<std::uint8_t, key_bits + 1> level_of{};
+        for (std::size_t k = 0; k < _level_count; ++k) level_of[_levels[k].length] = static_cast<std::uint8_t>(k);
+        for (std::size_t i = 0; i < _entry_count; ++i) {
+            const entry& e = _slots[i];
+            ++_multiplier[bucket_of(_levels[level_of[e.length]], mix_prefix(e.prefix))];
+        }
+        const auto bucket = [&](const entry& e) {
+            return bucket_of(_levels[level_of[e.length]], mix_prefix(e.prefix));
+        };
+        meta::sort_array(_slots, [&](const entry& x, const entry& y) {
+            if (x.length != y.length) return x.length < y.length;
+            if (x.length == unused) return false;
+            const std::size_t bx = bucket(x), by = bucket(y);
+            if (_multiplier[bx] != _multiplier[by]) return _multiplier[bx] > _multiplier[by];
+            return bx < by;
+        });
+
+        // 3) Per bucket, find an odd multiplier that drops every entry into a free slot.
+        std::array<std::uint64_t, capacity() / 64 + 1> taken{};
+        const auto test_and_set = [&taken](std::size_t s) {
+            const std::uint64_t bit = std::uint64_t{1} << (s & 63);
+            const bool was = (taken[s >> 6] & bit) != 0;
+            taken[s >> 6] |= bit;
+            return was;
+        };
+        for (auto& m : _multiplier) m = std::size_t{1};
+        for (std::size_t i = 0; i < _entry_count;) {
+            const level& lv = _levels[level_of[_slots[i].length]];
+            const std::size_t b = bucket(_slots[i]);
+            std::size_t end = i + 1;
+            while (end < _entry_count && _slots[end].length == _slots[i].length && bucket(_slots[end]) == b) ++end;
+            std::size_t seed = 1;
+            for (; seed <= max_seeds; ++seed) {
+                const std::size_t a = mix_native(seed) | std::size_t{1};
+                std::size_t placed = i;
+                for (; placed < end; ++placed)
+                    if (test_and_set(slot_of(lv, mix_prefix(_slots[placed].prefix), a))) break; // possibly by this bucket
+                if (placed == end) { _multiplier[b] = a; break; }
+                for (std::size_t j = i; j < placed; ++j) {                                     // roll back
+                    const std::size_t s = slot_of(lv, mix_prefix(_slots[j].prefix), a);
+                    taken[s >> 6] &= ~(std::uint64_t{1} << (s & 63));
+                }
+            }
+            assert(seed <= max_seeds && "lpm_table: no multiplier places this bucket");
+            if (seed > max_seeds)
+                for (std::size_t j = i; j < end; ++j) _slots[j].length = unused;             // drop, never spin
+            i = end;
+        }
+
+        // 4) Move every entry to its slot in place, one permutation cycle at a time.
+        //    `taken` now marks slots that already hold their final entry.
+        for (auto& w : taken) w = 0;
+        const auto target = [&](const entry& e) {
+            const level& lv = _levels[level_of[e.length]];
+            const std::size_t mixed = mix_prefix(e.prefix);
+            return slot_of(lv, mixed, _multiplier[bucket_of(lv, mixed)]);
+        };
+        const entry empty{KeyType{0}, static_cast<route_t>(not_found()), unused};
+        for (std::size_t p = 0; p < _entry_count; ++p) {
+            if (taken[p >> 6] & (std::uint64_t{1} << (p & 63))) continue;
+            if (_slots[p].length == unused) continue;                                 // dropped in 3)
+            entry e = _slots[p];
+            _slots[p] = empty;
+            for (;;) {
+                const std::size_t t = target(e);
+                const entry next = _slots[t];
+                _slots[t] = e;
+                test_and_set(t);
+                if (next.length == unused) break;  // targets are distinct: a full slot is an unmoved entry
+                e = next;
+            }
+        }
+    }
+
+    template <typename KeyType, std::size_t MaxRoutes, std::size_t MaxEntries>
+    constexpr std::size_t lpm_table<KeyType, MaxRoutes, MaxEntries>::operator()(KeyType key) const noexcept {
+        std::size_t best = not_found();
+        std::size_t lo = 0, hi = _level_count;
+        while (lo < hi) {
+            const std::size_t mid = lo + (hi - lo) / 2;
+            const level& lv = _levels[mid];
+            const KeyType prefix = static_cast<KeyType>(key & lv.mask);
+            const std::size_t mixed = mix_prefix(prefix);
+            const entry& e = _slots[slot_of(lv, mixed, _multiplier[bucket_of(lv, mixed)])];
+            if (e.prefix == prefix && e.length == lv.length) {
+                best = e.route;    // route or marker bmp; a longer match may follow
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return trace::lookup(best, not_found(), key);
+    }
+
+    template <typename KeyType, std::size_t N>
+    constexpr lpm_table<KeyType, N> make_lpm_table(const std::array<lpm_route<KeyType>, N>& routes) noexcept {
+        return lpm_table<KeyType, N>{routes};
+    }
+
+} // namespace etools::hashing
+
+#endif // ETOOLS_HASHING_LPM_TPP_
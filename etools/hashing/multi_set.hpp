@@ -0,0 +1,253 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file multi_set.hpp
+*
+* @brief Fused membership over several static key sets: one perfect-hash probe
+*        returns a bitmask of every set that contains the key.
+*
+* @ingroup etools_hashing etools::hashing
+*
+* @details
+* Asking "which of these S sets contains k?" with one `optimal_mph` per set
+* costs S independent probes. `multi_set_table` builds a single perfect hash
+* over the union of the sets instead and stores, in each slot, the key next to
+* a bitmask of the sets it belongs to. A lookup is one mix, one bucket
+* multiplier load and one slot load; the verification key and the answer share
+* that slot.
+*
+* **Layout (hash and displace)**
+* - The union is hashed with `mix_native`. The low bits pick one of
+*   `buckets()` first-level buckets (about two keys each at full capacity).
+* - Every bucket owns an odd multiplier `a_b`; a key lands in slot
+*   `top_bits((mixed ^ a_b) * a_b)` of one shared table of `capacity()` slots
+*   (a power of two, at least `1.25 * Capacity`).
+* - Buckets are placed largest first, each trying multipliers until all its
+*   keys fall into free slots. Empty slots hold a zero mask, so misses need
+*   no separate sentinel test.
+*
+* **Builders**
+* - `multi_set<Key>::instance<Sets...>()` - compile-time: every set is a key
+*   provider (`key_provider.hpp`), for instance `multi_set<Key>::set<Keys...>`.
+*   Returns a `constexpr const&` to a per-pack singleton, like `fks` and `llut`.
+* - `multi_set_table<Key, Capacity, Sets>{spans}` - the same table built from
+*   `key_span`s, in a constant expression or at run time. `Capacity` bounds
+*   the size of the union.
+*
+* **Example**
+* @code
+* #include "etools/hashing/multi_set.hpp"
+* using M = etools::hashing::multi_set<std::uint16_t>;
+*
+* constexpr const auto& T = M::instance<M::set<22, 80, 443>,     // 0: tcp
+*                                       M::set<53, 123, 443>>();  // 1: udp
+* static_assert(T(443) == 0b11);
+* static_assert(T.contains(1, 53) && !T.contains(0, 53));
+* static_assert(T(8080) == 0);
+*
+* // Run time, from data loaded at start-up:
+* etools::hashing::multi_set_table<std::uint32_t, 4096, 12> rules{{
+*     {acl0.data(), acl0.size()}, {acl1.data(), acl1.size()}, ...
+* }};
+* auto mask = rules(addr);   // bit s set <=> addr is in set s
+* @endcode
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_HASHING_MULTI_SET_HPP_
+#define ETOOLS_HASHING_MULTI_SET_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "utils.hpp"             // mix_native, top_bits, ceil_pow2, ceil_log2
+#include "key_provider.hpp"      // key_pack, is_key_provider_v
+#include "../meta/traits.hpp"    // meta::smallest_uint_t
+#include "../trace/hooks.hpp"    // trace::lookup
+
+namespace etools::hashing {
+
+    /**
+    * @brief Non-owning view of one input key set for the `multi_set_table` builder.
+    *
+    * @tparam KeyType Unsigned integral key type.
+    */
+    template <typename KeyType>
+    struct key_span {
+        const KeyType* data = nullptr; ///< First key.
+        std::size_t size = 0;          ///< Number of keys; duplicates are allowed.
+    };
+
+    /**
+    * @brief Perfect hash over the union of `Sets` key sets, answering set membership as a bitmask.
+    *
+    * @tparam KeyType  Unsigned integral key type.
+    * @tparam Capacity Maximum number of distinct keys in the union.
+    * @tparam Sets     Number of sets, in `[1, 64]`; set `s` owns bit `s` of the mask.
+    *
+    * @note The constructor keeps about `Capacity * (sizeof(KeyType) + sizeof(mask_type) + 4)`
+    *       bytes of scratch on the stack; build large tables in a constant expression
+    *       or early at start-up.
+    */
+    template <typename KeyType, std::size_t Capacity, std::size_t Sets>
+    class multi_set_table {
+        static_assert(std::is_unsigned_v<KeyType>, "KeyType must be unsigned integral");
+        static_assert(Sets >= 1 && Sets <= 64, "multi_set_table: Sets must be in [1, 64]");
+
+    public:
+        /// @brief Key type.
+        using key_type = KeyType;
+
+        /// @brief Smallest unsigned type with `Sets` bits.
+        using mask_type = meta::smallest_uint_t<(Sets >= 64) ? ~std::uintmax_t{0}
+                                                             : ((std::uintmax_t{1} << Sets) - 1)>;
+
+        /**
+        * @brief Builds the table from one span per set.
+        *
+        * Keys present in several sets are stored once with several mask bits.
+        *
+        * @param[in] sets Input sets; `sets[s]` defines bit `s`.
+        * @pre The union holds at most `Capacity` distinct keys (asserted; extra keys are dropped).
+        */
+        constexpr explicit multi_set_table(const std::array<key_span<KeyType>, Sets>& sets) noexcept;
+
+        /**
+        * @brief Single-probe lookup.
+        *
+        * @param[in] key Query key.
+        * @return Bit `s` set iff `key` belongs to set `s`; `0` for keys in no set.
+        */
+        [[nodiscard]] constexpr mask_type operator()(KeyType key) const noexcept;
+
+        /**
+        * @brief Membership in one set.
+        *
+        * @param[in] set Set index in `[0, sets())`.
+        * @param[in] key Query key.
+        */
+        [[nodiscard]] constexpr bool contains(std::size_t set, KeyType key) const noexcept;
+
+        /// @brief Number of distinct keys in the union.
+        [[nodiscard]] constexpr std::size_t size() const noexcept;
+
+        /// @brief Number of sets (`Sets`).
+        [[nodiscard]] static constexpr std::size_t sets() noexcept;
+
+        /// @brief Slots in the table: `ceil_pow2(Capacity + Capacity / 4 + 1)`.
+        [[nodiscard]] static constexpr std::size_t capacity() noexcept;
+
+        /// @brief First-level bucket count (power of two).
+        [[nodiscard]] static constexpr std::size_t buckets() noexcept;
+
+    private:
+        /// @brief One slot: the verification key next to its set mask (`0` = empty).
+        struct entry {
+            KeyType key{};
+            mask_type mask{};
+        };
+
+        static constexpr std::uint8_t slot_bits = ceil_log2<std::uint8_t>(capacity());
+
+        /// @brief Multipliers tried per bucket before the build gives up on it (asserted; its keys then miss).
+        static constexpr std::size_t max_seeds = std::size_t{1} << 16;
+
+        /// @brief Slot of an already mixed key under multiplier `a`.
+        [[nodiscard]] static constexpr std::size_t slot_of(std::size_t mixed, std::size_t a) noexcept;
+
+        /// @brief Per-bucket odd multipliers `a_b`.
+        std::array<std::size_t, buckets()> _multiplier{};
+
+        /// @brief The perfect-hash table.
+        std::array<entry, capacity()> _slots{};
+
+        /// @brief Distinct keys stored.
+        std::size_t _size = 0;
+    };
+
+    namespace details {
+        /**
+        * @brief Canonical singleton for a pack of key-set types.
+        *
+        * @tparam KeyType Unsigned integral key type.
+        * @tparam Sets    Types with `static constexpr std::array<KeyType, N> keys`.
+        *
+        * @warning Internal - prefer `multi_set<KeyType>::instance<Sets...>()`.
+        */
+        template <typename KeyType, typename... Sets>
+        inline constexpr multi_set_table<KeyType, (std::size_t{0} + ... + Sets::keys.size()), sizeof...(Sets)>
+            multi_set_singleton{std::array<key_span<KeyType>, sizeof...(Sets)>{{
+                key_span<KeyType>{Sets::keys.data(), Sets::keys.size()}...
+            }}};
+    } // namespace details
+
+    /**
+    * @brief Facade for compile-time fused multi-set tables.
+    *
+    * @tparam KeyType Unsigned integral key type.
+    *
+    * ```cpp
+    * using M = etools::hashing::multi_set<std::uint8_t>;
+    * constexpr const auto& T = M::instance<M::set<1, 2>, M::set<2, 3>>();
+    * static_assert(T(2) == 0b11);
+    * ```
+    */
+    template <typename KeyType>
+    struct multi_set {
+        /**
+        * @brief Key set given as NTTPs.
+        *
+        * @tparam Keys Keys of the set.
+        */
+        template <KeyType... Keys>
+        using set = key_pack<KeyType, Keys...>;
+
+        /**
+        * @brief Obtain the canonical table for a pack of key sets.
+        *
+        * @tparam Sets Types with `static constexpr std::array<KeyType, N> keys`, such as
+        *              `set<Keys...>`; the i-th type defines mask bit i.
+        * @return `constexpr const&` to a `multi_set_table<KeyType, Total, sizeof...(Sets)>`
+        *         singleton, where `Total` is the summed size of the sets.
+        */
+        template <typename... Sets>
+        [[nodiscard]] static constexpr const auto& instance() noexcept;
+
+        /**
+        * @brief Deleted default constructor - this facade is not meant to be instantiated.
+        */
+        multi_set() = delete;
+
+        /**
+        * @brief Deleted copy constructor.
+        */
+        multi_set(const multi_set&) = delete;
+
+        /**
+        * @brief Deleted copy assignment.
+        */
+        multi_set& operator=(const multi_set&) = delete;
+
+        /**
+        * @brief Deleted move constructor.
+        */
+        multi_set(multi_set&&) = delete;
+
+        /**
+        * @brief Deleted move assignment.
+        */
+        multi_set& operator=(multi_set&&) = delete;
+    };
+
+} // namespace etools::hashing
+
+#include "multi_set.tpp"
+#endif // ETOOLS_HASHING_MULTI_SET_HPP_
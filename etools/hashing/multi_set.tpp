@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file multi_set.tpp
+*
+* @brief Definition of multi_set.hpp methods.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_HASHING_MULTI_SET_TPP_
+#define ETOOLS_HASHING_MULTI_SET_TPP_
+#include "multi_set.hpp"
+#include <cassert>
+
+namespace etools::hashing {
+
+    template <typename KeyType, std::size_t Capacity, std::size_t Sets>
+    constexpr std::size_t multi_set_table<KeyType, Capacity, Sets>::sets() noexcept {
+        return Sets;
+    }
+
+    template <typename KeyType, std::size_t Capacity, std::size_t Sets>
+    constexpr std::size_t multi_set_table<KeyType, Capacity, Sets>::capacity() noexcept {
+        return ceil_pow2<std::size_t>(Capacity + Capacity / 4 + 1);
+    }
+
+    template <typename KeyType, std::size_t Capacity, std::size_t Sets>
+    constexpr std::size_t multi_set_table<KeyType, Capacity, Sets>::buckets() noexcept {
+        return ceil_pow2<std::size_t>(Capacity / 2);
+    }
+
+    template <typename KeyType, std::size_t Capacity, std::size_t Sets>
+    constexpr std::size_t multi_set_table<KeyType, Capacity, Sets>::size() const noexcept {
+        return _size;
+    }
+
+    template <typename KeyType, std::size_t Capacity, std::size_t Sets>
+    constexpr std::size_t multi_set_table<KeyType, Capacity, Sets>::slot_of(std::size_t mixed, std::size_t a) noexcept {
+        // XOR first: a plain `mixed * a` sends the key mixing to 0 (key 0) to slot 0 under every `a`.
+        return top_bits<std::size_t>((mixed ^ a) * a, slot_bits);
+    }
+
+    template <typename KeyType, std::size_t Capacity, std::size_t Sets>
+    constexpr multi_set_table<KeyType, Capacity, Sets>::multi_set_table(
+        const std::array<key_span<KeyType>, Sets>& sets) noexcept
+    {
+        using index_t = meta::smallest_uint_t<Capacity>;
+        constexpr std::size_t mask_slots = capacity() - 1;
+
+        // 1) Union: linear probing into the slot table, OR-ing one bit per set.
+        for (std::size_t s = 0; s < Sets; ++s) {
+            const mask_type bit = static_cast<mask_type>(mask_type{1} << s);
+            for (std::size_t i = 0; i < sets[s].size; ++i) {
+                const KeyType key = sets[s].data[i];
+                std::size_t pos = top_bits<std::size_t>(mix_native<std::size_t>(static_cast<std::size_t>(key)), slot_bits);
+                while (_slots[pos].mask && _slots[pos].key != key) pos = (pos + 1) & mask_slots;
+                if (!_slots[pos].mask) {
+                    assert(_size < Capacity && "multi_set_table: more distinct keys than Capacity");
+                    if (_size == Capacity) continue;
+                    _slots[pos].key = key;
+                    ++_size;
+                }
+                _slots[pos].mask = static_cast<mask_type>(_slots[pos].mask | bit);
+            }
+        }
+
+        // 2) Move the distinct entries out and group them by bucket (CSR).
+        std::array<entry, Capacity> items{};
+        std::array<index_t, Capacity> by_bucket{};
+        std::array<std::size_t, buckets() + 1> offsets{};
+        for (std::size_t pos = 0, n = 0; pos < capacity(); ++pos) {
+            if (!_slots[pos].mask) continue;
+            items[n++] = _slots[pos];
+            _slots[pos] = entry{};
+        }
+        for (std::size_t i = 0; i < _size; ++i)
+            ++offsets[(mix_native<std::size_t>(static_cast<std::size_t>(items[i].key)) & (buckets() - 1)) + 1];
+        std::size_t largest = 0;
+        for (std::size_t b = 0; b < buckets(); ++b) {
+            if (offsets[b + 1] > largest) largest = offsets[b + 1];
+            offsets[b + 1] += offsets[b];
+        }
+        {
+            std::array<std::size_t, buckets()> fill{};
+            for (std::size_t i = 0; i < _size; ++i) {
+                const std::size_t b = mix_native<std::size_t>(static_cast<std::size_t>(items[i].key)) & (buckets() - 1);
+                by_bucket[offsets[b] + fill[b]++] = static_cast<index_t>(i);
+            }
+        }
+
+        // 3) Largest buckets first: find an odd multiplier that drops every key into a free slot.
+        for (std::size_t b = 0; b < buckets(); ++b) _multiplier[b] = std::size_t{1};
+        for (std::size_t want = largest; want > 0; --want) {
+            for (std::size_t b = 0; b < buckets(); ++b) {
+                const std::size_t first = offsets[b];
+                if (offsets[b + 1] - first != want) continue;
+                std::size_t seed = 1;
+                for (; seed <= max_seeds; ++seed) {
+                    const std::size_t a = mix_native(seed) | std::size_t{1};
+                    std::size_t placed = 0;
+                    for (; placed < want; ++placed) {
+                        const entry& e = items[by_bucket[first + placed]];
+                        entry& slot = _slots[slot_of(mix_native<std::size_t>(static_cast<std::size_t>(e.key)), a)];
+                        if (slot.mask) break;       // taken, possibly by this bucket
+                        slot = e;
+                    }
+                    if (placed == want) { _multiplier[b] = a; break; }
+                    while (placed-- > 0) {           // roll back
+                        const entry& e = items[by_bucket[first + placed]];
+                        _slots[slot_of(mix_native<std::size_t>(static_cast<std::size_t>(e.key)), a)] = entry{};
+                    }
+                }
+                assert(seed <= max_seeds && "multi_set_table: no multiplier places this bucket");
+            }
+        }
+    }
+
+    template <typename KeyType, std::size_t Capacity, std::size_t Sets>
+    constexpr auto multi_set_table<KeyType, Capacity, Sets>::operator()(KeyType key) const noexcept -> mask_type {
+        const std::size_t mixed = mix_native<std::size_t>(static_cast<std::size_t>(key));
+        const entry& e = _slots[slot_of(mixed, _multiplier[mixed & (buckets() - 1)])];
+        const mask_type mask = (e.key == key) ? e.mask : mask_type{0};  // empty slots carry mask 0
+        trace::lookup(mask ? 0 : 1, 1, key);
+        return mask;
+    }
+
+    template <typename KeyType, std::size_t Capacity, std::size_t Sets>
+    constexpr bool multi_set_table<KeyType, Capacity, Sets>::contains(std::size_t set, KeyType key) const noexcept {
+        return set < Sets && ((*this)(key) >> set) & 1u;
+    }
+
+    template <typename KeyType>
+    template <typename... Sets>
+    constexpr const auto& multi_set<KeyType>::instance() noexcept {
+        static_assert(sizeof...(Sets) > 0, "multi_set: at least one key set is required");
+        static_assert((is_key_provider_v<Sets, KeyType> && ...),
+                      "multi_set: every set must provide static constexpr std::array<KeyType, N> keys");
+        return details::multi_set_singleton<KeyType, Sets...>;
+    }
+
+} // namespace etools::hashing
+
+#endif // ETOOLS_HASHING_MULTI_SET_TPP_
@@ -39,7 +39,9 @@
 * **How to use**
 *  - Include this header.
 *  - Call `optimal_mph<Key>::instance<Keys...>()` to get a `constexpr const&`
-*    to the canonical MPHF object. The returned object exposes a uniform
+*    to the canonical MPHF object, or `optimal_mph<Key>::instance<Provider>()`
+*    with a key provider type (`static constexpr std::array<Key, N> keys`) for
+*    large sets. The returned object exposes a uniform
 *    cross-backend surface:
 *      - `operator()(key)` - O(1) lookup, returns dense index or `not_found()`.
 *      - `size()`          - number of registered keys (= N).
@@ -86,6 +88,7 @@
 #ifndef ETOOLS_HASHING_OPTIMAL_MPH_HPP_
 #define ETOOLS_HASHING_OPTIMAL_MPH_HPP_
 #include <cstddef>
+#include "key_provider.hpp" // key_pack, is_key_provider_v
 
 namespace etools::hashing{
 
@@ -114,7 +117,7 @@ namespace etools::hashing{
     * 
     * @warning `instance<...>()` returns a `constexpr const&` to the chosen backend’s
     *          canonical singleton. The *type* of the returned object depends on the
-    *          key pack and may be either `llut_impl<...>` or `fks_impl<...>`.
+    *          key set and may be either `llut_table<...>` or `fks_table<...>`.
     */
     template <typename KeyType, std::size_t AlphaScaled = 3>
     struct optimal_mph {
@@ -134,6 +137,19 @@ namespace etools::hashing{
         template <KeyType... Keys>
         [[nodiscard]] static constexpr const auto& instance() noexcept;
 
+        /**
+        * @brief Obtain the canonical MPH instance for the keys of a key provider.
+        *
+        * Same selection as the pack overload, but the table is identified by
+        * `Provider` instead of the key values (see `key_provider.hpp`).
+        *
+        * @tparam Provider Type with `static constexpr std::array<KeyType, N> keys` of
+        *                  distinct keys; array order defines dense indices `[0..N-1]`.
+        * @return `constexpr const auto&` to the chosen backend’s singleton.
+        */
+        template <typename Provider>
+        [[nodiscard]] static constexpr const auto& instance() noexcept;
+
         /**
         * @brief Deleted default constructor - this facade is not meant to be instantiated.
         */
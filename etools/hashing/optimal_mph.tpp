@@ -23,11 +23,24 @@ namespace etools::hashing{
     template <typename KeyType, std::size_t AlphaScaled>
     template <KeyType... Keys>
     constexpr const auto& optimal_mph<KeyType, AlphaScaled>::instance() noexcept{
-        // N and K (pack size and span)
-        constexpr std::size_t N = sizeof...(Keys);
+        return instance<key_pack<KeyType, Keys...>>();
+    }
+
+    template <typename KeyType, std::size_t AlphaScaled>
+    template <typename Provider>
+    constexpr const auto& optimal_mph<KeyType, AlphaScaled>::instance() noexcept{
+        static_assert(is_key_provider_v<Provider, KeyType>,
+            "Provider must expose static constexpr std::array<KeyType, N> keys");
+
+        // N and K (key count and span)
+        constexpr std::size_t N = Provider::keys.size();
         static_assert(N > 0, "At least one key is required");
         
-        constexpr std::size_t K = static_cast<std::size_t>(meta::tpack_max<KeyType, Keys...>()) + 1u;
+        constexpr auto max_key = [] {
+            std::uintmax_t m = 0;
+            for (KeyType k : Provider::keys) if (static_cast<std::uintmax_t>(k) > m) m = static_cast<std::uintmax_t>(k);
+            return m;
+        }();
         
         // Index storage chosen the same way your backends do
         using index_t = meta::smallest_uint_t<N>;
@@ -36,14 +49,17 @@ namespace etools::hashing{
         constexpr std::size_t s_sz = sizeof(std::size_t);
         
         // Compare memory models (integer math; no FP)
-        // LLUT ≈ K*s_index
+        // LLUT ≈ K*s_index, K = max_key + 1
         // FKS  ≈ N*(AlphaScaled*s_index + 2*s_sz + 1 + s_key)
-        constexpr bool use_fks = (K * s_index) > (N * (AlphaScaled * s_index + 2 * s_sz + 1 + s_key));
+        // LLUT > FKS  <=>  max_key + 1 > FKS / s_index  <=>  max_key >= FKS / s_index.
+        // Written this way so full-width keys (e.g. hashed type ids) cannot overflow K.
+        constexpr std::size_t fks_mem = N * (AlphaScaled * s_index + 2 * s_sz + 1 + s_key);
+        constexpr bool use_fks = max_key >= fks_mem / s_index;
         
         if constexpr (use_fks) 
-        return etools::hashing::fks<KeyType>::template instance<Keys...>();
+        return etools::hashing::fks<KeyType>::template instance<Provider>();
         else 
-        return etools::hashing::llut<KeyType>::template instance<Keys...>();
+        return etools::hashing::llut<KeyType>::template instance<Provider>();
     }
     
 } // namespace etools::hashing
@@ -18,6 +18,8 @@
 * - Packing structured output into a transmittable buffer
 * - Passing serialized input across a layer boundary in a uniform way
 * - Reusing memory from a static pool (via custom deleter)
+* - Drawing the block from a `std::pmr::memory_resource` (`make_buffer` +
+*   `resource_deleter`), e.g. a `tracking_resource` that attributes it to a subsystem
 *
 * ### Example Usage
 * ```cpp
@@ -47,9 +49,12 @@
 #ifndef ETOOLS_MEMORY_BUFFER_HPP_
 #define ETOOLS_MEMORY_BUFFER_HPP_
 #include <memory>
+#include <memory_resource>
 #include <cstddef>
 #include <optional>
 #include <tuple>
+#include "varint.hpp"
+#include "../trace/hooks.hpp"
 
 namespace etools::memory{
     /**
@@ -168,6 +173,9 @@ namespace etools::memory{
         * @note Strictly all-or-nothing: a buffer too short for `Ts...` yields `nullopt`
         *       and reads nothing - there is no partial/zero fill.
         * @note Does not modify the buffer.
+        * @note A `T` opting into `fields()` (`meta::has_wire_fields_v`) is read as its listed
+        *       fields, then default-constructed and assigned through `fields()`; it
+        *       must match the layout `pack` wrote.
         */
         template<typename... Ts>
         [[nodiscard]] inline std::optional<std::tuple<Ts...>> unpack() const;
@@ -189,10 +197,45 @@ namespace etools::memory{
         * @warning Violating the precondition triggers an `assert` in debug builds.
         * @note Not `[[nodiscard]]`: the byte count is available for callers that want it,
         *       but the serializer never overflows the buffer, so ignoring it is safe.
+        * @note An argument whose type exposes `fields()` returning `std::tie(...)` and
+        *       declares `wire_fields = true` (`meta::has_wire_fields_v`) is written as those fields in order rather than
+        *       as one object, so padding is not transmitted.
         */
         template<typename... Ts>
         inline std::size_t pack(Ts&&... args);
 
+        /**
+        * @brief Unpacks values written by `pack(compact, ...)`.
+        *
+        * @tparam Ts... The types to extract, as passed to `pack`.
+        * @return `std::nullopt` if the used bytes end early, a varint is malformed, or a
+        *         value does not fit its type; otherwise the tuple.
+        *
+        * @note Does not modify the buffer.
+        * @see varint.hpp for the compact layout.
+        */
+        template<typename... Ts>
+        [[nodiscard]] inline std::optional<std::tuple<Ts...>> unpack(compact_t) const;
+
+        /**
+        * @brief Packs values in the compact wire mode: varint integers, zigzag signed
+        *        values, bit-packed booleans, Stream VByte integer arrays.
+        *
+        * @tparam Ts... The types of the values to serialize.
+        * @param args The values to serialize into the buffer.
+        * @return The number of bytes written, or `0` if `args...` do not fit in `capacity()`.
+        *
+        * @pre The buffer owns a non-null block (i.e. has not been moved from).
+        * @post `this->size()` equals the returned byte count.
+        *
+        * @note Unlike the flat mode, a pack that does not fit may have overwritten part of
+        *       the block; `size()` is still `0` afterwards.
+        * @note `wire_fields` types are flattened as in the flat mode. Other non-integer
+        *       arguments must be trivially copyable and are copied as is.
+        */
+        template<typename... Ts>
+        inline std::size_t pack(compact_t, Ts&&... args);
+
         /**
         * @brief Returns a pointer to the internal byte data.
         *
@@ -206,6 +249,28 @@ namespace etools::memory{
         */
         [[nodiscard]] inline const std::byte* data() const noexcept;
 
+        /**
+        * @brief Returns a writable pointer to the internal byte data.
+        *
+        * For writers that fill the block directly rather than through `pack`
+        * (for instance `lz_compress`); follow the write with `resize`.
+        *
+        * @return A pointer to the owned block, or `nullptr` if the buffer has been moved from.
+        */
+        [[nodiscard]] inline std::byte* mutable_data() noexcept;
+
+        /**
+        * @brief Sets the number of used bytes after a direct write through `mutable_data()`.
+        *
+        * @param size The new used size in bytes.
+        *
+        * @pre `size <= capacity()`.
+        * @post `this->size() == size`; the bytes themselves are not touched.
+        *
+        * @warning Violating the precondition triggers an `assert` in debug builds.
+        */
+        inline void resize(std::size_t size) noexcept;
+
         /**
         * @brief Returns the size of the used portion of the buffer's memory.
         *
@@ -238,6 +303,31 @@ namespace etools::memory{
         std::size_t _capacity{0};
     };
 
+    /**
+    * @brief `buffer` deleter returning the block to the memory resource it came from.
+    *
+    * A default-constructed deleter (null `resource`) owns nothing, so
+    * `buffer<resource_deleter>` stays default-constructible.
+    */
+    struct resource_deleter {
+        std::pmr::memory_resource* resource = nullptr;  ///< Resource the block was allocated from.
+        std::size_t size = 0;                           ///< Block size in bytes, as allocated.
+
+        /// @brief Deallocates `p` (`size` bytes, `alignof(std::max_align_t)`) from `resource`.
+        inline void operator()(std::byte* p) const noexcept;
+    };
+
+    /**
+    * @brief Allocates a `capacity`-byte buffer from `resource`.
+    *
+    * @param capacity Block size in bytes.
+    * @param resource Source of the block; must outlive the returned buffer.
+    * @return An empty buffer of `capacity` bytes, aligned to `alignof(std::max_align_t)`.
+    *
+    * @note Allocation failure is reported by `resource` (`std::bad_alloc` for the standard ones).
+    */
+    [[nodiscard]] inline buffer<resource_deleter> make_buffer(std::size_t capacity, std::pmr::memory_resource& resource);
+
 } // namespace etools::memory
 
 #include "buffer.tpp"
@@ -16,6 +16,7 @@
 #ifndef ETOOLS_MEMORY_BUFFER_TPP_
 #define ETOOLS_MEMORY_BUFFER_TPP_
 #include "buffer.hpp"
+#include "field_codec.hpp"
 #include <eser/flat/serializer.hpp>
 #include <eser/flat/deserializer.hpp>
 #include <cassert>
@@ -64,6 +65,17 @@ namespace etools::memory{
         return _data.get();
     }
 
+    template<typename Deleter>
+    inline std::byte* buffer<Deleter>::mutable_data() noexcept {
+        return _data.get();
+    }
+
+    template<typename Deleter>
+    inline void buffer<Deleter>::resize(std::size_t size) noexcept {
+        assert(size <= _capacity && "buffer::resize(): size cannot exceed capacity");
+        _size = size;
+    }
+
     template<typename Deleter>
     inline std::size_t buffer<Deleter>::size() const noexcept {
         return _size;
@@ -77,17 +89,62 @@ namespace etools::memory{
     template<typename Deleter>
     template<typename... Ts>
     inline std::optional<std::tuple<Ts...>> buffer<Deleter>::unpack() const {
-        return eser::flat::deserialize(data(), size()).template to<std::tuple<Ts...>>();
+        trace::span<trace::event::buffer_unpack> span{size()};
+        if constexpr (details::any_fields_v<Ts...>) {
+            auto flat = eser::flat::deserialize(data(), size()).template to<details::wire_tuple_t<Ts...>>();
+            if (!flat) return std::nullopt;
+            return details::assemble<Ts...>(*flat);
+        } else {
+            return eser::flat::deserialize(data(), size()).template to<std::tuple<Ts...>>();
+        }
     }
 
     template<typename Deleter>
     template<typename... Ts>
     inline std::size_t buffer<Deleter>::pack(Ts&&... args) {
         assert(_data && "buffer::pack(): called on a moved-from or null-data buffer");
-        _size = eser::flat::serialize(std::forward<Ts>(args)...).to(_data.get(), capacity());
+        trace::span<trace::event::buffer_pack> span;
+        if constexpr (details::any_fields_v<Ts...>) {
+            _size = std::apply([this](auto&&... wire) {
+                return eser::flat::serialize(std::forward<decltype(wire)>(wire)...).to(_data.get(), capacity());
+            }, std::tuple_cat(details::wire_refs(std::forward<Ts>(args))...));
+        } else {
+            _size = eser::flat::serialize(std::forward<Ts>(args)...).to(_data.get(), capacity());
+        }
+        span.arg(_size);
         return _size;
     }
 
+    template<typename Deleter>
+    template<typename... Ts>
+    inline std::optional<std::tuple<Ts...>> buffer<Deleter>::unpack(compact_t) const {
+        trace::span<trace::event::buffer_unpack> span{size()};
+        auto flat = details::compact_unpack<details::wire_tuple_t<Ts...>>(data(), size());
+        if (!flat) return std::nullopt;
+        return details::assemble<Ts...>(*flat);
+    }
+
+    template<typename Deleter>
+    template<typename... Ts>
+    inline std::size_t buffer<Deleter>::pack(compact_t, Ts&&... args) {
+        assert(_data && "buffer::pack(): called on a moved-from or null-data buffer");
+        trace::span<trace::event::buffer_pack> span;
+        _size = std::apply([this](const auto&... wire) {
+            return details::compact_pack(_data.get(), capacity(), wire...);
+        }, std::tuple_cat(details::wire_refs(std::forward<Ts>(args))...));
+        span.arg(_size);
+        return _size;
+    }
+
+    inline void resource_deleter::operator()(std::byte* p) const noexcept {
+        if (p) resource->deallocate(p, size, alignof(std::max_align_t));
+    }
+
+    inline buffer<resource_deleter> make_buffer(std::size_t capacity, std::pmr::memory_resource& resource) {
+        auto* p = static_cast<std::byte*>(resource.allocate(capacity, alignof(std::max_align_t)));
+        return buffer<resource_deleter>{std::unique_ptr<std::byte[], resource_deleter>{p, resource_deleter{&resource, capacity}}, capacity};
+    }
+
 } // namespace etools::memory
 
 #endif // ETOOLS_MEMORY_BUFFER_TPP_
\ No newline at end of file
@@ -28,6 +28,8 @@
 #include <cstddef>
 #include <tuple>
 #include <optional>
+#include "varint.hpp"
+#include "../trace/hooks.hpp"
 
 namespace etools::memory {
 
@@ -79,11 +81,24 @@ namespace etools::memory {
         *
         * @note Strictly all-or-nothing: a viewed range too short for `Ts...` yields
         *       `nullopt` and reads nothing - there is no partial/zero fill.
+        * @note Types opting into `fields()` (`meta::has_wire_fields_v`) are read field-wise, as in `buffer::unpack`.
         * @note Does not modify the viewed range.
         */
         template<typename ...Ts>
         [[nodiscard]] inline std::optional<std::tuple<Ts...>> unpack() const;
 
+        /**
+        * @brief Unpacks values written by `buffer::pack(compact, ...)`.
+        *
+        * @tparam Ts... The types to extract, as passed to `pack`.
+        * @return `std::nullopt` if the viewed range ends early, a varint is malformed, or
+        *         a value does not fit its type; otherwise the tuple.
+        *
+        * @see varint.hpp for the compact layout.
+        */
+        template<typename ...Ts>
+        [[nodiscard]] inline std::optional<std::tuple<Ts...>> unpack(compact_t) const;
+
         /**
         * @brief Returns a pointer to the underlying byte data.
         *
@@ -18,6 +18,7 @@
 #ifndef ETOOLS_MEMORY_BUFFER_VIEW_TPP_
 #define ETOOLS_MEMORY_BUFFER_VIEW_TPP_
 #include "buffer_view.hpp"
+#include "field_codec.hpp"
 #include <eser/flat/deserializer.hpp>
 namespace etools::memory {
     inline buffer_view::buffer_view(const std::byte *data, std::size_t size) noexcept
@@ -35,7 +36,22 @@ namespace etools::memory {
 
     template<typename... Ts>
     inline std::optional<std::tuple<Ts...>> buffer_view::unpack() const {
-        return eser::flat::deserialize(data(), size()).template to<std::tuple<Ts...>>();
+        trace::span<trace::event::buffer_unpack> span{size()};
+        if constexpr (details::any_fields_v<Ts...>) {
+            auto flat = eser::flat::deserialize(data(), size()).template to<details::wire_tuple_t<Ts...>>();
+            if (!flat) return std::nullopt;
+            return details::assemble<Ts...>(*flat);
+        } else {
+            return eser::flat::deserialize(data(), size()).template to<std::tuple<Ts...>>();
+        }
+    }
+
+    template<typename... Ts>
+    inline std::optional<std::tuple<Ts...>> buffer_view::unpack(compact_t) const {
+        trace::span<trace::event::buffer_unpack> span{size()};
+        auto flat = details::compact_unpack<details::wire_tuple_t<Ts...>>(data(), size());
+        if (!flat) return std::nullopt;
+        return details::assemble<Ts...>(*flat);
     }
 
 } // namespace etools::memory
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file field_codec.hpp
+*
+* @ingroup etools_memory etools::memory
+*
+* @brief Field-wise wire view shared by `buffer` and `buffer_view` for types opting into `fields()`.
+*
+* A type that exposes `fields()` returning `std::tie(members...)` and declares
+* `static constexpr bool wire_fields = true;` (`meta::has_wire_fields_v`, see
+* `meta/capabilities.hpp`) is serialised as that
+* list of members instead of as one object: padding is not transmitted and the
+* type itself need not be trivially copyable. These helpers flatten an
+* argument list into one tuple of member references for `pack`, and rebuild
+* the typed values from the flat tuple that `unpack` deserialises. Neither
+* depends on eser; the callers do.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_MEMORY_FIELD_CODEC_HPP_
+#define ETOOLS_MEMORY_FIELD_CODEC_HPP_
+#include "../meta/algorithm.hpp"    // etools::meta::exclusive_prefix_sum
+#include "../meta/capabilities.hpp" // etools::meta::has_wire_fields_v
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace etools::memory::details {
+
+    /// @brief `true` if any of `Ts...` is serialised field-wise.
+    template<typename... Ts>
+    inline constexpr bool any_fields_v = (meta::has_wire_fields_v<std::decay_t<Ts>> || ...);
+
+    /**
+    * @brief Wire view of one argument: the `fields()` tuple, or a one-element reference tuple.
+    */
+    template<typename T>
+    constexpr auto wire_refs(T&& v) {
+        if constexpr (meta::has_wire_fields_v<std::decay_t<T>>)
+            return v.fields();
+        else
+            return std::forward_as_tuple(std::forward<T>(v));
+    }
+
+    template<typename Tuple>
+    struct decay_tuple;
+
+    template<typename... Us>
+    struct decay_tuple<std::tuple<Us...>> {
+        using type = std::tuple<std::decay_t<Us>...>;
+    };
+
+    /// @brief Value types `T` occupies on the wire.
+    template<typename T, typename = void>
+    struct wire_types {
+        using type = std::tuple<T>;
+    };
+
+    template<typename T>
+    struct wire_types<T, std::enable_if_t<meta::has_wire_fields_v<T>>> {
+        using type = typename decay_tuple<decltype(std::declval<T&>().fields())>::type;
+    };
+
+    /// @brief Flat tuple of every wire value of `Ts...`, in order.
+    template<typename... Ts>
+    using wire_tuple_t = decltype(std::tuple_cat(std::declval<typename wire_types<Ts>::type>()...));
+
+    template<typename T, std::size_t Off, typename Flat, std::size_t... Js>
+    T assemble_one(Flat& flat, std::index_sequence<Js...>) {
+        if constexpr (meta::has_wire_fields_v<T>) {
+            static_assert(std::is_default_constructible_v<T>,
+                "buffer::unpack: a type unpacked through fields() must be default-constructible");
+            T t{};
+            t.fields() = std::forward_as_tuple(std::move(std::get<Off + Js>(flat))...);
+            return t;
+        } else {
+            return std::move(std::get<Off>(flat));
+        }
+    }
+
+    template<typename... Ts, typename Flat, std::size_t... Is>
+    std::tuple<Ts...> assemble(Flat& flat, std::index_sequence<Is...>) {
+        constexpr std::array<std::size_t, sizeof...(Ts)> counts{
+            std::tuple_size<typename wire_types<Ts>::type>::value...};
+        constexpr auto offsets = meta::exclusive_prefix_sum(counts);
+        return std::tuple<Ts...>{
+            assemble_one<Ts, offsets[Is]>(flat, std::make_index_sequence<counts[Is]>{})...};
+    }
+
+    /**
+    * @brief Rebuilds `std::tuple<Ts...>` from the flat wire tuple of `Ts...`.
+    */
+    template<typename... Ts>
+    std::tuple<Ts...> assemble(wire_tuple_t<Ts...>& flat) {
+        return assemble<Ts...>(flat, std::index_sequence_for<Ts...>{});
+    }
+
+} // namespace etools::memory::details
+
+#endif // ETOOLS_MEMORY_FIELD_CODEC_HPP_
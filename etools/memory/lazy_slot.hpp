@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file lazy_slot.hpp
+*
+* @brief In-place storage for one `T` that is constructed on first access, thread-safely.
+*
+* @ingroup etools_memory etools::memory
+*
+* @details
+* Large global objects (lookup tables, registries, codecs) are often built
+* eagerly at startup and then never used. A `lazy_slot<T>` holds the storage
+* for such an object and builds it the first time someone asks for it:
+*
+* - **Constant-initialised.** The constructor is `constexpr` and touches
+*   nothing but a state byte. A namespace-scope `lazy_slot` is therefore
+*   initialised before any dynamic initialiser runs, and can be used safely
+*   from another global's constructor in any translation unit. No
+*   static-initialisation-order problem can arise.
+* - **Lock-free once built.** Every access starts with one acquire load of
+*   the state byte. Once the object is built, that load and a compare are the
+*   whole cost.
+* - **One builder.** The first caller moves the state from *empty* to *busy*
+*   with a CAS and constructs the object. Concurrent callers yield until the
+*   state becomes *ready*. If the constructor throws, the state returns to
+*   *empty* and the next caller tries again, as with `std::call_once`.
+*
+* Unlike a function-local `static`, the slot is an ordinary object: it can be
+* a class member, live in a specific section or arena, and be queried with
+* `has_value()` without constructing anything.
+*
+* **Example**
+* @code
+* #include "etools/memory/lazy_slot.hpp"
+*
+* etools::memory::lazy_slot<unit_registry> units;            // no code runs at startup
+*
+* const unit& find_unit(std::string_view name) {
+*     return units.get_or_init(load_unit_registry).find(name); // built by the first caller only
+* }
+* @endcode
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_MEMORY_LAZY_SLOT_HPP_
+#define ETOOLS_MEMORY_LAZY_SLOT_HPP_
+#include "../meta/traits.hpp"   // etools::meta::always_false_v
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace etools::memory {
+
+    /**
+    * @class lazy_slot
+    * @brief Storage for one `T`, constructed by the first `get_or_emplace` / `get_or_init` call.
+    *
+    * @tparam T The stored type; must be nothrow-destructible.
+    *
+    * @invariant `_state == ready` iff `_value` holds a live `T`; once `ready`, it stays so
+    *            until the slot is destroyed.
+    *
+    * @warning A constructor of `T` that accesses its own slot waits for itself forever,
+    *          just as a recursive function-local `static` initialisation would.
+    * @note Neither copyable nor movable: other threads may hold references into it.
+    */
+    template<typename T>
+    class lazy_slot {
+    public:
+        /// @brief The contained value type.
+        using value_type = T;
+
+        /**
+        * @brief Constructs an empty slot.
+        *
+        * `constexpr`: a namespace-scope or `static` slot is constant-initialised.
+        *
+        * @post `has_value() == false`.
+        */
+        constexpr lazy_slot() noexcept;
+
+        /// @brief Destroys the object if it was built.
+        inline ~lazy_slot();
+
+        lazy_slot(const lazy_slot&) = delete;
+        lazy_slot& operator=(const lazy_slot&) = delete;
+
+        /**
+        * @brief Returns the object, constructing it as `T(args...)` if this is the first access.
+        *
+        * @param args Constructor arguments; evaluated by every call, used by the first only.
+        * @return Reference to the object.
+        *
+        * @post `has_value() == true`, unless the constructor threw.
+        * @note If the constructor throws, the exception propagates and the slot stays empty.
+        */
+        template<typename... Args>
+        inline T& get_or_emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args&&...>);
+
+        /**
+        * @brief Returns the object, constructing it from `make()` if this is the first access.
+        *
+        * `make` runs only when the object is built, so the arguments to expensive
+        * construction are not computed on the fast path.
+        *
+        * @param make Callable returning `T` (constructed in place, no move) or a value `T` is
+        *             constructible from.
+        * @return Reference to the object.
+        */
+        template<typename F>
+        inline T& get_or_init(F&& make);
+
+        /**
+        * @brief Whether the object has been built.
+        *
+        * @return `true` iff the object is constructed; an acquire load, so the object
+        *         is then safe to read through `operator*`.
+        */
+        [[nodiscard]] inline bool has_value() const noexcept;
+
+        /// @brief Boolean conversion - equivalent to `has_value()`.
+        [[nodiscard]] explicit inline operator bool() const noexcept;
+
+        /**
+        * @brief The built object.
+        *
+        * @pre `has_value() == true`.
+        * @warning Asserts in debug builds if the object has not been built.
+        */
+        [[nodiscard]] inline T& operator*() noexcept;
+
+        /// @brief Const overload of `operator*`. @copydetails operator*()
+        [[nodiscard]] inline const T& operator*() const noexcept;
+
+        /// @brief Member access on the built object. @pre `has_value() == true`.
+        [[nodiscard]] inline T* operator->() noexcept;
+
+        /// @brief Const overload of `operator->`.
+        [[nodiscard]] inline const T* operator->() const noexcept;
+
+    private:
+        static_assert(std::is_nothrow_destructible_v<T>,
+            "lazy_slot<T> requires T to be nothrow-destructible.");
+
+        enum state : std::uint8_t { empty, busy, ready };
+
+        /**
+        * @brief Slow path: builds the object through `build()` or waits for the thread that is.
+        *
+        * @param build Callable placement-constructing the object in `_value`.
+        */
+        template<typename Build>
+        T& init_slow(Build&& build);
+
+        union {
+            std::byte _none;        ///< Active member while no `T` lives here.
+            T _value;
+        };
+        std::atomic<std::uint8_t> _state{empty};
+    };
+
+    /// @cond etools_internal
+    template<typename U>
+    class lazy_slot<U&> {
+        static_assert(meta::always_false_v<U>,
+            "etools::memory::lazy_slot<T&> is disabled. Use `lazy_slot<std::remove_reference_t<T>>`.");
+    };
+
+    template<typename U>
+    class lazy_slot<U&&> {
+        static_assert(meta::always_false_v<U>,
+            "etools::memory::lazy_slot<T&&> is disabled. Use `lazy_slot<std::remove_reference_t<T>>`.");
+    };
+    /// @endcond
+
+} // namespace etools::memory
+
+#include "lazy_slot.tpp"
+#endif // ETOOLS_MEMORY_LAZY_SLOT_HPP_
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file lazy_slot.tpp
+*
+* @brief Definition of lazy_slot.hpp methods.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_MEMORY_LAZY_SLOT_TPP_
+#define ETOOLS_MEMORY_LAZY_SLOT_TPP_
+#include "lazy_slot.hpp"
+#include <cassert>
+#include <functional>
+#include <memory>
+#include <new>
+#include <thread>
+#include <utility>
+
+namespace etools::memory {
+
+    namespace details {
+        /// @brief Publishes the builder's outcome: `ready` once committed, otherwise back to `empty`.
+        struct lazy_publish {
+            std::atomic<std::uint8_t>& state;
+            std::uint8_t outcome;
+
+            ~lazy_publish() { state.store(outcome, std::memory_order_release); }
+        };
+    } // namespace details
+
+    template<typename T>
+    constexpr lazy_slot<T>::lazy_slot() noexcept : _none{} {}
+
+    template<typename T>
+    inline lazy_slot<T>::~lazy_slot() {
+        if (_state.load(std::memory_order_acquire) == ready) _value.~T();
+    }
+
+    template<typename T>
+    template<typename Build>
+    T& lazy_slot<T>::init_slow(Build&& build) {
+        for (;;) {
+            std::uint8_t seen = empty;
+            if (_state.compare_exchange_strong(seen, busy, std::memory_order_acquire, std::memory_order_acquire)) {
+                // If `build` throws, the guard hands the slot back as empty for the next caller.
+                details::lazy_publish publish{_state, empty};
+                build();
+                publish.outcome = ready;
+                return _value;
+            }
+            if (seen == ready) return _value;
+            while (_state.load(std::memory_order_acquire) == busy) std::this_thread::yield();
+        }
+    }
+
+    template<typename T>
+    template<typename... Args>
+    inline T& lazy_slot<T>::get_or_emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args&&...>) {
+        static_assert(std::is_constructible_v<T, Args&&...>, "T must be constructible with the forwarded arguments.");
+        if (_state.load(std::memory_order_acquire) == ready) return _value;
+        return init_slow([&] { ::new (static_cast<void*>(std::addressof(_value))) T(std::forward<Args>(args)...); });
+    }
+
+    template<typename T>
+    template<typename F>
+    inline T& lazy_slot<T>::get_or_init(F&& make) {
+        if (_state.load(std::memory_order_acquire) == ready) return _value;
+        return init_slow([&] { ::new (static_cast<void*>(std::addressof(_value))) T(std::invoke(std::forward<F>(make))); });
+    }
+
+    template<typename T>
+    inline bool lazy_slot<T>::has_value() const noexcept {
+        return _state.load(std::memory_order_acquire) == ready;
+    }
+
+    template<typename T>
+    inline lazy_slot<T>::operator bool() const noexcept {
+        return has_value();
+    }
+
+    template<typename T>
+    inline T& lazy_slot<T>::operator*() noexcept {
+        assert(has_value() && "lazy_slot::operator*(): the object has not been built.");
+        return _value;
+    }
+
+    template<typename T>
+    inline const T& lazy_slot<T>::operator*() const noexcept {
+        assert(has_value() && "lazy_slot::operator*(): the object has not been built.");
+        return _value;
+    }
+
+    template<typename T>
+    inline T* lazy_slot<T>::operator->() noexcept {
+        assert(has_value() && "lazy_slot::operator->(): the object has not been built.");
+        return std::addressof(_value);
+    }
+
+    template<typename T>
+    inline const T* lazy_slot<T>::operator->() const noexcept {
+        assert(has_value() && "lazy_slot::operator->(): the object has not been built.");
+        return std::addressof(_value);
+    }
+
+} // namespace etools::memory
+
+#endif // ETOOLS_MEMORY_LAZY_SLOT_TPP_
@@ -0,0 +1,302 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file lz.hpp
+*
+* @brief LZ4-class byte compression for packed buffers: a block codec and a
+*        streaming record frame.
+*
+* @ingroup etools_memory etools::memory
+*
+* @details
+* `buffer::pack` output is flat and repetitive: the same field layout,
+* slowly changing timestamps and identifiers, zero padding in wide integers.
+* A greedy LZ77 coder with a single hash probe per position removes most of
+* that at memory-like speed.
+*
+* **Block codec**
+* - `lz_compress` / `lz_decompress` produce and read the LZ4 *block* format:
+*   a token byte (literal length, match length), the literals, a 16-bit
+*   little-endian offset, and 255-chained length extensions. Any LZ4 block
+*   decoder reads the output.
+* - The only working memory is an `lz_table`, a caller-provided array of
+*   `uint32_t` cells (a `std::array`, static storage or arena memory). It is
+*   never cleared: stale cells are checked against the current position and
+*   the bytes they point at, so reusing one table for many small buffers
+*   costs nothing per call.
+* - Decompression checks every length and offset against both ranges and
+*   returns `std::nullopt` on malformed input. It may write scratch bytes
+*   past the decoded size, up to `capacity`.
+*
+* **Frame (streaming record log)**
+* - `lz_frame_writer<Sink>` stages records (`[u32 length][bytes]`) in a
+*   caller-provided block. Each full block is compressed and handed to the
+*   sink, or stored raw if it does not shrink.
+* - `lz_frame_reader` walks a frame and yields each record as a
+*   `buffer_view` into its scratch block, or into the frame for raw blocks.
+* - Layout: `"ETLZ"`, u32 block size, then blocks as `u32 word, payload`
+*   (bit 31 set = stored raw, low 31 bits = payload size), ended by a zero
+*   word. All integers are little-endian. Blocks are independent, so a
+*   reader can start at any block.
+*
+* **Example**
+* @code
+* #include "etools/memory/lz.hpp"
+* using namespace etools::memory;
+*
+* std::array<std::uint32_t, 4096> cells;                  // 16 KiB hash table
+* buffer out{std::make_unique<std::byte[]>(lz_compress_bound(in.size())), lz_compress_bound(in.size())};
+* lz_compress(in, out, lz_table{cells});                   // out.size() = compressed bytes
+*
+* buffer back{std::make_unique<std::byte[]>(in.size()), in.size()};
+* if (auto n = lz_decompress(buffer_view{out.data(), out.size()}, back)) { ... }
+* @endcode
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_MEMORY_LZ_HPP_
+#define ETOOLS_MEMORY_LZ_HPP_
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include "buffer.hpp"
+#include "buffer_view.hpp"
+
+namespace etools::memory {
+
+    /**
+    * @brief Non-owning view of the compressor's hash table.
+    *
+    * Cells hold positions of recently seen 4-byte sequences. More cells find
+    * more matches in larger inputs; 4096 (16 KiB, L1-resident) suits blocks up
+    * to a few hundred KiB.
+    *
+    * @invariant `cells` points to `1 << bits` cells, `8 <= bits <= 20`.
+    */
+    class lz_table {
+    public:
+        /**
+        * @brief Views `count` cells at `cells`.
+        *
+        * @pre `count` is a power of two in `[256, 1 << 20]`; the cells may hold any values.
+        */
+        inline lz_table(std::uint32_t* cells, std::size_t count) noexcept;
+
+        /**
+        * @brief Views a `std::array` of cells.
+        *
+        * @tparam Count Power of two in `[256, 1 << 20]`.
+        */
+        template<std::size_t Count>
+        explicit lz_table(std::array<std::uint32_t, Count>& cells) noexcept;
+
+        /// @brief First cell.
+        [[nodiscard]] inline std::uint32_t* cells() const noexcept;
+
+        /// @brief `log2` of the cell count.
+        [[nodiscard]] inline std::uint8_t bits() const noexcept;
+
+    private:
+        std::uint32_t* _cells;
+        std::uint8_t _bits;
+    };
+
+    /**
+    * @brief Worst-case compressed size of `size` input bytes (incompressible data).
+    */
+    [[nodiscard]] constexpr std::size_t lz_compress_bound(std::size_t size) noexcept;
+
+    /**
+    * @brief Compresses `size` bytes into one LZ4 block.
+    *
+    * @param[in]  src      Input bytes.
+    * @param[in]  size     Input length, below 2 GiB.
+    * @param[out] dst      Output block.
+    * @param[in]  capacity Bytes available at `dst`; `lz_compress_bound(size)` always suffices.
+    * @param[in]  table    Hash table; its contents need not be initialised.
+    * @return Compressed size, or `0` if it does not fit in `capacity`.
+    */
+    [[nodiscard]] inline std::size_t lz_compress(const std::byte* src, std::size_t size,
+                                                 std::byte* dst, std::size_t capacity, lz_table table) noexcept;
+
+    /**
+    * @brief Decompresses one LZ4 block.
+    *
+    * @param[in]  src      Compressed block.
+    * @param[in]  size     Block length.
+    * @param[out] dst      Output bytes.
+    * @param[in]  capacity Bytes available at `dst`.
+    * @return Decompressed size, or `std::nullopt` if the block is malformed or does not fit.
+    *
+    * @note Bytes of `dst` past the returned size, up to `capacity`, may be overwritten.
+    */
+    [[nodiscard]] inline std::optional<std::size_t> lz_decompress(const std::byte* src, std::size_t size,
+                                                                  std::byte* dst, std::size_t capacity) noexcept;
+
+    /**
+    * @brief Compresses a viewed range into `out`, replacing its contents.
+    *
+    * @return Compressed size, also `out.size()`; `0` (and `out.size() == 0`) if it does not fit.
+    */
+    template<typename Deleter>
+    inline std::size_t lz_compress(buffer_view in, buffer<Deleter>& out, lz_table table) noexcept;
+
+    /**
+    * @brief Compresses the used bytes of `in` into `out`, replacing its contents.
+    */
+    template<typename InDeleter, typename OutDeleter>
+    inline std::size_t lz_compress(const buffer<InDeleter>& in, buffer<OutDeleter>& out, lz_table table) noexcept;
+
+    /**
+    * @brief Decompresses a viewed block into `out`, replacing its contents.
+    *
+    * @return Decompressed size, also `out.size()`; `std::nullopt` (and `out.size() == 0`) on failure.
+    */
+    template<typename Deleter>
+    inline std::optional<std::size_t> lz_decompress(buffer_view in, buffer<Deleter>& out) noexcept;
+
+    /**
+    * @brief Decompresses the used bytes of `in` into `out`, replacing its contents.
+    */
+    template<typename InDeleter, typename OutDeleter>
+    inline std::optional<std::size_t> lz_decompress(const buffer<InDeleter>& in, buffer<OutDeleter>& out) noexcept;
+
+    /**
+    * @brief Streaming writer of an `lz` record frame.
+    *
+    * @tparam Sink Callable as `sink(const std::byte* data, std::size_t size)`; receives
+    *              the frame in order, in pieces of arbitrary size.
+    *
+    * ```cpp
+    * std::vector<std::byte> file;
+    * std::vector<std::byte> scratch(lz_frame_writer_scratch(64 * 1024));
+    * lz_frame_writer w{[&](const std::byte* p, std::size_t n) { file.insert(file.end(), p, p + n); },
+    *                   lz_table{cells}, scratch.data(), 64 * 1024};
+    * w.write(buffer_view{rec.data(), rec.size()});
+    * w.finish();
+    * ```
+    *
+    * @note Not thread-safe; use one writer per stream.
+    */
+    template<typename Sink>
+    class lz_frame_writer {
+    public:
+        /**
+        * @brief Starts a frame and emits its header.
+        *
+        * @param[in] sink       Frame consumer.
+        * @param[in] table      Hash table for block compression.
+        * @param[in] scratch    `lz_frame_writer_scratch(block_size)` bytes, owned by the caller.
+        * @param[in] block_size Uncompressed block size; a record takes `4 + size` bytes of it.
+        *
+        * @pre `16 <= block_size < 2 GiB`.
+        */
+        inline lz_frame_writer(Sink sink, lz_table table, std::byte* scratch, std::size_t block_size) noexcept;
+
+        /**
+        * @brief Appends one record, emitting the current block first if the record does not fit.
+        *
+        * @return `false` (nothing written) if `4 + size` exceeds the block size or the frame is finished.
+        */
+        inline bool write(const std::byte* data, std::size_t size) noexcept;
+
+        /// @brief Appends the viewed bytes as one record.
+        inline bool write(buffer_view record) noexcept;
+
+        /// @brief Appends the used bytes of a buffer as one record.
+        template<typename Deleter>
+        inline bool write(const buffer<Deleter>& record) noexcept;
+
+        /// @brief Emits the staged records as a block, if any.
+        inline void flush() noexcept;
+
+        /// @brief Flushes and emits the end mark; later writes return `false`.
+        inline void finish() noexcept;
+
+        /// @brief Record bytes accepted so far, length prefixes included.
+        [[nodiscard]] inline std::uint64_t bytes_in() const noexcept;
+
+        /// @brief Frame bytes handed to the sink so far.
+        [[nodiscard]] inline std::uint64_t bytes_out() const noexcept;
+
+    private:
+        /// @brief Hands `size` bytes to the sink and counts them.
+        inline void emit(const std::byte* data, std::size_t size) noexcept;
+
+        Sink _sink;
+        lz_table _table;
+        std::byte* _block;        ///< Staged records, `_block_size` bytes.
+        std::byte* _packed;       ///< Block word and compressed payload.
+        std::size_t _block_size;
+        std::size_t _staged = 0;
+        std::uint64_t _in = 0;
+        std::uint64_t _out = 0;
+        bool _finished = false;
+    };
+
+    /**
+    * @brief Scratch bytes an `lz_frame_writer` needs for `block_size`-byte blocks.
+    */
+    [[nodiscard]] constexpr std::size_t lz_frame_writer_scratch(std::size_t block_size) noexcept;
+
+    /**
+    * @brief Reader of an `lz` record frame.
+    *
+    * Records are returned as views into the reader's scratch block (or into the
+    * frame itself for blocks stored raw) and stay valid until the next block is
+    * decoded, that is, until the call to `next()` that crosses a block boundary.
+    */
+    class lz_frame_reader {
+    public:
+        /**
+        * @brief Opens a frame.
+        *
+        * @param[in] frame        The whole frame, or a prefix of it.
+        * @param[in] scratch      Decoding block, owned by the caller.
+        * @param[in] scratch_size At least the frame's block size.
+        *
+        * @post `failed()` if the header is malformed or the scratch is too small.
+        */
+        inline lz_frame_reader(buffer_view frame, std::byte* scratch, std::size_t scratch_size) noexcept;
+
+        /**
+        * @brief Next record.
+        *
+        * @return The record, or `std::nullopt` at the end mark or on malformed input (see `failed()`).
+        */
+        [[nodiscard]] inline std::optional<buffer_view> next() noexcept;
+
+        /// @brief Whether the frame turned out malformed or truncated.
+        [[nodiscard]] inline bool failed() const noexcept;
+
+        /// @brief Uncompressed block size declared by the frame header.
+        [[nodiscard]] inline std::size_t block_size() const noexcept;
+
+    private:
+        /// @brief Decodes the next block into `_records`; `false` at the end mark or on error.
+        inline bool load_block() noexcept;
+
+        const std::byte* _frame;
+        std::size_t _frame_size;
+        std::size_t _pos = 0;           ///< Next block word in the frame.
+        std::byte* _scratch;
+        std::size_t _scratch_size;
+        std::size_t _block_size = 0;
+        const std::byte* _records = nullptr;
+        std::size_t _records_size = 0;
+        std::size_t _record_pos = 0;
+        bool _failed = false;
+        bool _ended = false;
+    };
+
+} // namespace etools::memory
+
+#include "lz.tpp"
+#endif // ETOOLS_MEMORY_LZ_HPP_
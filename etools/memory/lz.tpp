@@ -0,0 +1,401 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file lz.tpp
+*
+* @brief Definition of lz.hpp methods.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_MEMORY_LZ_TPP_
+#define ETOOLS_MEMORY_LZ_TPP_
+#include "lz.hpp"
+#include <cassert>
+#include <cstring>
+#include <utility>
+
+namespace etools::memory {
+
+    namespace details {
+
+        inline constexpr std::size_t lz_min_match = 4;      ///< Shortest encodable match.
+        inline constexpr std::size_t lz_last_literals = 5;  ///< A block ends with at least this many literals.
+        inline constexpr std::size_t lz_match_limit = 12;   ///< No match starts in the last 12 bytes.
+        inline constexpr std::size_t lz_max_offset = 65535;
+        inline constexpr unsigned lz_skip_trigger = 6;      ///< Misses before the search step grows.
+        inline constexpr std::uint32_t lz_frame_magic = 0x5A4C5445u; // "ETLZ" little-endian
+        inline constexpr std::uint32_t lz_raw_bit = 0x80000000u;
+
+        inline std::uint32_t lz_read32(const std::byte* p) noexcept {
+            std::uint32_t v;
+            std::memcpy(&v, p, sizeof v);
+            return v;
+        }
+
+        inline std::uint32_t lz_hash(const std::byte* p, std::uint8_t shift) noexcept {
+            return (lz_read32(p) * 2654435761u) >> shift;
+        }
+
+        inline std::uint32_t lz_load_le32(const std::byte* p) noexcept {
+            return static_cast<std::uint32_t>(p[0]) | static_cast<std::uint32_t>(p[1]) << 8
+                 | static_cast<std::uint32_t>(p[2]) << 16 | static_cast<std::uint32_t>(p[3]) << 24;
+        }
+
+        inline void lz_store_le32(std::byte* p, std::uint32_t v) noexcept {
+            for (int i = 0; i < 4; ++i) p[i] = static_cast<std::byte>(v >> (8 * i));
+        }
+
+        /// @brief Length of the common run of `p` and `m`, stopping at `limit` (for `p`).
+        inline std::size_t lz_common(const std::byte* p, const std::byte* m, const std::byte* limit) noexcept {
+            const std::byte* const start = p;
+        #if (defined(__GNUC__) || defined(__clang__)) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            while (limit - p >= 8) {
+                std::uint64_t a, b;
+                std::memcpy(&a, p, 8);
+                std::memcpy(&b, m, 8);
+                if (const std::uint64_t diff = a ^ b)
+                    return static_cast<std::size_t>(p - start) + static_cast<std::size_t>(__builtin_ctzll(diff)) / 8;
+                p += 8;
+                m += 8;
+            }
+        #endif
+            while (p < limit && *p == *m) { ++p; ++m; }
+            return static_cast<std::size_t>(p - start);
+        }
+
+        /// @brief Writes the 255-chained remainder of a length whose nibble saturated at 15.
+        inline std::byte* lz_put_length(std::byte* op, std::size_t rest) noexcept {
+            for (; rest >= 255; rest -= 255) *op++ = std::byte{255};
+            *op++ = static_cast<std::byte>(rest);
+            return op;
+        }
+
+        /// @brief Reads a 255-chained length extension onto `len`; `false` if the input ends first.
+        inline bool lz_get_length(const std::byte*& ip, const std::byte* iend, std::size_t& len) noexcept {
+            std::size_t b;
+            do {
+                if (ip == iend) return false;
+                b = static_cast<std::size_t>(*ip++);
+                len += b;
+            } while (b == 255);
+            return true;
+        }
+
+        /// @brief Emits literals `[anchor, anchor + lit)`, then a match unless `mlen == 0`.
+        inline std::byte* lz_put_sequence(std::byte* op, const std::byte* oend, const std::byte* anchor, const std::byte* iend,
+                                          std::size_t lit, std::size_t offset, std::size_t mlen) noexcept {
+            // Token, literal run with its extension, offset, match extension.
+            if (static_cast<std::size_t>(oend - op) < 1 + lit + lit / 255 + 1 + 2 + mlen / 255 + 1) return nullptr;
+            std::byte* const token = op++;
+            std::uint8_t t = lit >= 15 ? std::uint8_t{15 << 4} : static_cast<std::uint8_t>(lit << 4);
+            if (lit >= 15) op = lz_put_length(op, lit - 15);
+            if (lit <= 16 && iend - anchor >= 16 && oend - op >= 16)
+                std::memcpy(op, anchor, 16);        // short run: one fixed-size copy
+            else if (lit)                           // empty input: `anchor` may be null
+                std::memcpy(op, anchor, lit);
+            op += lit;
+            if (mlen) {
+                *op++ = static_cast<std::byte>(offset);
+                *op++ = static_cast<std::byte>(offset >> 8);
+                const std::size_t ml = mlen - lz_min_match;
+                t = static_cast<std::uint8_t>(t | (ml >= 15 ? 15u : ml));
+                if (ml >= 15) op = lz_put_length(op, ml - 15);
+            }
+            *token = static_cast<std::byte>(t);
+            return op;
+        }
+
+        /// @brief Copies a match of `mlen` bytes from `offset` back; may write up to `oend`.
+        inline void lz_copy_match(std::byte* op, std::size_t offset, std::size_t mlen, const std::byte* oend) noexcept {
+            const std::byte* m = op - offset;
+            if (offset >= 16 && static_cast<std::size_t>(oend - op) >= mlen + 16) {
+                // Whole 16-byte chunks: each source chunk is already written.
+                for (std::byte* const end = op + mlen; op < end; op += 16, m += 16) std::memcpy(op, m, 16);
+            } else if (offset >= mlen) {
+                std::memcpy(op, m, mlen);
+            } else {
+                for (std::size_t i = 0; i < mlen; ++i) op[i] = m[i];    // overlapping run
+            }
+        }
+
+    } // namespace details
+
+    inline lz_table::lz_table(std::uint32_t* cells, std::size_t count) noexcept
+        : _cells{cells}, _bits{0}
+    {
+        assert(count >= 256 && count <= (std::size_t{1} << 20) && (count & (count - 1)) == 0
+               && "lz_table: cell count must be a power of two in [256, 1 << 20]");
+        while ((std::size_t{1} << _bits) < count) ++_bits;
+    }
+
+    template<std::size_t Count>
+    lz_table::lz_table(std::array<std::uint32_t, Count>& cells) noexcept
+        : lz_table(cells.data(), Count)
+    {
+        static_assert(Count >= 256 && Count <= (std::size_t{1} << 20) && (Count & (Count - 1)) == 0,
+                      "lz_table: cell count must be a power of two in [256, 1 << 20]");
+    }
+
+    inline std::uint32_t* lz_table::cells() const noexcept {
+        return _cells;
+    }
+
+    inline std::uint8_t lz_table::bits() const noexcept {
+        return _bits;
+    }
+
+    constexpr std::size_t lz_compress_bound(std::size_t size) noexcept {
+        return size + size / 255 + 16;
+    }
+
+    inline std::size_t lz_compress(const std::byte* src, std::size_t size,
+                                   std::byte* dst, std::size_t capacity, lz_table table) noexcept {
+        using namespace details;
+        assert(size < (std::size_t{1} << 31) && "lz_compress: input must be below 2 GiB");
+        const std::byte* const iend = src + size;
+        const std::byte* const oend = dst + capacity;
+        const std::byte* anchor = src;
+        std::byte* op = dst;
+
+        if (size > lz_match_limit) {
+            const std::byte* const mflimit = iend - lz_match_limit;
+            const std::byte* const matchlimit = iend - lz_last_literals;
+            const std::uint8_t shift = static_cast<std::uint8_t>(32 - table.bits());
+            std::uint32_t* const cells = table.cells();
+            const auto pos = [src](const std::byte* p) { return static_cast<std::uint32_t>(p - src); };
+
+            cells[lz_hash(src, shift)] = 0;
+            const std::byte* ip = src + 1;
+            while (ip <= mflimit) {
+                // 1) Find a match: one probe per position, stepping faster after repeated misses.
+                //    Cells may be stale (other inputs): trust only earlier, in-range positions that verify.
+                const std::byte* ref = nullptr;
+                for (std::size_t attempts = std::size_t{1} << lz_skip_trigger;;) {
+                    std::uint32_t& cell = cells[lz_hash(ip, shift)];
+                    const std::uint32_t cand = cell, cur = pos(ip);
+                    cell = cur;
+                    if (cand < cur && cur - cand <= lz_max_offset && lz_read32(src + cand) == lz_read32(ip)) {
+                        ref = src + cand;
+                        break;
+                    }
+                    ip += attempts++ >> lz_skip_trigger;
+                    if (ip > mflimit) break;
+                }
+                if (!ref) break;
+
+                // 2) Extend backwards over pending literals, then forwards.
+                while (ip > anchor && ref > src && ip[-1] == ref[-1]) { --ip; --ref; }
+                const std::size_t mlen = lz_min_match + lz_common(ip + lz_min_match, ref + lz_min_match, matchlimit);
+
+                op = lz_put_sequence(op, oend, anchor, iend, static_cast<std::size_t>(ip - anchor),
+                                     static_cast<std::size_t>(ip - ref), mlen);
+                if (!op) return 0;
+                ip += mlen;
+                anchor = ip;
+                if (ip <= mflimit) cells[lz_hash(ip - 2, shift)] = pos(ip - 2);
+            }
+        }
+
+        op = lz_put_sequence(op, oend, anchor, iend, static_cast<std::size_t>(iend - anchor), 0, 0);
+        return op ? static_cast<std::size_t>(op - dst) : 0;
+    }
+
+    inline std::optional<std::size_t> lz_decompress(const std::byte* src, std::size_t size,
+                                                    std::byte* dst, std::size_t capacity) noexcept {
+        using namespace details;
+        const std::byte* ip = src;
+        const std::byte* const iend = src + size;
+        std::byte* op = dst;
+        const std::byte* const oend = dst + capacity;
+        if (size == 0) return std::nullopt;
+
+        for (;;) {
+            const auto token = static_cast<std::size_t>(*ip++);
+            std::size_t lit = token >> 4;
+            if (lit == 15 && !lz_get_length(ip, iend, lit)) return std::nullopt;
+            const auto in_left = static_cast<std::size_t>(iend - ip);
+            const auto out_left = static_cast<std::size_t>(oend - op);
+            if (lit > in_left || lit > out_left) return std::nullopt;
+            if (lit <= 16 && in_left >= 16 && out_left >= 16) std::memcpy(op, ip, 16);  // short runs: one fixed copy
+            else if (lit) std::memcpy(op, ip, lit);        // pointers of an empty view may be null
+            ip += lit;
+            op += lit;
+            if (ip == iend) break;                          // the last sequence has no match
+
+            if (iend - ip < 2) return std::nullopt;
+            const std::size_t offset = static_cast<std::size_t>(ip[0]) | static_cast<std::size_t>(ip[1]) << 8;
+            ip += 2;
+            if (offset == 0 || offset > static_cast<std::size_t>(op - dst)) return std::nullopt;
+            std::size_t mlen = token & 15;
+            if (mlen == 15 && !lz_get_length(ip, iend, mlen)) return std::nullopt;
+            mlen += lz_min_match;
+            if (mlen > static_cast<std::size_t>(oend - op)) return std::nullopt;
+            lz_copy_match(op, offset, mlen, oend);
+            op += mlen;
+            if (ip == iend) return std::nullopt;            // a block must end with literals
+        }
+        return static_cast<std::size_t>(op - dst);
+    }
+
+    template<typename Deleter>
+    inline std::size_t lz_compress(buffer_view in, buffer<Deleter>& out, lz_table table) noexcept {
+        const std::size_t n = lz_compress(in.data(), in.size(), out.mutable_data(), out.capacity(), table);
+        out.resize(n);
+        return n;
+    }
+
+    template<typename InDeleter, typename OutDeleter>
+    inline std::size_t lz_compress(const buffer<InDeleter>& in, buffer<OutDeleter>& out, lz_table table) noexcept {
+        return lz_compress(buffer_view{in.data(), in.size()}, out, table);
+    }
+
+    template<typename Deleter>
+    inline std::optional<std::size_t> lz_decompress(buffer_view in, buffer<Deleter>& out) noexcept {
+        const auto n = lz_decompress(in.data(), in.size(), out.mutable_data(), out.capacity());
+        out.resize(n ? *n : 0);
+        return n;
+    }
+
+    template<typename InDeleter, typename OutDeleter>
+    inline std::optional<std::size_t> lz_decompress(const buffer<InDeleter>& in, buffer<OutDeleter>& out) noexcept {
+        return lz_decompress(buffer_view{in.data(), in.size()}, out);
+    }
+
+    constexpr std::size_t lz_frame_writer_scratch(std::size_t block_size) noexcept {
+        return block_size + 4 + lz_compress_bound(block_size);
+    }
+
+    template<typename Sink>
+    inline lz_frame_writer<Sink>::lz_frame_writer(Sink sink, lz_table table, std::byte* scratch, std::size_t block_size) noexcept
+        : _sink{std::move(sink)}, _table{table}, _block{scratch}, _packed{scratch + block_size}, _block_size{block_size}
+    {
+        assert(block_size >= 16 && block_size < details::lz_raw_bit && "lz_frame_writer: block size out of range");
+        std::byte header[8];
+        details::lz_store_le32(header, details::lz_frame_magic);
+        details::lz_store_le32(header + 4, static_cast<std::uint32_t>(block_size));
+        emit(header, sizeof header);
+    }
+
+    template<typename Sink>
+    inline void lz_frame_writer<Sink>::emit(const std::byte* data, std::size_t size) noexcept {
+        _sink(data, size);
+        _out += size;
+    }
+
+    template<typename Sink>
+    inline bool lz_frame_writer<Sink>::write(const std::byte* data, std::size_t size) noexcept {
+        if (_finished || size > _block_size - 4) return false;
+        if (_staged + 4 + size > _block_size) flush();
+        details::lz_store_le32(_block + _staged, static_cast<std::uint32_t>(size));
+        if (size) std::memcpy(_block + _staged + 4, data, size);
+        _staged += 4 + size;
+        _in += 4 + size;
+        return true;
+    }
+
+    template<typename Sink>
+    inline bool lz_frame_writer<Sink>::write(buffer_view record) noexcept {
+        return write(record.data(), record.size());
+    }
+
+    template<typename Sink>
+    template<typename Deleter>
+    inline bool lz_frame_writer<Sink>::write(const buffer<Deleter>& record) noexcept {
+        return write(record.data(), record.size());
+    }
+
+    template<typename Sink>
+    inline void lz_frame_writer<Sink>::flush() noexcept {
+        if (_staged == 0) return;
+        const std::size_t n = lz_compress(_block, _staged, _packed + 4, lz_compress_bound(_block_size), _table);
+        if (n != 0 && n < _staged) {
+            details::lz_store_le32(_packed, static_cast<std::uint32_t>(n));
+            emit(_packed, 4 + n);
+        } else {                                            // did not shrink: store raw
+            std::byte word[4];
+            details::lz_store_le32(word, static_cast<std::uint32_t>(_staged) | details::lz_raw_bit);
+            emit(word, sizeof word);
+            emit(_block, _staged);
+        }
+        _staged = 0;
+    }
+
+    template<typename Sink>
+    inline void lz_frame_writer<Sink>::finish() noexcept {
+        if (_finished) return;
+        flush();
+        const std::byte end[4] = {};
+        emit(end, sizeof end);
+        _finished = true;
+    }
+
+    template<typename Sink>
+    inline std::uint64_t lz_frame_writer<Sink>::bytes_in() const noexcept {
+        return _in;
+    }
+
+    template<typename Sink>
+    inline std::uint64_t lz_frame_writer<Sink>::bytes_out() const noexcept {
+        return _out;
+    }
+
+    inline lz_frame_reader::lz_frame_reader(buffer_view frame, std::byte* scratch, std::size_t scratch_size) noexcept
+        : _frame{frame.data()}, _frame_size{frame.size()}, _scratch{scratch}, _scratch_size{scratch_size}
+    {
+        if (_frame_size < 8 || details::lz_load_le32(_frame) != details::lz_frame_magic) { _failed = true; return; }
+        _block_size = details::lz_load_le32(_frame + 4);
+        _failed = _block_size > _scratch_size;
+        _pos = 8;
+    }
+
+    inline bool lz_frame_reader::load_block() noexcept {
+        if (_frame_size - _pos < 4) { _failed = true; return false; }
+        const std::uint32_t word = details::lz_load_le32(_frame + _pos);
+        _pos += 4;
+        if (word == 0) { _ended = true; return false; }
+        const std::size_t n = word & ~details::lz_raw_bit;
+        if (n > _frame_size - _pos) { _failed = true; return false; }
+        if (word & details::lz_raw_bit) {
+            if (n > _block_size) { _failed = true; return false; }
+            _records = _frame + _pos;
+            _records_size = n;
+        } else {
+            const auto size = lz_decompress(_frame + _pos, n, _scratch, _block_size);
+            if (!size) { _failed = true; return false; }
+            _records = _scratch;
+            _records_size = *size;
+        }
+        _pos += n;
+        _record_pos = 0;
+        return true;
+    }
+
+    inline std::optional<buffer_view> lz_frame_reader::next() noexcept {
+        while (!_failed && !_ended && _record_pos == _records_size)
+            if (!load_block()) return std::nullopt;
+        if (_failed || _ended) return std::nullopt;
+        if (_records_size - _record_pos < 4) { _failed = true; return std::nullopt; }
+        const std::size_t n = details::lz_load_le32(_records + _record_pos);
+        if (n > _records_size - _record_pos - 4) { _failed = true; return std::nullopt; }
+        const buffer_view record{_records + _record_pos + 4, n};
+        _record_pos += 4 + n;
+        return record;
+    }
+
+    inline bool lz_frame_reader::failed() const noexcept {
+        return _failed;
+    }
+
+    inline std::size_t lz_frame_reader::block_size() const noexcept {
+        return _block_size;
+    }
+
+} // namespace etools::memory
+
+#endif // ETOOLS_MEMORY_LZ_TPP_
@@ -19,5 +19,10 @@
 #define ETOOLS_MEMORY_MEMORY_HPP_
 #include "buffer.hpp"
 #include "buffer_view.hpp"
+#include "lazy_slot.hpp"
+#include "lz.hpp"
 #include "slot.hpp"
+#include "soa_vector.hpp"
+#include "tracking_resource.hpp"
+#include "varint.hpp"
 #endif // ETOOLS_MEMORY_MEMORY_HPP_
\ No newline at end of file
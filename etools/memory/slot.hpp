@@ -67,13 +67,19 @@
 *      - Documented why `slot` exists alongside `std::optional`: it is a blueprint for a
 *        future pool slot. Noted that the `_constructed` flag is only needed by a standalone
 *        slot and is the part a pool (external occupancy tracking) would drop.
+* - 2026-10-18
+*      - Capability fast paths (`meta/capabilities.hpp`): relocatable types move by
+*        `memcpy` without destroying the source; `emplace()` on an engaged slot calls
+*        `T::reinit(args...)` when available instead of destroy + construct.
 */
 
 #ifndef ETOOLS_MEMORY_SLOT_HPP_
 #define ETOOLS_MEMORY_SLOT_HPP_
 #include "../meta/traits.hpp"   // etools::meta::always_false_v
+#include "../meta/capabilities.hpp" // etools::meta::is_relocatable_v, is_reinitializable_v
 #include <cassert>
 #include <cstddef>
+#include <cstring>
 #include <new>
 #include <type_traits>
 #include <utility>
@@ -86,6 +92,19 @@ static_assert(__cpp_lib_launder >= 201606L,
 namespace etools::memory {
 
     namespace details {
+        template <typename T, typename... Args>
+        constexpr bool nothrow_reinit() noexcept {
+            if constexpr (meta::is_reinitializable_v<T, Args...>)
+                return noexcept(std::declval<T&>().reinit(std::declval<Args>()...));
+            else
+                return true;
+        }
+
+        /// @brief `noexcept` specification of `slot<T>::emplace(Args...)`.
+        template <typename T, typename... Args>
+        inline constexpr bool nothrow_emplace_v =
+            std::is_nothrow_constructible_v<T, Args...> && nothrow_reinit<T, Args...>();
+
         /**
         * @brief Storage, lifecycle, and (custom) move logic for `slot<T>`.
         *
@@ -110,6 +129,10 @@ namespace etools::memory {
             alignas(T) std::byte _mem[sizeof(T)];
             bool _constructed = false;
 
+            /// @brief Moving never throws for relocatable `T` (bytes only).
+            static constexpr bool nothrow_relocate =
+                meta::is_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>;
+
             slot_base() noexcept = default;
 
             ~slot_base() noexcept { reset(); }
@@ -117,23 +140,35 @@ namespace etools::memory {
             slot_base(const slot_base&) = delete;
             slot_base& operator=(const slot_base&) = delete;
 
-            slot_base(slot_base&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
-                if (other._constructed) {
-                    ::new (static_cast<void*>(&_mem)) T(std::move(*other.ptr()));
-                    _constructed = true;
-                    other.reset();
-                }
+            slot_base(slot_base&& other) noexcept(nothrow_relocate) {
+                if (other._constructed) relocate_from(other);
             }
 
-            slot_base& operator=(slot_base&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+            slot_base& operator=(slot_base&& other) noexcept(nothrow_relocate) {
                 if (this == &other) return *this;
                 reset();
-                if (other._constructed) {
+                if (other._constructed) relocate_from(other);
+                return *this;
+            }
+
+            /**
+            * @brief Moves the object out of the engaged `other` into this (empty) slot.
+            *
+            * Relocatable types (`meta::is_relocatable_v`) are moved by copying their
+            * bytes; `other` is then disengaged *without* running `~T()`, since the
+            * object now lives here. Other types are move-constructed and the source
+            * destroyed.
+            */
+            void relocate_from(slot_base& other) noexcept(nothrow_relocate) {
+                if constexpr (meta::is_relocatable_v<T>) {
+                    std::memcpy(static_cast<void*>(&_mem), static_cast<const void*>(&other._mem), sizeof(T));
+                    _constructed = true;
+                    other._constructed = false;
+                } else {
                     ::new (static_cast<void*>(&_mem)) T(std::move(*other.ptr()));
                     _constructed = true;
                     other.reset();
                 }
-                return *this;
             }
 
             /// @brief Laundered typed pointer into the buffer (no engaged check).
@@ -255,10 +290,15 @@ namespace etools::memory {
         *       is unknown.
         * @note Strong guarantee on the *new* object: the old object is destroyed first,
         *       then if `T`'s constructor throws the slot is left empty.
-        * @note The function is `noexcept` iff `T`'s selected constructor is `noexcept`.
+        * @note If the slot is engaged and `T` exposes `reinit(args...)`
+        *       (`meta::is_reinitializable_v<T, Args&&...>`), the live object is
+        *       recycled in place with that call instead of being destroyed and
+        *       rebuilt.
+        * @note The function is `noexcept` iff `T`'s selected constructor is `noexcept`
+        *       (and, when used, so is `reinit`).
         */
         template<typename... Args>
-        inline T& emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args&&...>);
+        inline T& emplace(Args&&... args) noexcept(details::nothrow_emplace_v<T, Args&&...>);
 
         /**
         * @brief Destroys the currently constructed object, if any.
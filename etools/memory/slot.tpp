@@ -29,6 +29,9 @@
 *      - API trim: removed `construct()` and the `get()` accessors; renamed
 *        `destroy()` to `reset()`; `emplace()` now returns `T&`. `reset()`
 *        forwards to `details::slot_base<T>::reset()`.
+* - 2026-10-18
+*      - `emplace()` recycles an engaged object through `T::reinit(args...)` when
+*        `meta::is_reinitializable_v<T, Args&&...>`.
 */
 
 #ifndef ETOOLS_MEMORY_SLOT_TPP_
@@ -39,8 +42,14 @@ namespace etools::memory {
 
     template <typename T>
     template <typename... Args>
-    inline T &slot<T>::emplace(Args &&...args) noexcept(std::is_nothrow_constructible_v<T, Args &&...>){
+    inline T &slot<T>::emplace(Args &&...args) noexcept(details::nothrow_emplace_v<T, Args &&...>){
         static_assert(std::is_constructible_v<T, Args&&...>, "T must be constructible with the forwarded arguments.");
+        if constexpr (meta::is_reinitializable_v<T, Args&&...>) {
+            if (this->_constructed) {
+                this->ptr()->reinit(std::forward<Args>(args)...);
+                return *this->ptr();
+            }
+        }
         this->reset();
         // Construct first; only mark engaged on success. If T's constructor throws,
         // the slot remains empty rather than claiming to hold a half-built object.
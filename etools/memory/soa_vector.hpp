@@ -0,0 +1,535 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file soa_vector.hpp
+*
+* @brief Structure-of-arrays container generated from a `meta::typelist`.
+*
+* @ingroup etools_memory etools::memory
+*
+* `soa_vector<typelist<Ts...>>` stores every component type `Ts` in its own
+* contiguous column instead of interleaving them as records. Loops that touch
+* only one or two fields per row then stream exactly the bytes they use; with
+* an array-of-structs layout most of every fetched cache line is thrown away.
+*
+* ### Modes
+* - **Fixed capacity** (`soa_vector<typelist<Ts...>, N>`): all columns live
+*   inline in the object, no allocation ever happens. `emplace_back` reports a
+*   full container by returning `false`, mirroring `dispatch_factory::emplace`
+*   returning an empty handle when its slots are exhausted.
+* - **Growable** (`soa_vector<typelist<Ts...>>`, i.e. `Capacity == soa_dynamic`):
+*   columns are heap blocks that grow geometrically, obtained from a
+*   `std::pmr::memory_resource` (the default resource unless one is passed to
+*   the constructor, e.g. a `tracking_resource` to attribute the bytes to a
+*   subsystem). Intended for host-side tooling and for targets that do have a
+*   heap; embedded hot paths should use the fixed mode.
+*
+* ### Access surface
+* - `operator[](i)` / `front()` / `back()` return a *proxy row*: a
+*   `std::tuple<Ts&...>` of references into the columns (structured bindings
+*   and `std::get` both work).
+* - `column<I>()` returns a `soa_column<T>` view (pointer + length) over one
+*   column; `data<I>()` returns the raw pointer. Columns are aligned to at
+*   least `soa_column_alignment` bytes so that the view can be handed to SIMD
+*   loops directly.
+* - `zip<Is...>()` returns an iterable view yielding `std::tuple<T&...>` for the
+*   selected columns only (all columns when `Is...` is empty).
+*
+* ### Example
+* @code
+* #include "etools/memory/soa_vector.hpp"
+* using namespace etools;
+*
+* memory::soa_vector<meta::typelist<float, float, std::uint32_t>, 1024> particles;
+* particles.emplace_back(1.0f, 2.0f, 7u);
+*
+* for (float& x : particles.column<0>()) x += 1.0f;     // single-column scan
+* for (auto [x, id] : particles.zip<0, 2>()) { ... }     // two-column scan
+* auto [x, y, id] = particles[0];                          // proxy row
+* @endcode
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_MEMORY_SOA_VECTOR_HPP_
+#define ETOOLS_MEMORY_SOA_VECTOR_HPP_
+#include "../meta/typelist.hpp" // meta::typelist
+#include "../meta/traits.hpp"   // meta::nth_t, meta::always_false_v
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace etools::memory {
+
+    /**
+    * @brief Capacity tag selecting the growable (heap-backed) `soa_vector` mode.
+    */
+    inline constexpr std::size_t soa_dynamic = std::numeric_limits<std::size_t>::max();
+
+    /**
+    * @brief Minimum alignment, in bytes, of every `soa_vector` column.
+    *
+    * One cache line on the targets we care about; also satisfies the aligned
+    * load requirements of SSE/AVX/NEON for element types up to 64 bytes.
+    */
+    inline constexpr std::size_t soa_column_alignment = 64;
+
+    /**
+    * @class soa_column
+    * @brief Non-owning, contiguous view over one `soa_vector` column.
+    *
+    * A minimal stand-in for C++20 `std::span<T>`: a pointer and a length with
+    * iteration and indexing. Mutating through the view mutates the column.
+    *
+    * @tparam T Element type (may be `const`-qualified).
+    *
+    * @warning The view is invalidated by any operation that reallocates the
+    *          owning container (growable mode) or changes its size.
+    */
+    template<typename T>
+    class soa_column {
+    public:
+        using element_type = T;
+        using iterator = T*;
+
+        /// @brief Constructs a view over `[data, data + size)`.
+        constexpr soa_column(T* data, std::size_t size) noexcept : _data{data}, _size{size} {}
+
+        /// @brief Pointer to the first element (may be `nullptr` when empty).
+        [[nodiscard]] constexpr T* data() const noexcept { return _data; }
+        /// @brief Number of elements in the view.
+        [[nodiscard]] constexpr std::size_t size() const noexcept { return _size; }
+        /// @brief `true` iff the view is empty.
+        [[nodiscard]] constexpr bool empty() const noexcept { return _size == 0; }
+        /// @brief Unchecked element access.
+        [[nodiscard]] constexpr T& operator[](std::size_t i) const noexcept { return _data[i]; }
+        /// @brief Iterator to the first element.
+        [[nodiscard]] constexpr iterator begin() const noexcept { return _data; }
+        /// @brief Iterator one past the last element.
+        [[nodiscard]] constexpr iterator end() const noexcept { return _data + _size; }
+    private:
+        T* _data;
+        std::size_t _size;
+    };
+
+    /**
+    * @class soa_zip
+    * @brief Iterable view that walks several columns in lock-step.
+    *
+    * Dereferencing the iterator yields `std::tuple<Us&...>` where `Us...` are the
+    * (possibly `const`) element types of the zipped columns.
+    *
+    * @tparam Us Element types of the zipped columns.
+    */
+    template<typename... Us>
+    class soa_zip {
+    public:
+        /**
+        * @brief Forward iterator over the zipped rows.
+        */
+        class iterator {
+        public:
+            using value_type = std::tuple<Us&...>;
+            using reference = std::tuple<Us&...>;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+
+            constexpr explicit iterator(std::tuple<Us*...> cols) noexcept : _cols{cols} {}
+
+            [[nodiscard]] constexpr reference operator*() const noexcept {
+                return std::apply([](Us*... p) noexcept { return reference{*p...}; }, _cols);
+            }
+            constexpr iterator& operator++() noexcept {
+                std::apply([](Us*&... p) noexcept { (++p, ...); }, _cols);
+                return *this;
+            }
+            constexpr iterator operator++(int) noexcept { iterator t = *this; ++*this; return t; }
+            // Every column advances in lock-step, so the first pointer identifies the row.
+            [[nodiscard]] constexpr bool operator==(const iterator& o) const noexcept { return std::get<0>(_cols) == std::get<0>(o._cols); }
+            [[nodiscard]] constexpr bool operator!=(const iterator& o) const noexcept { return !(*this == o); }
+        private:
+            std::tuple<Us*...> _cols;
+        };
+
+        /// @brief Constructs a view over the first `size` rows of the given columns.
+        constexpr soa_zip(std::tuple<Us*...> cols, std::size_t size) noexcept : _cols{cols}, _size{size} {}
+
+        /// @brief Number of rows in the view.
+        [[nodiscard]] constexpr std::size_t size() const noexcept { return _size; }
+        /// @brief Iterator to the first row.
+        [[nodiscard]] constexpr iterator begin() const noexcept { return iterator{_cols}; }
+        /// @brief Iterator one past the last row.
+        [[nodiscard]] constexpr iterator end() const noexcept {
+            return iterator{std::apply([this](Us*... p) noexcept { return std::tuple<Us*...>{(p + _size)...}; }, _cols)};
+        }
+    private:
+        std::tuple<Us*...> _cols;
+        std::size_t _size;
+    };
+
+    namespace details {
+        /**
+        * @brief Alignment actually used for a column of `T`.
+        */
+        template<typename T>
+        inline constexpr std::size_t soa_align_v =
+            alignof(T) > soa_column_alignment ? alignof(T) : soa_column_alignment;
+
+        /**
+        * @brief Raw, uninitialized storage for one column.
+        *
+        * The primary template is the fixed-capacity mode: `Capacity` elements worth
+        * of inline bytes. Objects are created/destroyed by `soa_vector` itself.
+        *
+        * @tparam T        Element type.
+        * @tparam Capacity Number of elements, or `soa_dynamic`.
+        */
+        template<typename T, std::size_t Capacity>
+        struct soa_column_storage {
+            alignas(soa_align_v<T>) std::byte _mem[sizeof(T) * Capacity];
+
+            /// @brief User-provided so value-initialization does not zero-fill the column.
+            soa_column_storage() noexcept {}
+
+            T* ptr() noexcept { return std::launder(reinterpret_cast<T*>(&_mem)); }
+            const T* ptr() const noexcept { return std::launder(reinterpret_cast<const T*>(&_mem)); }
+        };
+
+        /**
+        * @brief Growable-mode column storage: an over-aligned block from a memory resource.
+        */
+        template<typename T>
+        struct soa_column_storage<T, soa_dynamic> {
+            T* _ptr = nullptr;
+
+            T* ptr() noexcept { return _ptr; }
+            const T* ptr() const noexcept { return _ptr; }
+
+            /// @brief A block of `n` rows. @pre `n * sizeof(T)` does not overflow (checked by `regrow`).
+            static T* allocate(std::pmr::memory_resource* r, std::size_t n) {
+                return static_cast<T*>(r->allocate(n * sizeof(T), soa_align_v<T>));
+            }
+            /// @brief Releases a block of `n` rows; `p == nullptr` is a no-op.
+            static void deallocate(std::pmr::memory_resource* r, T* p, std::size_t n) noexcept {
+                if (p) r->deallocate(p, n * sizeof(T), soa_align_v<T>);
+            }
+        };
+
+        /**
+        * @brief Growable-mode bookkeeping: allocated rows and the resource the blocks
+        *        come from. Empty in fixed mode, so an inline container carries only its
+        *        columns and its size.
+        */
+        template<bool Dynamic>
+        struct soa_growth {};
+
+        template<>
+        struct soa_growth<true> {
+            /// @brief Allocated row count.
+            std::size_t _capacity{0};
+
+            /// @brief Source of the column blocks.
+            std::pmr::memory_resource* _resource{std::pmr::get_default_resource()};
+        };
+
+        /**
+        * @brief Moves the first `rows` elements of a growable column into `fresh`, then
+        *        releases the old block of `old_rows` rows and adopts `fresh`.
+        */
+        template<typename T>
+        void soa_relocate(soa_column_storage<T, soa_dynamic>& col, T* fresh, std::size_t rows,
+                          std::size_t old_rows, std::pmr::memory_resource* r) noexcept {
+            for (std::size_t i = 0; i < rows; ++i) {
+                ::new (static_cast<void*>(fresh + i)) T(std::move(col._ptr[i]));
+                col._ptr[i].~T();
+            }
+            col.deallocate(r, col._ptr, old_rows);
+            col._ptr = fresh;
+        }
+
+        /**
+        * @brief Rolls back a partly built row: destroys its first `built` columns unless
+        *        `built` is reset to `0`.
+        */
+        template<typename... Ts>
+        struct soa_row_guard {
+            const std::tuple<Ts*...>& cols;
+            std::size_t row;
+            std::size_t built = 0;
+
+            ~soa_row_guard() {
+                std::size_t i = 0;
+                std::apply([this, &i](Ts*... p) noexcept {
+                    ((i++ < built ? p[row].~Ts() : void()), ...);
+                }, cols);
+            }
+        };
+
+        /**
+        * @brief Constructs row `row` of the columns `cols`, column `I` from `args[I]`.
+        *        If a constructor throws, the columns already built are destroyed.
+        */
+        template<typename... Ts, typename... Args>
+        void soa_construct_row(const std::tuple<Ts*...>& cols, std::size_t row, Args&&... args) {
+            if constexpr ((std::is_nothrow_constructible_v<Ts, Args&&> and ...)) {
+                std::apply([row, &args...](Ts*... p) noexcept {
+                    (::new (static_cast<void*>(p + row)) Ts(std::forward<Args>(args)), ...);
+                }, cols);
+            } else {
+                soa_row_guard<Ts...> guard{cols, row};
+                std::apply([row, &guard, &args...](Ts*... p) {
+                    ((::new (static_cast<void*>(p + row)) Ts(std::forward<Args>(args)), ++guard.built), ...);
+                }, cols);
+                guard.built = 0;
+            }
+        }
+    } // namespace details
+
+    /**
+    * @brief Primary template; only the `meta::typelist<Ts...>` specialization is defined.
+    *
+    * @tparam List     A `meta::typelist<Ts...>` of component types.
+    * @tparam Capacity Inline element count, or `soa_dynamic` for the growable mode.
+    */
+    template<typename List, std::size_t Capacity = soa_dynamic>
+    class soa_vector {
+        static_assert(meta::always_false_v<List>,
+            "etools::memory::soa_vector expects a meta::typelist<Ts...> of component types.");
+    };
+
+    /**
+    * @class soa_vector
+    * @brief Structure-of-arrays container: one contiguous column per component type.
+    *
+    * @tparam Ts       Component types, one column each. May repeat (columns are
+    *                  addressed by index, not by type).
+    * @tparam Capacity Inline element count, or `soa_dynamic` for the growable mode.
+    *
+    * @invariant `size() <= capacity()`.
+    * @invariant Rows `[0, size())` hold live objects in every column; rows
+    *            `[size(), capacity())` are raw storage.
+    *
+    * @note Move-only. Moving a fixed-capacity container moves its elements one by
+    *       one (the storage is inline), and is `noexcept` only if every component
+    *       move is; moving a growable one steals the columns together with the
+    *       memory resource they came from. A moved-from container is empty.
+    * @note Component types must be nothrow-destructible and, for the growable
+    *       mode, nothrow-move-constructible (relocation on growth must not fail
+    *       halfway through a column).
+    * @note Not thread-safe.
+    */
+    template<typename... Ts, std::size_t Capacity>
+    class soa_vector<meta::typelist<Ts...>, Capacity> : private details::soa_growth<Capacity == soa_dynamic> {
+        static_assert(sizeof...(Ts) > 0, "soa_vector needs at least one component type");
+        static_assert(Capacity > 0, "soa_vector capacity must be > 0");
+        static_assert((std::is_object_v<Ts> and ...) and (not std::is_const_v<Ts> and ...),
+            "soa_vector components must be non-const object types");
+        static_assert((std::is_nothrow_destructible_v<Ts> and ...),
+            "soa_vector components must be nothrow-destructible");
+        static_assert(Capacity != soa_dynamic or (std::is_nothrow_move_constructible_v<Ts> and ...),
+            "growable soa_vector components must be nothrow-move-constructible");
+
+        static constexpr bool is_dynamic = Capacity == soa_dynamic;
+
+        /// @brief Whether moving the container cannot throw (always, for the growable mode).
+        static constexpr bool nothrow_move = is_dynamic or (std::is_nothrow_move_constructible_v<Ts> and ...);
+
+    public:
+        /// @brief The component typelist.
+        using types = meta::typelist<Ts...>;
+
+        /// @brief Element type of column `I`.
+        template<std::size_t I>
+        using column_type = meta::nth_t<I, Ts...>;
+
+        /// @brief Proxy row: references into every column.
+        using reference = std::tuple<Ts&...>;
+
+        /// @brief Read-only proxy row.
+        using const_reference = std::tuple<const Ts&...>;
+
+        /// @brief Number of columns.
+        static constexpr std::size_t columns = sizeof...(Ts);
+
+        /// @brief Constructs an empty container. Never allocates.
+        soa_vector() noexcept = default;
+
+        /**
+        * @brief Constructs an empty growable container whose columns come from `resource`.
+        *
+        * @param resource Resource for every column block; must outlive the container.
+        *                 Never allocates here.
+        */
+        explicit soa_vector(std::pmr::memory_resource* resource) noexcept;
+
+        /// @brief Destroys every live row and releases growable storage.
+        ~soa_vector() noexcept;
+
+        /**
+        * @brief Move constructor. @post `other.empty()`.
+        *
+        * @note Fixed mode with a throwing component move: if a move throws, the rows
+        *       already moved are destroyed and `other` keeps all of its rows.
+        */
+        soa_vector(soa_vector&& other) noexcept(nothrow_move);
+
+        /// @brief Move assignment. @post `other.empty()`; self-assignment is a no-op.
+        soa_vector& operator=(soa_vector&& other) noexcept(nothrow_move);
+
+        /// @brief Deleted copy constructor.
+        soa_vector(const soa_vector&) = delete;
+
+        /// @brief Deleted copy assignment.
+        soa_vector& operator=(const soa_vector&) = delete;
+
+        /**
+        * @brief Appends a row, constructing column `I` from `args[I]`.
+        *
+        * @param args Exactly one initializer per column, in column order.
+        * @return `true` on success; `false` if a fixed-capacity container is full
+        *         (nothing is constructed in that case).
+        *
+        * @note In growable mode a full container grows geometrically (x2). The new
+        *       row is built in the new blocks before the old rows move, so `args`
+        *       may refer to elements of this container (`v.emplace_back(std::get<0>(v[0]), ...)`).
+        * @note If a column's constructor throws, the columns already built for the
+        *       row are destroyed and `size()` is unchanged.
+        */
+        template<typename... Args>
+        bool emplace_back(Args&&... args);
+
+        /**
+        * @brief Destroys the last row.
+        *
+        * @pre `!empty()`; asserts in debug builds.
+        */
+        void pop_back() noexcept;
+
+        /**
+        * @brief Destroys every row. Capacity is unchanged.
+        */
+        void clear() noexcept;
+
+        /**
+        * @brief Ensures room for at least `n` rows.
+        *
+        * @return `true` if `capacity() >= n` afterwards. Always `true` in growable
+        *         mode; in fixed mode, `true` iff `n <= Capacity`.
+        *
+        * @throws std::length_error Growable mode, if `n` rows of some column exceed
+        *         the addressable size (like `std::vector::reserve`). Nothing changes.
+        */
+        bool reserve(std::size_t n);
+
+        /// @brief Number of live rows.
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /// @brief Number of rows the columns can hold without growing.
+        [[nodiscard]] std::size_t capacity() const noexcept;
+
+        /// @brief Growable mode: the resource the columns are allocated from.
+        [[nodiscard]] std::pmr::memory_resource* resource() const noexcept;
+
+        /// @brief `true` iff `size() == 0`.
+        [[nodiscard]] bool empty() const noexcept;
+
+        /**
+        * @brief Proxy row access.
+        *
+        * @pre `i < size()`; asserts in debug builds.
+        */
+        [[nodiscard]] reference operator[](std::size_t i) noexcept;
+
+        /// @brief Const overload of `operator[]`.
+        [[nodiscard]] const_reference operator[](std::size_t i) const noexcept;
+
+        /// @brief First row. @pre `!empty()`.
+        [[nodiscard]] reference front() noexcept;
+
+        /// @brief Last row. @pre `!empty()`.
+        [[nodiscard]] reference back() noexcept;
+
+        /// @brief Const overload of `front()`.
+        [[nodiscard]] const_reference front() const noexcept;
+
+        /// @brief Const overload of `back()`.
+        [[nodiscard]] const_reference back() const noexcept;
+
+        /// @brief Raw pointer to column `I` (aligned to `soa_column_alignment`).
+        template<std::size_t I>
+        [[nodiscard]] column_type<I>* data() noexcept;
+
+        /// @brief Const overload of `data<I>()`.
+        template<std::size_t I>
+        [[nodiscard]] const column_type<I>* data() const noexcept;
+
+        /// @brief Contiguous view over the live rows of column `I`.
+        template<std::size_t I>
+        [[nodiscard]] soa_column<column_type<I>> column() noexcept;
+
+        /// @brief Const overload of `column<I>()`.
+        template<std::size_t I>
+        [[nodiscard]] soa_column<const column_type<I>> column() const noexcept;
+
+        /**
+        * @brief Lock-step view over the selected columns (all columns if `Is...` is empty).
+        *
+        * @tparam Is Column indices to zip, in the order they appear in each tuple.
+        */
+        template<std::size_t... Is>
+        [[nodiscard]] auto zip() noexcept;
+
+        /// @brief Const overload of `zip<Is...>()`.
+        template<std::size_t... Is>
+        [[nodiscard]] auto zip() const noexcept;
+
+    private:
+        /// @brief Destroys rows `[from, _size)` in every column.
+        void destroy_tail(std::size_t from) noexcept;
+
+        /// @brief Growable mode: most rows any column block can address.
+        static constexpr std::size_t max_rows = std::numeric_limits<std::size_t>::max() / std::max({sizeof(Ts)...});
+
+        /// @brief Pointers to the first row of every column.
+        std::tuple<Ts*...> column_pointers() noexcept;
+
+        /// @brief Growable mode: one block of `rows` rows per column, all or none.
+        ///        Throws `std::length_error` if `rows > max_rows`.
+        std::tuple<Ts*...> allocate_blocks(std::size_t rows);
+
+        /// @brief Growable mode: releases blocks of `rows` rows (null entries are skipped).
+        void release_blocks(const std::tuple<Ts*...>& blocks, std::size_t rows) noexcept;
+
+        /// @brief Growable mode: moves the live rows into `fresh`, releases the old blocks
+        ///        and adopts `fresh` (blocks of `rows` rows).
+        void adopt_blocks(const std::tuple<Ts*...>& fresh, std::size_t rows) noexcept;
+
+        /// @brief Growable mode: relocates every column into blocks of `new_cap` rows.
+        void regrow(std::size_t new_cap);
+
+        /// @brief Moves `other`'s rows into `*this` (which must be empty).
+        void steal(soa_vector& other) noexcept(nothrow_move);
+
+        /// @brief One storage block per column.
+        std::tuple<details::soa_column_storage<Ts, Capacity>...> _columns{};
+
+        /// @brief Live row count.
+        std::size_t _size{0};
+    };
+
+} // namespace etools::memory
+
+#include "soa_vector.tpp"
+#endif // ETOOLS_MEMORY_SOA_VECTOR_HPP_
@@ -0,0 +1,326 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file soa_vector.tpp
+*
+* @brief Definition of soa_vector.hpp methods.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_MEMORY_SOA_VECTOR_TPP_
+#define ETOOLS_MEMORY_SOA_VECTOR_TPP_
+#include "soa_vector.hpp"
+#include <cassert>
+
+namespace etools::memory {
+
+    template<typename... Ts, std::size_t Capacity>
+    soa_vector<meta::typelist<Ts...>, Capacity>::~soa_vector() noexcept {
+        destroy_tail(0);
+        if constexpr (is_dynamic) {
+            std::apply([this](auto&... col) noexcept {
+                (col.deallocate(this->_resource, col._ptr, this->_capacity), ...);
+            }, _columns);
+        }
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    soa_vector<meta::typelist<Ts...>, Capacity>::soa_vector(std::pmr::memory_resource* resource) noexcept
+    {
+        static_assert(is_dynamic, "only a growable soa_vector takes a memory resource");
+        assert(resource != nullptr);
+        this->_resource = resource;
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    soa_vector<meta::typelist<Ts...>, Capacity>::soa_vector(soa_vector&& other) noexcept(nothrow_move) {
+        steal(other);
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    auto soa_vector<meta::typelist<Ts...>, Capacity>::operator=(soa_vector&& other) noexcept(nothrow_move) -> soa_vector& {
+        if (this == &other) return *this;
+        destroy_tail(0);
+        if constexpr (is_dynamic) {
+            std::apply([this](auto&... col) noexcept {
+                ((col.deallocate(this->_resource, col._ptr, this->_capacity), col._ptr = nullptr), ...);
+            }, _columns);
+            this->_capacity = 0;
+        }
+        steal(other);
+        return *this;
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    void soa_vector<meta::typelist<Ts...>, Capacity>::steal(soa_vector& other) noexcept(nothrow_move) {
+        if constexpr (is_dynamic) {
+            // Columns are heap blocks: hand the pointers over, no element is touched.
+            std::apply([&other](auto&... col) noexcept {
+                std::apply([&col...](auto&... src) noexcept {
+                    ((col._ptr = src._ptr, src._ptr = nullptr), ...);
+                }, other._columns);
+            }, _columns);
+            this->_capacity = other._capacity;
+            _size = other._size;
+            this->_resource = other._resource;
+            other._capacity = other._size = 0;
+        } else if constexpr (not nothrow_move) {
+            // A move may throw: build whole rows, and drop the rows already built if one
+            // fails (a throwing move constructor never reaches the destructor).
+            struct unwind {
+                soa_vector* self;
+                ~unwind() { if (self) self->destroy_tail(0); }
+            } guard{this};
+            for (std::size_t i = 0; i < other._size; ++i) {
+                std::apply([this, i](auto&... src) {
+                    emplace_back(std::move(src.ptr()[i])...);
+                }, other._columns);
+            }
+            guard.self = nullptr;
+            other.clear();
+        } else {
+            // Inline storage: relocate column by column, then empty the source.
+            std::apply([&other](auto&... col) noexcept {
+                std::apply([&](auto&... src) noexcept {
+                    (([&] {
+                        using T = std::remove_pointer_t<decltype(col.ptr())>;
+                        for (std::size_t i = 0; i < other._size; ++i)
+                            ::new (static_cast<void*>(col.ptr() + i)) T(std::move(src.ptr()[i]));
+                    }()), ...);
+                }, other._columns);
+            }, _columns);
+            _size = other._size;
+            other.clear();
+        }
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    void soa_vector<meta::typelist<Ts...>, Capacity>::destroy_tail(std::size_t from) noexcept {
+        std::apply([this, from](auto&... col) noexcept {
+            (([&] {
+                using T = std::remove_pointer_t<decltype(col.ptr())>;
+                if constexpr (not std::is_trivially_destructible_v<T>) {
+                    for (std::size_t i = from; i < _size; ++i) col.ptr()[i].~T();
+                }
+            }()), ...);
+        }, _columns);
+        _size = from;
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    auto soa_vector<meta::typelist<Ts...>, Capacity>::column_pointers() noexcept -> std::tuple<Ts*...> {
+        return std::apply([](auto&... col) noexcept { return std::tuple<Ts*...>{col.ptr()...}; }, _columns);
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    auto soa_vector<meta::typelist<Ts...>, Capacity>::allocate_blocks(std::size_t rows) -> std::tuple<Ts*...> {
+        static_assert(is_dynamic, "allocate_blocks() is only meaningful for the growable mode");
+        // Allocate every new block before touching the old ones, so a throwing
+        // resource leaves the container unchanged and each block is released
+        // with the size it was allocated with.
+        if (rows > max_rows) throw std::length_error("soa_vector: row count exceeds the addressable size");
+        std::tuple<Ts*...> fresh{};
+        struct unwind {
+            soa_vector* self;
+            const std::tuple<Ts*...>& blocks;
+            std::size_t rows;
+            ~unwind() { if (self) self->release_blocks(blocks, rows); }
+        } guard{this, fresh, rows};
+        std::apply([this, rows](Ts*&... p) {
+            ((p = details::soa_column_storage<Ts, Capacity>::allocate(this->_resource, rows)), ...);
+        }, fresh);
+        guard.self = nullptr;
+        return fresh;
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    void soa_vector<meta::typelist<Ts...>, Capacity>::release_blocks(const std::tuple<Ts*...>& blocks,
+                                                                     std::size_t rows) noexcept {
+        std::apply([this, rows](Ts*... p) noexcept {
+            (details::soa_column_storage<Ts, Capacity>::deallocate(this->_resource, p, rows), ...);
+        }, blocks);
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    void soa_vector<meta::typelist<Ts...>, Capacity>::adopt_blocks(const std::tuple<Ts*...>& fresh,
+                                                                   std::size_t rows) noexcept {
+        std::apply([this, &fresh](auto&... col) noexcept {
+            std::apply([this, &col...](auto*... p) noexcept {
+                (details::soa_relocate(col, p, _size, this->_capacity, this->_resource), ...);
+            }, fresh);
+        }, _columns);
+        this->_capacity = rows;
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    void soa_vector<meta::typelist<Ts...>, Capacity>::regrow(std::size_t new_cap) {
+        adopt_blocks(allocate_blocks(new_cap), new_cap);
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    template<typename... Args>
+    bool soa_vector<meta::typelist<Ts...>, Capacity>::emplace_back(Args&&... args) {
+        static_assert(sizeof...(Args) == sizeof...(Ts),
+            "soa_vector::emplace_back expects exactly one initializer per column");
+        static_assert((std::is_constructible_v<Ts, Args&&> and ...),
+            "soa_vector::emplace_back: every column must be constructible from its initializer");
+        if constexpr (is_dynamic) {
+            if (_size == this->_capacity) {
+                // Build the row in the new blocks while the old rows are still in place:
+                // `args` may refer to them.
+                const std::size_t new_cap = this->_capacity ? this->_capacity * 2 : 8;
+                const std::tuple<Ts*...> fresh = allocate_blocks(new_cap);
+                struct unwind {
+                    soa_vector* self;
+                    const std::tuple<Ts*...>& blocks;
+                    std::size_t rows;
+                    ~unwind() { if (self) self->release_blocks(blocks, rows); }
+                } guard{this, fresh, new_cap};
+                details::soa_construct_row(fresh, _size, std::forward<Args>(args)...);
+                guard.self = nullptr;
+                adopt_blocks(fresh, new_cap);
+                ++_size;
+                return true;
+            }
+        } else if (_size == Capacity) {
+            return false;
+        }
+        details::soa_construct_row(column_pointers(), _size, std::forward<Args>(args)...);
+        ++_size;
+        return true;
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    void soa_vector<meta::typelist<Ts...>, Capacity>::pop_back() noexcept {
+        assert(_size > 0 && "soa_vector::pop_back(): container is empty");
+        destroy_tail(_size - 1);
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    void soa_vector<meta::typelist<Ts...>, Capacity>::clear() noexcept {
+        destroy_tail(0);
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    bool soa_vector<meta::typelist<Ts...>, Capacity>::reserve(std::size_t n) {
+        if constexpr (is_dynamic) {
+            if (n > this->_capacity) regrow(n);
+            return true;
+        } else {
+            return n <= Capacity;
+        }
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    std::size_t soa_vector<meta::typelist<Ts...>, Capacity>::size() const noexcept {
+        return _size;
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    std::size_t soa_vector<meta::typelist<Ts...>, Capacity>::capacity() const noexcept {
+        if constexpr (is_dynamic) return this->_capacity;
+        else return Capacity;
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    std::pmr::memory_resource* soa_vector<meta::typelist<Ts...>, Capacity>::resource() const noexcept {
+        static_assert(is_dynamic, "resource() is only meaningful for the growable mode");
+        return this->_resource;
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    bool soa_vector<meta::typelist<Ts...>, Capacity>::empty() const noexcept {
+        return _size == 0;
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    auto soa_vector<meta::typelist<Ts...>, Capacity>::operator[](std::size_t i) noexcept -> reference {
+        assert(i < _size && "soa_vector::operator[]: row out of range");
+        return std::apply([i](auto&... col) noexcept { return reference{col.ptr()[i]...}; }, _columns);
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    auto soa_vector<meta::typelist<Ts...>, Capacity>::operator[](std::size_t i) const noexcept -> const_reference {
+        assert(i < _size && "soa_vector::operator[]: row out of range");
+        return std::apply([i](const auto&... col) noexcept { return const_reference{col.ptr()[i]...}; }, _columns);
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    auto soa_vector<meta::typelist<Ts...>, Capacity>::front() noexcept -> reference {
+        return (*this)[0];
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    auto soa_vector<meta::typelist<Ts...>, Capacity>::back() noexcept -> reference {
+        assert(_size > 0 && "soa_vector::back(): container is empty");
+        return (*this)[_size - 1];
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    auto soa_vector<meta::typelist<Ts...>, Capacity>::front() const noexcept -> const_reference {
+        return (*this)[0];
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    auto soa_vector<meta::typelist<Ts...>, Capacity>::back() const noexcept -> const_reference {
+        assert(_size > 0 && "soa_vector::back(): container is empty");
+        return (*this)[_size - 1];
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    template<std::size_t I>
+    auto soa_vector<meta::typelist<Ts...>, Capacity>::data() noexcept -> column_type<I>* {
+        return std::get<I>(_columns).ptr();
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    template<std::size_t I>
+    auto soa_vector<meta::typelist<Ts...>, Capacity>::data() const noexcept -> const column_type<I>* {
+        return std::get<I>(_columns).ptr();
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    template<std::size_t I>
+    auto soa_vector<meta::typelist<Ts...>, Capacity>::column() noexcept -> soa_column<column_type<I>> {
+        return {data<I>(), _size};
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    template<std::size_t I>
+    auto soa_vector<meta::typelist<Ts...>, Capacity>::column() const noexcept -> soa_column<const column_type<I>> {
+        return {data<I>(), _size};
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    template<std::size_t... Is>
+    auto soa_vector<meta::typelist<Ts...>, Capacity>::zip() noexcept {
+        if constexpr (sizeof...(Is) == 0) {
+            return std::apply([this](auto&... col) noexcept {
+                return soa_zip<Ts...>{std::tuple<Ts*...>{col.ptr()...}, _size};
+            }, _columns);
+        } else {
+            return soa_zip<column_type<Is>...>{std::tuple<column_type<Is>*...>{data<Is>()...}, _size};
+        }
+    }
+
+    template<typename... Ts, std::size_t Capacity>
+    template<std::size_t... Is>
+    auto soa_vector<meta::typelist<Ts...>, Capacity>::zip() const noexcept {
+        if constexpr (sizeof...(Is) == 0) {
+            return std::apply([this](const auto&... col) noexcept {
+                return soa_zip<const Ts...>{std::tuple<const Ts*...>{col.ptr()...}, _size};
+            }, _columns);
+        } else {
+            return soa_zip<const column_type<Is>...>{std::tuple<const column_type<Is>*...>{data<Is>()...}, _size};
+        }
+    }
+
+} // namespace etools::memory
+
+#endif // ETOOLS_MEMORY_SOA_VECTOR_TPP_
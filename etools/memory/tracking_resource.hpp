@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file tracking_resource.hpp
+*
+* @brief `std::pmr::memory_resource` wrapper that accounts every allocation to a tag.
+*
+* @ingroup etools_memory etools::memory
+*
+* @details
+* A `tracking_resource` forwards to an upstream resource and records, for its
+* tag (a subsystem name such as `"net.rx"` or `"route.table"`), the bytes in
+* use, the peak, allocation and deallocation counts, and a histogram of request
+* sizes. Give each subsystem its own resource, hand it to whatever allocates
+* for that subsystem (a growable `soa_vector`, a `buffer` from `make_buffer`, any
+* `std::pmr` container), and read `stats()` or walk every live resource with
+* `tracking_resource::for_each` to see what to shrink. No external profiler or
+* allocator hooks are needed.
+*
+* **Cost**
+* - Counters are thread-local in effect. Every resource holds
+*   `tracking_resource::shards` cache-line-aligned shards. On its first
+*   allocation a thread claims one of the first `shards - 1` indices for itself
+*   (returned at thread exit) and updates that shard in every resource with
+*   plain relaxed loads and stores, with no locked instruction and no shared
+*   cache line. Threads beyond that share the last shard with atomic RMWs.
+*   `stats()` merges the shards on read.
+* - Bytes in use are batched per shard. A shard's net change is moved into the
+*   shared total, and the peak is updated, once it reaches
+*   `tracking_resource::flush_bytes` either way. `bytes_in_use` in `stats()` is
+*   exact (shared total plus pending shard deltas). `peak_bytes` can miss a
+*   short spike by at most `shards * flush_bytes`.
+*
+* **Example**
+* @code
+* #include "etools/memory/tracking_resource.hpp"
+* #include "etools/memory/buffer.hpp"      // make_buffer
+* #include "etools/memory/soa_vector.hpp"
+* using namespace etools::memory;
+*
+* tracking_resource rx{"net.rx"};
+* auto frame = make_buffer(1500, rx);                       // buffer<resource_deleter>
+* soa_vector<meta::typelist<float, std::uint32_t>> rows{&rx};
+*
+* tracking_resource::for_each([](const tracking_resource& r) {
+*     const allocation_stats s = r.stats();
+*     std::printf("%-12.*s %8llu B in use, peak %llu\n", int(r.tag().size()), r.tag().data(),
+*                 (unsigned long long)s.bytes_in_use, (unsigned long long)s.peak_bytes);
+* });
+* @endcode
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_MEMORY_TRACKING_RESOURCE_HPP_
+#define ETOOLS_MEMORY_TRACKING_RESOURCE_HPP_
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <mutex>
+#include <string_view>
+
+namespace etools::memory {
+
+    /**
+    * @brief Snapshot of one `tracking_resource`'s counters.
+    */
+    struct allocation_stats {
+        /// @brief Number of request-size classes in `histogram`.
+        static constexpr std::size_t histogram_buckets = 16;
+
+        std::uint64_t bytes_in_use = 0;     ///< Allocated and not yet deallocated.
+        std::uint64_t peak_bytes = 0;       ///< Highest `bytes_in_use` observed (see the file notes).
+        std::uint64_t bytes_allocated = 0;  ///< Total over the resource's lifetime.
+        std::uint64_t allocations = 0;
+        std::uint64_t deallocations = 0;
+
+        /// @brief Allocation counts per size class; bucket `b` holds sizes up to `bucket_limit(b)`.
+        std::array<std::uint64_t, histogram_buckets> histogram{};
+
+        /**
+        * @brief Size class of a request: `0` for up to 16 bytes, then one bucket per power
+        *        of two, the last one for everything above 256 KiB.
+        */
+        [[nodiscard]] static constexpr std::size_t bucket_of(std::size_t bytes) noexcept;
+
+        /// @brief Largest request size counted in `bucket` (`SIZE_MAX` for the last).
+        [[nodiscard]] static constexpr std::size_t bucket_limit(std::size_t bucket) noexcept;
+    };
+
+    /**
+    * @class tracking_resource
+    * @brief Memory resource that forwards to an upstream resource and accounts every request to its tag.
+    *
+    * @invariant `stats().bytes_in_use` equals the bytes allocated through this resource and
+    *            not yet deallocated.
+    *
+    * @note Thread-safe: allocation, deallocation and `stats()` may run concurrently.
+    * @note Neither copyable nor movable: allocations refer to it, and it is linked into the
+    *       process-wide list walked by `for_each`.
+    * @warning Must outlive every allocation made through it, like any memory resource.
+    */
+    class tracking_resource : public std::pmr::memory_resource {
+    public:
+        /// @brief Counter stripes: `shards - 1` private ones plus one shared overflow shard.
+        static constexpr std::size_t shards = 16;
+
+        /// @brief Net bytes a shard accumulates before publishing them to the shared total.
+        static constexpr std::int64_t flush_bytes = 16 * 1024;
+
+        /**
+        * @brief Creates a resource for `tag` and registers it for `for_each`.
+        *
+        * @param tag      Subsystem name. Not copied; must outlive the resource (a literal is typical).
+        * @param upstream Resource that performs the allocations.
+        */
+        inline explicit tracking_resource(std::string_view tag,
+                                          std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept;
+
+        /// @brief Unregisters the resource. Outstanding allocations are not released.
+        inline ~tracking_resource() override;
+
+        tracking_resource(const tracking_resource&) = delete;
+        tracking_resource& operator=(const tracking_resource&) = delete;
+
+        /// @brief The subsystem name given at construction.
+        [[nodiscard]] inline std::string_view tag() const noexcept;
+
+        /// @brief The resource requests are forwarded to.
+        [[nodiscard]] inline std::pmr::memory_resource* upstream() const noexcept;
+
+        /**
+        * @brief Merges the per-thread shards into one snapshot.
+        *
+        * @note Counters updated concurrently with the call may or may not be included.
+        */
+        [[nodiscard]] inline allocation_stats stats() const noexcept;
+
+        /**
+        * @brief Calls `fn(const tracking_resource&)` for every live resource in the process.
+        *
+        * @warning Holds the registry lock: `fn` must not create or destroy a `tracking_resource`.
+        */
+        template<typename F>
+        static void for_each(F&& fn);
+
+    protected:
+        inline void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        inline void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+        inline bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    private:
+        /// @brief One thread's counters (several threads' for the overflow shard), on its own cache lines.
+        struct alignas(64) shard {
+            std::atomic<std::uint64_t> allocations;
+            std::atomic<std::uint64_t> deallocations;
+            std::atomic<std::uint64_t> bytes_allocated;
+            std::atomic<std::int64_t> pending;      ///< Net bytes not yet in `_in_use`.
+            std::array<std::atomic<std::uint64_t>, allocation_stats::histogram_buckets> histogram;
+        };
+
+        /// @brief Moves `delta` net bytes into the shared total and raises the peak.
+        inline void publish(std::int64_t delta) noexcept;
+
+        std::string_view _tag;
+        std::pmr::memory_resource* _upstream;
+        std::array<shard, shards> _shards{};
+        std::atomic<std::int64_t> _in_use{0};
+        std::atomic<std::int64_t> _peak{0};
+        tracking_resource* _prev = nullptr;     ///< Registry links, guarded by `_registry_mutex`.
+        tracking_resource* _next = nullptr;
+
+        static inline std::mutex _registry_mutex;
+        static inline tracking_resource* _registry = nullptr;
+    };
+
+} // namespace etools::memory
+
+#include "tracking_resource.tpp"
+#endif // ETOOLS_MEMORY_TRACKING_RESOURCE_HPP_
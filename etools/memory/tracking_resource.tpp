@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file tracking_resource.tpp
+*
+* @brief Definition of tracking_resource.hpp methods.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_MEMORY_TRACKING_RESOURCE_TPP_
+#define ETOOLS_MEMORY_TRACKING_RESOURCE_TPP_
+#include "tracking_resource.hpp"
+
+namespace etools::memory {
+
+    namespace details {
+        /// @brief Shard used by threads that found no private one; updated with atomic RMW.
+        inline constexpr std::size_t tracking_shared_shard = tracking_resource::shards - 1;
+
+        /// @brief Bit `i` set: private shard `i` is owned by a live thread.
+        inline std::atomic<std::uint32_t> tracking_claimed{0};
+        static_assert(tracking_resource::shards <= 32, "tracking_claimed has one bit per shard");
+
+        /// @brief The calling thread's shard; `shards` until the first allocation.
+        inline thread_local std::size_t tracking_index = tracking_resource::shards;
+
+        /// @brief Hands a private shard back at thread exit.
+        struct tracking_release {
+            ~tracking_release() {
+                const std::size_t i = tracking_index;
+                tracking_index = tracking_shared_shard;     // later TLS destructors must not use it
+                tracking_claimed.fetch_and(~(std::uint32_t{1} << i), std::memory_order_release);
+            }
+        };
+
+        /// @brief First use on a thread: claims a free private shard, else the shared one.
+        inline std::size_t tracking_claim() noexcept {
+            std::uint32_t bits = tracking_claimed.load(std::memory_order_relaxed);
+            std::size_t i = 0;
+            while (i < tracking_shared_shard) {
+                if (bits & (std::uint32_t{1} << i)) { ++i; continue; }
+                if (tracking_claimed.compare_exchange_weak(bits, bits | (std::uint32_t{1} << i), std::memory_order_acquire))
+                    break;
+                i = 0;                                      // `bits` reloaded; rescan
+            }
+            tracking_index = i;
+            if (i != tracking_shared_shard) {
+                thread_local tracking_release release;
+                (void)release;
+            }
+            return i;
+        }
+
+        /// @brief The calling thread's shard, claimed on first use.
+        inline std::size_t tracking_shard() noexcept {
+            const std::size_t i = tracking_index;
+            return i < tracking_resource::shards ? i : tracking_claim();
+        }
+
+        /// @brief Adds `n` to `c`: a plain load/store on a private shard, an RMW on the shared one.
+        template<typename T>
+        inline T tracking_add(std::atomic<T>& c, T n, bool owned) noexcept {
+            if (owned) {
+                const T v = c.load(std::memory_order_relaxed) + n;
+                c.store(v, std::memory_order_relaxed);
+                return v;
+            }
+            return c.fetch_add(n, std::memory_order_relaxed) + n;
+        }
+    } // namespace details
+
+    constexpr std::size_t allocation_stats::bucket_of(std::size_t bytes) noexcept {
+        if (bytes <= 16) return 0;
+#if defined(__GNUC__) || defined(__clang__)
+        const std::size_t width = 64 - static_cast<std::size_t>(__builtin_clzll(static_cast<unsigned long long>(bytes - 1)));
+#else
+        std::size_t width = 0;                          // bit width of bytes - 1
+        for (std::size_t v = bytes - 1; v; v >>= 1) ++width;
+#endif
+        return width - 4 < histogram_buckets ? width - 4 : histogram_buckets - 1;
+    }
+
+    constexpr std::size_t allocation_stats::bucket_limit(std::size_t bucket) noexcept {
+        return bucket + 1 < histogram_buckets ? std::size_t{16} << bucket : std::numeric_limits<std::size_t>::max();
+    }
+
+    inline tracking_resource::tracking_resource(std::string_view tag, std::pmr::memory_resource* upstream) noexcept
+        : _tag{tag}, _upstream{upstream}
+    {
+        const std::lock_guard<std::mutex> lock{_registry_mutex};
+        _next = _registry;
+        if (_next) _next->_prev = this;
+        _registry = this;
+    }
+
+    inline tracking_resource::~tracking_resource() {
+        const std::lock_guard<std::mutex> lock{_registry_mutex};
+        if (_prev) _prev->_next = _next;
+        else _registry = _next;
+        if (_next) _next->_prev = _prev;
+    }
+
+    inline std::string_view tracking_resource::tag() const noexcept {
+        return _tag;
+    }
+
+    inline std::pmr::memory_resource* tracking_resource::upstream() const noexcept {
+        return _upstream;
+    }
+
+    inline void tracking_resource::publish(std::int64_t delta) noexcept {
+        const std::int64_t now = _in_use.fetch_add(delta, std::memory_order_relaxed) + delta;
+        std::int64_t peak = _peak.load(std::memory_order_relaxed);
+        while (now > peak && !_peak.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {}
+    }
+
+    inline void* tracking_resource::do_allocate(std::size_t bytes, std::size_t alignment) {
+        void* const p = _upstream->allocate(bytes, alignment);
+        const std::size_t i = details::tracking_shard();
+        const bool owned = i != details::tracking_shared_shard;
+        shard& s = _shards[i];
+        details::tracking_add(s.allocations, std::uint64_t{1}, owned);
+        details::tracking_add(s.bytes_allocated, std::uint64_t{bytes}, owned);
+        details::tracking_add(s.histogram[allocation_stats::bucket_of(bytes)], std::uint64_t{1}, owned);
+        if (details::tracking_add(s.pending, static_cast<std::int64_t>(bytes), owned) >= flush_bytes)
+            publish(s.pending.exchange(0, std::memory_order_relaxed));
+        return p;
+    }
+
+    inline void tracking_resource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+        _upstream->deallocate(p, bytes, alignment);
+        const std::size_t i = details::tracking_shard();
+        const bool owned = i != details::tracking_shared_shard;
+        shard& s = _shards[i];
+        details::tracking_add(s.deallocations, std::uint64_t{1}, owned);
+        if (details::tracking_add(s.pending, -static_cast<std::int64_t>(bytes), owned) <= -flush_bytes)
+            publish(s.pending.exchange(0, std::memory_order_relaxed));
+    }
+
+    inline bool tracking_resource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+        return this == &other;
+    }
+
+    inline allocation_stats tracking_resource::stats() const noexcept {
+        allocation_stats out;
+        std::int64_t in_use = _in_use.load(std::memory_order_relaxed);
+        for (const shard& s : _shards) {
+            out.allocations += s.allocations.load(std::memory_order_relaxed);
+            out.deallocations += s.deallocations.load(std::memory_order_relaxed);
+            out.bytes_allocated += s.bytes_allocated.load(std::memory_order_relaxed);
+            in_use += s.pending.load(std::memory_order_relaxed);
+            for (std::size_t b = 0; b < allocation_stats::histogram_buckets; ++b)
+                out.histogram[b] += s.histogram[b].load(std::memory_order_relaxed);
+        }
+        const std::int64_t peak = _peak.load(std::memory_order_relaxed);
+        out.bytes_in_use = in_use > 0 ? static_cast<std::uint64_t>(in_use) : 0;
+        out.peak_bytes = static_cast<std::uint64_t>(peak > in_use ? peak : in_use);
+        return out;
+    }
+
+    template<typename F>
+    void tracking_resource::for_each(F&& fn) {
+        const std::lock_guard<std::mutex> lock{_registry_mutex};
+        for (const tracking_resource* r = _registry; r; r = r->_next) fn(*r);
+    }
+
+} // namespace etools::memory
+
+#endif // ETOOLS_MEMORY_TRACKING_RESOURCE_TPP_
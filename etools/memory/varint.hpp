@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file varint.hpp
+*
+* @brief Compact integer encodings: zigzag, LEB128 varints, Stream VByte arrays,
+*        and the `compact` wire mode of `buffer::pack` / `unpack`.
+*
+* @ingroup etools_memory etools::memory
+*
+* @details
+* Most integers that cross a subsystem boundary are small: identifiers,
+* counters, deltas, enum values. The flat wire format sends them at full
+* width. The encodings here spend bytes in proportion to magnitude instead.
+*
+* **Primitives**
+* - `zigzag_encode` / `zigzag_decode` map signed values to unsigned ones so
+*   that small magnitudes of either sign stay small (`0, -1, 1, -2` become
+*   `0, 1, 2, 3`).
+* - `varint_encode` / `varint_decode` write and read one LEB128 value: seven
+*   bits per byte, low group first, high bit set on every byte but the last.
+* - `stream_vbyte_encode` / `stream_vbyte_decode` handle arrays of `uint32_t`.
+*   Every group of four values has one control byte holding four 2-bit byte
+*   lengths. The control bytes come first and the data bytes after them, so
+*   the decoder knows a group's layout before it reads the group. With SSSE3
+*   (`-mssse3`, `-march=native`) or AArch64 NEON, each group is expanded with
+*   one byte shuffle from a 256-entry table. Other targets use a scalar loop.
+*
+* **Compact wire mode**
+*
+* `buffer::pack(compact, args...)` and `unpack<Ts...>(compact)` use these
+* encodings instead of the flat layout:
+* - every `bool` argument is one bit of a bitmap at the front;
+* - integers and enums wider than one byte are LEB128 varints (signed ones
+*   zigzagged first);
+* - `std::array` of such integers up to 32 bits wide is a Stream VByte block
+*   (64-bit elements are varints one by one);
+* - everything else (floating point, single bytes, trivially copyable
+*   structs) is copied as is.
+* `wire_fields` types (`meta::has_wire_fields_v`) are flattened first, as in the flat mode. The
+* layout depends only on the argument types, so nothing but the values goes
+* on the wire.
+*
+* **Example**
+* @code
+* #include "etools/memory/buffer.hpp"
+* using namespace etools::memory;
+*
+* buffer out{std::make_unique<std::byte[]>(64), 64};
+* out.pack(compact, std::uint32_t{7}, std::int64_t{-3}, true, 2.5);   // 1 + 1 + 1 + 8 = 11 bytes
+* auto v = out.unpack<std::uint32_t, std::int64_t, bool, double>(compact);
+* @endcode
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_MEMORY_VARINT_HPP_
+#define ETOOLS_MEMORY_VARINT_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace etools::memory {
+
+    /**
+    * @brief Tag selecting the compact wire mode of `buffer::pack` / `unpack`.
+    *
+    * @see varint.hpp for the layout.
+    */
+    struct compact_t {
+        explicit constexpr compact_t() = default;
+    };
+
+    /// @brief The `compact_t` tag value.
+    inline constexpr compact_t compact{};
+
+    /// @brief Longest LEB128 encoding of a 64-bit value.
+    inline constexpr std::size_t varint_max_size = 10;
+
+    /**
+    * @brief Maps a signed value to an unsigned one with small magnitudes first.
+    *
+    * @tparam T Signed integer type.
+    */
+    template<typename T>
+    [[nodiscard]] constexpr std::make_unsigned_t<T> zigzag_encode(T value) noexcept;
+
+    /**
+    * @brief Inverse of `zigzag_encode`.
+    *
+    * @tparam T Signed integer type.
+    */
+    template<typename T>
+    [[nodiscard]] constexpr T zigzag_decode(std::make_unsigned_t<T> value) noexcept;
+
+    /// @brief Bytes `varint_encode` writes for `value`, in `[1, varint_max_size]`.
+    [[nodiscard]] constexpr std::size_t varint_size(std::uint64_t value) noexcept;
+
+    /**
+    * @brief Writes `value` as a LEB128 varint.
+    *
+    * @param[in]  value Value to encode.
+    * @param[out] dst   At least `varint_size(value)` bytes.
+    * @return Bytes written, `varint_size(value)`.
+    */
+    inline std::size_t varint_encode(std::uint64_t value, std::byte* dst) noexcept;
+
+    /**
+    * @brief Reads one LEB128 varint.
+    *
+    * @param[in]  src   Encoded bytes.
+    * @param[in]  size  Bytes available at `src`.
+    * @param[out] value Decoded value; untouched on failure.
+    * @return Bytes read, or `0` if the input ends inside the varint or the value exceeds 64 bits.
+    */
+    [[nodiscard]] inline std::size_t varint_decode(const std::byte* src, std::size_t size, std::uint64_t& value) noexcept;
+
+    /// @brief Worst-case Stream VByte size of `count` values: control bytes plus four bytes each.
+    [[nodiscard]] constexpr std::size_t stream_vbyte_bound(std::size_t count) noexcept;
+
+    /**
+    * @brief Encodes `count` values as one Stream VByte block.
+    *
+    * @param[in]  src   Values to encode.
+    * @param[in]  count Number of values.
+    * @param[out] dst   At least `stream_vbyte_bound(count)` bytes.
+    * @return Bytes written.
+    */
+    inline std::size_t stream_vbyte_encode(const std::uint32_t* src, std::size_t count, std::byte* dst) noexcept;
+
+    /**
+    * @brief Decodes `count` values from a Stream VByte block.
+    *
+    * The count is not stored in the block; the caller supplies it, as the
+    * compact wire mode does from the array type.
+    *
+    * @param[in]  src   Encoded block.
+    * @param[in]  size  Bytes available at `src`; may extend past the block.
+    * @param[out] dst   `count` values.
+    * @param[in]  count Number of values.
+    * @return Bytes read, or `std::nullopt` if the block is longer than `size`.
+    */
+    [[nodiscard]] inline std::optional<std::size_t> stream_vbyte_decode(const std::byte* src, std::size_t size,
+                                                                        std::uint32_t* dst, std::size_t count) noexcept;
+
+} // namespace etools::memory
+
+#include "varint.tpp"
+#endif // ETOOLS_MEMORY_VARINT_HPP_
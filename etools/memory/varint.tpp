@@ -0,0 +1,367 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file varint.tpp
+*
+* @brief Definition of varint.hpp methods.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_MEMORY_VARINT_TPP_
+#define ETOOLS_MEMORY_VARINT_TPP_
+#include "varint.hpp"
+#include <array>
+#include <cstring>
+#include <limits>
+#include <tuple>
+#if defined(__SSSE3__)
+    #include <tmmintrin.h>
+    #define ETOOLS_MEMORY_VARINT_SSSE3 1
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define ETOOLS_MEMORY_VARINT_NEON 1
+#endif
+
+namespace etools::memory {
+
+    namespace details {
+
+        /// @brief Per control byte: data bytes of the group and the shuffle that widens them to four `uint32_t`.
+        struct svb_tables {
+            std::array<std::uint8_t, 256> length{};
+            std::array<std::array<std::uint8_t, 16>, 256> shuffle{};
+        };
+
+        constexpr svb_tables make_svb_tables() noexcept {
+            svb_tables t{};
+            for (std::size_t c = 0; c < 256; ++c) {
+                std::uint8_t src = 0;
+                for (std::size_t i = 0; i < 4; ++i) {
+                    const std::size_t len = ((c >> (2 * i)) & 3) + 1;
+                    for (std::size_t j = 0; j < 4; ++j)
+                        t.shuffle[c][4 * i + j] = j < len ? static_cast<std::uint8_t>(src + j) : std::uint8_t{0x80};
+                    src = static_cast<std::uint8_t>(src + len);
+                }
+                t.length[c] = src;
+            }
+            return t;
+        }
+
+        inline constexpr svb_tables svb = make_svb_tables();
+
+        /// @brief Stream VByte byte length code of one value: `0` for one byte up to `3` for four.
+        constexpr unsigned svb_code(std::uint32_t v) noexcept {
+            return static_cast<unsigned>(v > 0xFFu) + static_cast<unsigned>(v > 0xFFFFu) + static_cast<unsigned>(v > 0xFFFFFFu);
+        }
+
+        /// @brief Encodes `count` values, each mapped to `uint32_t` by `get(i)`.
+        template<typename Get>
+        std::size_t svb_encode(std::size_t count, std::byte* dst, Get get) noexcept {
+            const std::size_t ctrl_size = (count + 3) / 4;
+            if (ctrl_size) std::memset(dst, 0, ctrl_size);  // `dst` may be null when `count == 0`
+            std::byte* dp = dst + ctrl_size;
+            for (std::size_t i = 0; i < count; ++i) {
+                const std::uint32_t v = get(i);
+                const unsigned code = svb_code(v);
+                dst[i / 4] |= static_cast<std::byte>(code << (2 * (i % 4)));
+                for (unsigned j = 0; j <= code; ++j) *dp++ = static_cast<std::byte>(v >> (8 * j));
+            }
+            return static_cast<std::size_t>(dp - dst);
+        }
+
+        /// @brief Exact size `svb_encode` produces for the same values.
+        template<typename Get>
+        std::size_t svb_size(std::size_t count, Get get) noexcept {
+            std::size_t n = (count + 3) / 4 + count;
+            for (std::size_t i = 0; i < count; ++i) n += svb_code(get(i));
+            return n;
+        }
+
+        /// @brief `true` if `T` is sent as a varint in compact mode: an integer or enum wider than a byte.
+        template<typename T>
+        inline constexpr bool compact_varint_v = sizeof(T) > 1 && !std::is_same_v<T, bool>
+                                                 && (std::is_integral_v<T> || std::is_enum_v<T>);
+
+        /// @brief How compact mode sends `T` if it is a `std::array` of varint elements.
+        template<typename T>
+        struct compact_array {
+            static constexpr bool svb = false;      ///< One Stream VByte block (elements up to 32 bits).
+            static constexpr bool varints = false;  ///< One varint per element (64-bit elements).
+        };
+
+        template<typename E, std::size_t N>
+        struct compact_array<std::array<E, N>> {
+            static constexpr bool svb = compact_varint_v<E> && sizeof(E) <= 4;
+            static constexpr bool varints = compact_varint_v<E> && sizeof(E) > 4;
+        };
+
+        /// @brief Unsigned wire value of an integer or enum: the value itself, or its zigzag image.
+        template<typename T>
+        constexpr auto compact_to_unsigned(T v) noexcept {
+            if constexpr (std::is_enum_v<T>) {
+                return compact_to_unsigned(static_cast<std::underlying_type_t<T>>(v));
+            } else if constexpr (std::is_signed_v<T>) {
+                return zigzag_encode(v);
+            } else {
+                return static_cast<std::make_unsigned_t<T>>(v);
+            }
+        }
+
+        /// @brief Inverse of `compact_to_unsigned`; `false` if `w` is out of range for `T`.
+        template<typename T>
+        constexpr bool compact_from_unsigned(std::uint64_t w, T& out) noexcept {
+            if constexpr (std::is_enum_v<T>) {
+                std::underlying_type_t<T> u{};
+                if (!compact_from_unsigned(w, u)) return false;
+                out = static_cast<T>(u);
+                return true;
+            } else {
+                using U = std::make_unsigned_t<T>;
+                if (w > std::numeric_limits<U>::max()) return false;
+                if constexpr (std::is_signed_v<T>)
+                    out = zigzag_decode<T>(static_cast<U>(w));
+                else
+                    out = static_cast<T>(w);
+                return true;
+            }
+        }
+
+        struct compact_writer {
+            std::byte* p;
+            std::byte* end;
+            std::byte* bits;
+            std::size_t bit = 0;
+            bool ok = true;
+        };
+
+        struct compact_reader {
+            const std::byte* p;
+            const std::byte* end;
+            const std::byte* bits;
+            std::size_t bit = 0;
+            bool ok = true;
+        };
+
+        template<typename T>
+        void compact_put(compact_writer& w, const T& v) noexcept {
+            if (!w.ok) return;
+            const auto room = static_cast<std::size_t>(w.end - w.p);
+            if constexpr (std::is_same_v<T, bool>) {
+                if (v) w.bits[w.bit / 8] |= static_cast<std::byte>(1u << (w.bit % 8));
+                ++w.bit;
+            } else if constexpr (compact_varint_v<T>) {
+                const std::uint64_t u = compact_to_unsigned(v);
+                if (room < varint_size(u)) { w.ok = false; return; }
+                w.p += varint_encode(u, w.p);
+            } else if constexpr (compact_array<T>::svb) {
+                const auto get = [&v](std::size_t i) { return static_cast<std::uint32_t>(compact_to_unsigned(v[i])); };
+                if (room < svb_size(v.size(), get)) { w.ok = false; return; }
+                w.p += svb_encode(v.size(), w.p, get);
+            } else if constexpr (compact_array<T>::varints) {
+                for (const auto& e : v) compact_put(w, e);
+            } else {
+                static_assert(std::is_trivially_copyable_v<T>,
+                    "buffer::pack(compact, ...): arguments must be trivially copyable or opt into wire_fields");
+                if (room < sizeof(T)) { w.ok = false; return; }
+                std::memcpy(w.p, &v, sizeof(T));
+                w.p += sizeof(T);
+            }
+        }
+
+        template<typename T>
+        void compact_get(compact_reader& r, T& out) noexcept {
+            if (!r.ok) return;
+            const auto room = static_cast<std::size_t>(r.end - r.p);
+            if constexpr (std::is_same_v<T, bool>) {
+                out = (static_cast<unsigned>(r.bits[r.bit / 8]) >> (r.bit % 8)) & 1u;
+                ++r.bit;
+            } else if constexpr (compact_varint_v<T>) {
+                std::uint64_t u;
+                const std::size_t n = varint_decode(r.p, room, u);
+                if (n == 0 || !compact_from_unsigned(u, out)) { r.ok = false; return; }
+                r.p += n;
+            } else if constexpr (compact_array<T>::svb) {
+                std::optional<std::size_t> n;
+                if constexpr (std::is_same_v<typename T::value_type, std::uint32_t>) {
+                    n = stream_vbyte_decode(r.p, room, out.data(), out.size());
+                } else {
+                    std::array<std::uint32_t, std::tuple_size<T>::value> raw;
+                    n = stream_vbyte_decode(r.p, room, raw.data(), raw.size());
+                    for (std::size_t i = 0; n && i < raw.size(); ++i)
+                        if (!compact_from_unsigned(raw[i], out[i])) n.reset();
+                }
+                if (!n) { r.ok = false; return; }
+                r.p += *n;
+            } else if constexpr (compact_array<T>::varints) {
+                for (auto& e : out) compact_get(r, e);
+            } else {
+                if (room < sizeof(T)) { r.ok = false; return; }
+                std::memcpy(&out, r.p, sizeof(T));
+                r.p += sizeof(T);
+            }
+        }
+
+        /// @brief Number of `bool` wire values among `Ws...`.
+        template<typename... Ws>
+        inline constexpr std::size_t compact_bools_v = (std::size_t{0} + ... + std::size_t{std::is_same_v<std::decay_t<Ws>, bool>});
+
+        template<typename Tuple>
+        struct compact_tuple_bools;
+
+        template<typename... Ws>
+        struct compact_tuple_bools<std::tuple<Ws...>> : std::integral_constant<std::size_t, compact_bools_v<Ws...>> {};
+
+        /**
+        * @brief Writes wire values in the compact layout.
+        *
+        * @return Bytes written, or `0` if they do not fit (the block may be partly overwritten).
+        */
+        template<typename... Ws>
+        std::size_t compact_pack(std::byte* dst, std::size_t capacity, const Ws&... ws) noexcept {
+            constexpr std::size_t head = (compact_bools_v<Ws...> + 7) / 8;
+            if (capacity < head) return 0;
+            std::memset(dst, 0, head);
+            compact_writer w{dst + head, dst + capacity, dst};
+            (compact_put(w, ws), ...);
+            return w.ok ? static_cast<std::size_t>(w.p - dst) : 0;
+        }
+
+        /**
+        * @brief Reads a tuple of wire values from the compact layout.
+        *
+        * @return The values, or `std::nullopt` if the input is short, malformed or out of range.
+        */
+        template<typename Tuple>
+        std::optional<Tuple> compact_unpack(const std::byte* src, std::size_t size) noexcept {
+            constexpr std::size_t head = (compact_tuple_bools<Tuple>::value + 7) / 8;
+            if (size < head) return std::nullopt;
+            compact_reader r{src + head, src + size, src};
+            Tuple values{};
+            std::apply([&r](auto&... v) { (compact_get(r, v), ...); }, values);
+            if (!r.ok) return std::nullopt;
+            return values;
+        }
+
+    } // namespace details
+
+    template<typename T>
+    constexpr std::make_unsigned_t<T> zigzag_encode(T value) noexcept {
+        static_assert(std::is_integral_v<T> && std::is_signed_v<T>, "zigzag_encode: T must be a signed integer");
+        using U = std::make_unsigned_t<T>;
+        return static_cast<U>(static_cast<U>(value) << 1) ^ static_cast<U>(value < 0 ? ~U{0} : U{0});
+    }
+
+    template<typename T>
+    constexpr T zigzag_decode(std::make_unsigned_t<T> value) noexcept {
+        static_assert(std::is_integral_v<T> && std::is_signed_v<T>, "zigzag_decode: T must be a signed integer");
+        using U = std::make_unsigned_t<T>;
+        const U bits = static_cast<U>(static_cast<U>(value >> 1) ^ static_cast<U>(U{0} - static_cast<U>(value & 1u)));
+        return static_cast<T>(bits);
+    }
+
+    constexpr std::size_t varint_size(std::uint64_t value) noexcept {
+        std::size_t n = 1;
+        for (; value >= 0x80; value >>= 7) ++n;
+        return n;
+    }
+
+    inline std::size_t varint_encode(std::uint64_t value, std::byte* dst) noexcept {
+        std::byte* p = dst;
+        for (; value >= 0x80; value >>= 7) *p++ = static_cast<std::byte>(value | 0x80);
+        *p++ = static_cast<std::byte>(value);
+        return static_cast<std::size_t>(p - dst);
+    }
+
+    inline std::size_t varint_decode(const std::byte* src, std::size_t size, std::uint64_t& value) noexcept {
+        if (size && static_cast<unsigned>(src[0]) < 0x80) {     // one-byte values dominate
+            value = static_cast<std::uint64_t>(src[0]);
+            return 1;
+        }
+    #if (defined(__GNUC__) || defined(__clang__)) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        if (size >= 8) {
+            // Up to eight bytes at once: find the last byte, then squeeze out the continuation bits.
+            std::uint64_t w;
+            std::memcpy(&w, src, 8);
+            if (const std::uint64_t stops = ~w & 0x8080808080808080ull) {
+                const auto len = static_cast<std::size_t>(__builtin_ctzll(stops)) / 8 + 1;
+                std::uint64_t x = w & (~std::uint64_t{0} >> (64 - 8 * len)) & 0x7F7F7F7F7F7F7F7Full;
+                x = (x & 0x007F007F007F007Full) | ((x & 0x7F007F007F007F00ull) >> 1);
+                x = (x & 0x00003FFF00003FFFull) | ((x & 0x3FFF00003FFF0000ull) >> 2);
+                x = (x & 0x000000000FFFFFFFull) | ((x & 0x0FFFFFFF00000000ull) >> 4);
+                value = x;
+                return len;
+            }
+        }
+    #endif
+        std::uint64_t v = 0;
+        const std::size_t limit = size < varint_max_size ? size : varint_max_size;
+        for (std::size_t i = 0; i < limit; ++i) {
+            const auto b = static_cast<std::uint64_t>(src[i]);
+            if (i == varint_max_size - 1 && b > 1) return 0;   // bits past 64
+            v |= (b & 0x7F) << (7 * i);
+            if (b < 0x80) {
+                value = v;
+                return i + 1;
+            }
+        }
+        return 0;
+    }
+
+    constexpr std::size_t stream_vbyte_bound(std::size_t count) noexcept {
+        return (count + 3) / 4 + 4 * count;
+    }
+
+    inline std::size_t stream_vbyte_encode(const std::uint32_t* src, std::size_t count, std::byte* dst) noexcept {
+        return details::svb_encode(count, dst, [src](std::size_t i) { return src[i]; });
+    }
+
+    inline std::optional<std::size_t> stream_vbyte_decode(const std::byte* src, std::size_t size,
+                                                          std::uint32_t* dst, std::size_t count) noexcept {
+        const std::size_t ctrl_size = (count + 3) / 4;
+        if (size < ctrl_size) return std::nullopt;
+        const std::byte* const ctrl = src;
+        const std::byte* dp = src + ctrl_size;
+        const std::byte* const end = src + size;
+        std::size_t i = 0;
+    #if defined(ETOOLS_MEMORY_VARINT_SSSE3) || defined(ETOOLS_MEMORY_VARINT_NEON)
+        // Whole groups while a 16-byte load stays inside the input: one shuffle each.
+        for (; i + 4 <= count && end - dp >= 16; i += 4) {
+            const auto c = static_cast<std::uint8_t>(ctrl[i / 4]);
+        #if defined(ETOOLS_MEMORY_VARINT_SSSE3)
+            const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dp));
+            const __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(details::svb.shuffle[c].data()));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(data, mask));
+        #else
+            const uint8x16_t data = vld1q_u8(reinterpret_cast<const std::uint8_t*>(dp));
+            vst1q_u8(reinterpret_cast<std::uint8_t*>(dst + i), vqtbl1q_u8(data, vld1q_u8(details::svb.shuffle[c].data())));
+        #endif
+            dp += details::svb.length[c];
+        }
+    #endif
+        for (; i < count; ++i) {
+            const std::size_t len = ((static_cast<unsigned>(ctrl[i / 4]) >> (2 * (i % 4))) & 3u) + 1;
+            const auto room = static_cast<std::size_t>(end - dp);
+            if (room < len) return std::nullopt;
+            std::uint32_t v = 0;
+        #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            if (room >= 4) {
+                std::memcpy(&v, dp, 4);                          // one load, then drop the bytes of the next value
+                v &= ~std::uint32_t{0} >> (32 - 8 * len);
+            } else
+        #endif
+            for (std::size_t j = 0; j < len; ++j) v |= static_cast<std::uint32_t>(dp[j]) << (8 * j);
+            dst[i] = v;
+            dp += len;
+        }
+        return static_cast<std::size_t>(dp - src);
+    }
+
+} // namespace etools::memory
+
+#endif // ETOOLS_MEMORY_VARINT_TPP_
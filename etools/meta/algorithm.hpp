@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file algorithm.hpp
+*
+* @brief Step-efficient `constexpr` algorithms over `std::array` for compile-time table builders.
+*
+* @ingroup etools_meta etools::meta
+*
+* The compile-time builders in `etools::hashing` (and anything else that
+* computes a lookup table in a constant expression) spend most of their
+* constant-evaluation budget in a handful of primitive loops: sorting keys,
+* rejecting duplicates, grouping keys by bucket and prefix-summing counts.
+* Constant evaluation is interpreted, so every loop iteration and every
+* temporary array element is paid for in compiler time and counts against
+* `-fconstexpr-ops-limit` / `-fconstexpr-steps`. This header centralises those
+* primitives with algorithms chosen for a low *step* count rather than for
+* run-time cache behaviour:
+*
+* - `sort_array`: introsort (median-of-three quicksort, heapsort fallback at
+*   depth `2 log N`, insertion sort below 16 elements).
+* - `radix_sort_array`: LSD radix sort (8-bit digits, constant digits
+*   skipped) for unsigned integers and enums. Each digit pass pays for a
+*   256-entry count table, so it only beats introsort for large arrays
+*   (roughly `N > 128 * sizeof(T)`) or keys with few varying bytes.
+* - `sorted_array`: sorted copy, for `constexpr` initialisers.
+* - `unique_sorted`: `std::unique` on a sorted prefix, returns the new length.
+* - `all_distinct_sorted`: duplicate check by sorting a copy and comparing
+*   neighbours. Works for any ordered `T`, but for integral keys
+*   `all_distinct_fast` (utility.hpp) is several times cheaper.
+* - `lower_bound_index`: branch-free binary search returning an index.
+* - `exclusive_prefix_sum`: `counts` -> CSR offsets.
+* - `counting_sort_by_bucket`: stable grouping of element indices by a bucket
+*   function (counts, offsets and CSR order in two passes).
+*
+* Every function is usable both in constant expressions and at run time, and
+* none allocates. `benchmarks/constexpr/constexpr_ops.py` measures the
+* constant-evaluation cost of each primitive and of the hashing builders.
+*
+* ### Example
+* @code
+* #include "etools/meta/algorithm.hpp"
+* using namespace etools::meta;
+*
+* constexpr std::array<std::uint32_t, 5> keys{40, 10, 30, 20, 50};
+* constexpr auto sorted = sorted_array(keys);                  // {10,20,30,40,50}
+* static_assert(lower_bound_index(sorted, 30u) == 2);
+* static_assert(all_distinct_sorted(keys));
+*
+* constexpr auto part = counting_sort_by_bucket<4>(keys, [](std::uint32_t k) { return k % 4; });
+* // part.items[part.offsets[b] .. part.offsets[b + 1]) are the indices of keys in bucket b.
+* @endcode
+*
+* @note C++17 has no `constexpr` `std::sort`/`std::swap` on arrays of
+*       user types; these algorithms only require `T` to be a literal type
+*       that is copy-assignable in constant expressions.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_ALGORITHM_HPP_
+#define ETOOLS_META_ALGORITHM_HPP_
+#include <array>       // For std::array
+#include <cstddef>     // For std::size_t
+#include <functional>  // For std::less
+#include <type_traits> // For std::is_unsigned_v, std::is_enum_v
+
+namespace etools::meta {
+
+    /**
+    * @brief Sorts `a` in place with introsort using `comp`.
+    *
+    * Not stable. O(N log N) comparisons in the worst case.
+    *
+    * @tparam T    Element type.
+    * @tparam N    Array length.
+    * @tparam Comp Strict weak ordering, `bool(const T&, const T&)`.
+    * @param[in,out] a    Array to sort.
+    * @param[in]     comp Comparator.
+    */
+    template<typename T, std::size_t N, typename Comp>
+    constexpr void sort_array(std::array<T, N>& a, Comp comp) noexcept;
+
+    /**
+    * @brief Sorts `a` ascending in place with introsort and `std::less<>`.
+    */
+    template<typename T, std::size_t N>
+    constexpr void sort_array(std::array<T, N>& a) noexcept;
+
+    /**
+    * @brief LSD radix sort (8-bit digits) of unsigned integers or enums.
+    *
+    * Stable, O(N + 256) per digit. Digits that are identical across all keys
+    * are skipped after the counting pass, so narrow key ranges cost fewer
+    * passes. For small arrays of wide keys the fixed per-digit cost dominates;
+    * prefer `sort_array` there.
+    *
+    * @tparam T Unsigned integral type or enum with an unsigned underlying type.
+    */
+    template<typename T, std::size_t N>
+    constexpr void radix_sort_array(std::array<T, N>& a) noexcept;
+
+    /**
+    * @brief Returns a copy of `a` sorted ascending (see `sort_array(a)`).
+    */
+    template<typename T, std::size_t N>
+    [[nodiscard]] constexpr std::array<T, N> sorted_array(const std::array<T, N>& a) noexcept;
+
+    /**
+    * @brief Returns a copy of `a` sorted by `comp` (see `sort_array(a, comp)`).
+    */
+    template<typename T, std::size_t N, typename Comp>
+    [[nodiscard]] constexpr std::array<T, N> sorted_array(const std::array<T, N>& a, Comp comp) noexcept;
+
+    /**
+    * @brief Removes consecutive duplicates from the sorted prefix `a[0, n)`.
+    *
+    * Like `std::unique`: kept elements are moved to the front in order; the
+    * contents of `a[result, n)` are unspecified.
+    *
+    * @param[in,out] a Array whose first `n` elements are sorted.
+    * @param[in]     n Length of the prefix to process; defaults to `N`.
+    * @return Number of distinct elements.
+    */
+    template<typename T, std::size_t N>
+    constexpr std::size_t unique_sorted(std::array<T, N>& a, std::size_t n = N) noexcept;
+
+    /**
+    * @brief `true` if all elements of `a` are pairwise distinct.
+    *
+    * Sorts a copy (`sort_array`) and compares neighbours, so `T` only needs
+    * `<` and `==`. For integral keys `all_distinct_fast` is cheaper.
+    */
+    template<typename T, std::size_t N>
+    [[nodiscard]] constexpr bool all_distinct_sorted(const std::array<T, N>& a) noexcept;
+
+    /**
+    * @brief Index of the first element of the sorted prefix `a[0, n)` not less than `value`.
+    *
+    * Branch-free: the search window halves each step with a conditional
+    * advance, so the step count is `ceil(log2(n)) + 1` regardless of `value`.
+    *
+    * @return An index in `[0, n]`; `n` if every element is less than `value`.
+    */
+    template<typename T, std::size_t N, typename U, typename Comp = std::less<>>
+    [[nodiscard]] constexpr std::size_t lower_bound_index(const std::array<T, N>& a, const U& value,
+                                                          std::size_t n = N, Comp comp = {}) noexcept;
+
+    /**
+    * @brief Exclusive prefix sum: `out[0] = 0`, `out[i + 1] = out[i] + counts[i]`.
+    *
+    * @return `N + 1` offsets; `out[N]` is the total.
+    */
+    template<typename T, std::size_t N>
+    [[nodiscard]] constexpr std::array<T, N + 1> exclusive_prefix_sum(const std::array<T, N>& counts) noexcept;
+
+    /**
+    * @struct bucket_partition
+    *
+    * @brief Result of `counting_sort_by_bucket`: element indices grouped by bucket (CSR).
+    *
+    * The indices of the elements in bucket `b` are
+    * `items[offsets[b]] .. items[offsets[b + 1] - 1]`, in their original order.
+    */
+    template<std::size_t N, std::size_t Buckets>
+    struct bucket_partition {
+        std::array<std::size_t, Buckets>     counts{};  ///< Elements per bucket.
+        std::array<std::size_t, Buckets + 1> offsets{}; ///< Exclusive prefix sum of `counts`.
+        std::array<std::size_t, N>           items{};   ///< Element indices, grouped by bucket.
+        std::array<std::size_t, N>           bucket{};  ///< Bucket of each element, by element index.
+    };
+
+    /**
+    * @brief Stable counting sort of element indices by `bucket_of(a[i])`.
+    *
+    * Evaluates `bucket_of` once per element.
+    *
+    * @tparam Buckets Number of buckets.
+    * @param[in] a         Elements to group.
+    * @param[in] bucket_of Callable returning a bucket in `[0, Buckets)` for an element.
+    */
+    template<std::size_t Buckets, typename T, std::size_t N, typename BucketOf>
+    [[nodiscard]] constexpr bucket_partition<N, Buckets>
+    counting_sort_by_bucket(const std::array<T, N>& a, BucketOf bucket_of) noexcept;
+
+} // namespace etools::meta
+
+#include "algorithm.tpp"
+#endif // ETOOLS_META_ALGORITHM_HPP_
@@ -0,0 +1,245 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file algorithm.tpp
+*
+* @brief Definition of algorithm.hpp functions.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_ALGORITHM_TPP_
+#define ETOOLS_META_ALGORITHM_TPP_
+#include "algorithm.hpp"
+#include <cassert>
+
+namespace etools::meta::details {
+
+    /// @brief Ranges shorter than this are left to the final insertion sort.
+    inline constexpr std::size_t introsort_threshold = 16;
+
+    template<typename T>
+    constexpr void algo_swap(T& a, T& b) noexcept {
+        T t = a;
+        a = b;
+        b = t;
+    }
+
+    template<typename T, std::size_t N, typename Comp>
+    constexpr void insertion_sort(std::array<T, N>& a, std::size_t lo, std::size_t hi, Comp& comp) noexcept {
+        for (std::size_t i = lo + 1; i < hi; ++i) {
+            T v = a[i];
+            std::size_t j = i;
+            for (; j > lo && comp(v, a[j - 1]); --j) a[j] = a[j - 1];
+            a[j] = v;
+        }
+    }
+
+    template<typename T, std::size_t N, typename Comp>
+    constexpr void sift_down(std::array<T, N>& a, std::size_t lo, std::size_t root, std::size_t len, Comp& comp) noexcept {
+        T v = a[lo + root];
+        for (std::size_t child = 2 * root + 1; child < len; child = 2 * root + 1) {
+            if (child + 1 < len && comp(a[lo + child], a[lo + child + 1])) ++child;
+            if (!comp(v, a[lo + child])) break;
+            a[lo + root] = a[lo + child];
+            root = child;
+        }
+        a[lo + root] = v;
+    }
+
+    template<typename T, std::size_t N, typename Comp>
+    constexpr void heap_sort(std::array<T, N>& a, std::size_t lo, std::size_t hi, Comp& comp) noexcept {
+        const std::size_t len = hi - lo;
+        for (std::size_t i = len / 2; i-- > 0;) sift_down(a, lo, i, len, comp);
+        for (std::size_t end = len; end-- > 1;) {
+            algo_swap(a[lo], a[lo + end]);
+            sift_down(a, lo, 0, end, comp);
+        }
+    }
+
+    /**
+    * @brief Quicksort on `[lo, hi)` until ranges drop below the threshold.
+    *
+    * Recurses into the smaller side and loops on the larger, so recursion depth
+    * is O(log N) even before the heapsort fallback triggers.
+    */
+    template<typename T, std::size_t N, typename Comp>
+    constexpr void introsort_loop(std::array<T, N>& a, std::size_t lo, std::size_t hi, std::size_t depth, Comp& comp) noexcept {
+        while (hi - lo > introsort_threshold) {
+            if (depth == 0) { heap_sort(a, lo, hi, comp); return; }
+            --depth;
+
+            // Median of three moved to a[lo]; it then bounds both scans.
+            const std::size_t mid = lo + (hi - lo) / 2;
+            if (comp(a[mid], a[lo]))     algo_swap(a[mid], a[lo]);
+            if (comp(a[hi - 1], a[mid])) algo_swap(a[hi - 1], a[mid]);
+            if (comp(a[mid], a[lo]))     algo_swap(a[mid], a[lo]);
+            algo_swap(a[lo], a[mid]);
+            const T pivot = a[lo];
+
+            // Hoare partition.
+            std::size_t i = lo, j = hi;
+            for (;;) {
+                do ++i; while (comp(a[i], pivot));
+                do --j; while (comp(pivot, a[j]));
+                if (i >= j) break;
+                algo_swap(a[i], a[j]);
+            }
+            algo_swap(a[lo], a[j]);
+
+            if (j - lo < hi - j - 1) {
+                introsort_loop(a, lo, j, depth, comp);
+                lo = j + 1;
+            } else {
+                introsort_loop(a, j + 1, hi, depth, comp);
+                hi = j;
+            }
+        }
+    }
+
+    template<typename T, typename = void>
+    struct radix_key { using type = void; };
+
+    template<typename T>
+    struct radix_key<T, std::enable_if_t<std::is_unsigned_v<T>>> { using type = T; };
+
+    template<typename T>
+    struct radix_key<T, std::enable_if_t<std::is_enum_v<T>>> {
+        using type = std::conditional_t<std::is_unsigned_v<std::underlying_type_t<T>>,
+                                        std::underlying_type_t<T>, void>;
+    };
+
+    /// @brief Unsigned integer view of `T` for radix sorting, or `void` if not radix-sortable.
+    template<typename T>
+    using radix_key_t = typename radix_key<T>::type;
+
+} // namespace etools::meta::details
+
+namespace etools::meta {
+
+    template<typename T, std::size_t N, typename Comp>
+    constexpr void sort_array(std::array<T, N>& a, Comp comp) noexcept {
+        if constexpr (N > 1) {
+            std::size_t depth = 0;
+            for (std::size_t n = N; n > 1; n >>= 1) depth += 2;
+            details::introsort_loop(a, 0, N, depth, comp);
+            details::insertion_sort(a, 0, N, comp);
+        }
+    }
+
+    template<typename T, std::size_t N>
+    constexpr void sort_array(std::array<T, N>& a) noexcept {
+        sort_array(a, std::less<>{});
+    }
+
+    template<typename T, std::size_t N>
+    constexpr void radix_sort_array(std::array<T, N>& a) noexcept {
+        using key_t = details::radix_key_t<T>;
+        static_assert(!std::is_void_v<key_t>,
+            "radix_sort_array: T must be an unsigned integer or an enum with an unsigned underlying type");
+        if constexpr (N > 1) {
+            std::array<T, N> buf{};
+            bool in_buf = false;  // which array currently holds the data
+            for (std::size_t shift = 0; shift < sizeof(key_t) * 8; shift += 8) {
+                std::array<T, N>& src = in_buf ? buf : a;
+                std::array<T, N>& dst = in_buf ? a : buf;
+
+                std::array<std::size_t, 256> count{};
+                for (std::size_t i = 0; i < N; ++i)
+                    ++count[(static_cast<key_t>(src[i]) >> shift) & 0xFFu];
+                if (count[(static_cast<key_t>(src[0]) >> shift) & 0xFFu] == N) continue;
+
+                std::size_t sum = 0;
+                for (auto& c : count) { const std::size_t t = c; c = sum; sum += t; }
+                for (std::size_t i = 0; i < N; ++i)
+                    dst[count[(static_cast<key_t>(src[i]) >> shift) & 0xFFu]++] = src[i];
+                in_buf = !in_buf;
+            }
+            if (in_buf) a = buf;
+        }
+    }
+
+    template<typename T, std::size_t N>
+    constexpr std::array<T, N> sorted_array(const std::array<T, N>& a) noexcept {
+        std::array<T, N> r = a;
+        sort_array(r);
+        return r;
+    }
+
+    template<typename T, std::size_t N, typename Comp>
+    constexpr std::array<T, N> sorted_array(const std::array<T, N>& a, Comp comp) noexcept {
+        std::array<T, N> r = a;
+        sort_array(r, comp);
+        return r;
+    }
+
+    template<typename T, std::size_t N>
+    constexpr std::size_t unique_sorted(std::array<T, N>& a, std::size_t n) noexcept {
+        assert(n <= N && "unique_sorted(): prefix longer than the array");
+        if (n == 0) return 0;
+        std::size_t out = 1;
+        for (std::size_t i = 1; i < n; ++i)
+            if (!(a[i] == a[out - 1])) a[out++] = a[i];
+        return out;
+    }
+
+    template<typename T, std::size_t N>
+    constexpr bool all_distinct_sorted(const std::array<T, N>& a) noexcept {
+        if constexpr (N < 2) {
+            (void)a;
+            return true;
+        } else {
+            const std::array<T, N> s = sorted_array(a);
+            for (std::size_t i = 1; i < N; ++i)
+                if (s[i] == s[i - 1]) return false;
+            return true;
+        }
+    }
+
+    template<typename T, std::size_t N, typename U, typename Comp>
+    constexpr std::size_t lower_bound_index(const std::array<T, N>& a, const U& value,
+                                            std::size_t n, Comp comp) noexcept {
+        assert(n <= N && "lower_bound_index(): prefix longer than the array");
+        std::size_t base = 0;
+        while (n > 1) {
+            const std::size_t half = n / 2;
+            base += comp(a[base + half], value) ? half : 0;
+            n -= half;
+        }
+        return base + (n == 1 && comp(a[base], value));
+    }
+
+    template<typename T, std::size_t N>
+    constexpr std::array<T, N + 1> exclusive_prefix_sum(const std::array<T, N>& counts) noexcept {
+        std::array<T, N + 1> out{};
+        for (std::size_t i = 0; i < N; ++i) out[i + 1] = out[i] + counts[i];
+        return out;
+    }
+
+    template<std::size_t Buckets, typename T, std::size_t N, typename BucketOf>
+    constexpr bucket_partition<N, Buckets>
+    counting_sort_by_bucket(const std::array<T, N>& a, BucketOf bucket_of) noexcept {
+        bucket_partition<N, Buckets> p{};
+        for (std::size_t i = 0; i < N; ++i) {
+            const std::size_t b = static_cast<std::size_t>(bucket_of(a[i]));
+            assert(b < Buckets && "counting_sort_by_bucket(): bucket out of range");
+            p.bucket[i] = b;
+            ++p.counts[b];
+        }
+        p.offsets = exclusive_prefix_sum(p.counts);
+        std::array<std::size_t, Buckets> fill{};
+        for (std::size_t i = 0; i < N; ++i) {
+            const std::size_t b = p.bucket[i];
+            p.items[p.offsets[b] + fill[b]++] = i;
+        }
+        return p;
+    }
+
+} // namespace etools::meta
+
+#endif // ETOOLS_META_ALGORITHM_TPP_
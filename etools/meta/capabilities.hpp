@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file capabilities.hpp
+*
+* @brief Standard capability probes: members a type can expose to opt into library fast paths.
+*
+* @ingroup etools_meta etools::meta
+*
+* The containers in etools look for a small, fixed vocabulary of members on
+* user types and switch to a cheaper code path when they find one. Exposing
+* the member is the whole opt-in - there is no trait to specialise and no
+* registration step. The one exception is the wire format: `fields()` alone
+* does not change how `buffer` packs a type, the `wire_fields` marker does, so
+* an existing method named `fields` cannot silently alter a protocol. The
+* probes are:
+*
+* | Member | Probe | Used by |
+* |---|---|---|
+* | `void reinit(Args...)` | `is_reinitializable_v<T, Args...>` | `memory::slot::emplace` recycles a live object instead of destroy + construct |
+* | `static constexpr bool relocatable = true;` | `is_relocatable_v<T>` | `memory::slot` moves by `memcpy` and skips the source destructor |
+* | `static constexpr K key = ...;` | `has_static_key_v<T>` / `static_key<T>` | `factories::keyed_dispatch_factory` registers `T` under `T::key` |
+* | `auto fields()` returning `std::tie(...)` | `has_fields_v<T>` | building block of `has_wire_fields_v` |
+* | the above plus `static constexpr bool wire_fields = true;` | `has_wire_fields_v<T>` | `memory::buffer` / `buffer_view` serialise the listed fields instead of the object bytes |
+*
+* ### Example
+* @code
+* struct packet {
+*     std::uint32_t id;
+*     std::uint8_t  flags;            // 3 bytes of padding follow
+*     std::uint64_t stamp;
+*
+*     static constexpr std::uint32_t key = 7;          // dispatch_factory key
+*     static constexpr bool relocatable = true;        // memcpy moves are safe
+*     void reinit(std::uint32_t i) { id = i; flags = 0; stamp = 0; }
+*     static constexpr bool wire_fields = true;         // pack the fields below
+*     auto fields()       { return std::tie(id, flags, stamp); }   // 13 bytes on the wire
+*     auto fields() const { return std::tie(id, flags, stamp); }
+* };
+* @endcode
+*
+* @note `relocatable = true` is a promise the compiler cannot check: the type
+*       must not hold pointers into itself or register its address anywhere.
+*       Formally, the standard only sanctions byte copies of trivially copyable
+*       types; like every trivial-relocation scheme, this relies on the
+*       behaviour all mainstream compilers give it.
+* @note The probes do not use the `info_gen.hpp` macros. Each macro expansion
+*       defines public names such as `etools::meta::has_static_member_variable_key`
+*       at namespace scope, and a second expansion of the same macro is a
+*       redefinition. If this header expanded them, user code that also included
+*       it could no longer write `generate_has_static_member_variable(key)`. The
+*       detectors are therefore written with `std::void_t` in
+*       `etools::meta::details`.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_CAPABILITIES_HPP_
+#define ETOOLS_META_CAPABILITIES_HPP_
+#include <tuple>        // For std::tuple
+#include <type_traits>  // For std::is_trivially_copyable_v
+#include <utility>      // For std::declval
+
+namespace etools::meta {
+
+    namespace details {
+        template<typename Void, typename T, typename... Args>
+        struct detect_reinit : std::false_type {};
+
+        template<typename T, typename... Args>
+        struct detect_reinit<std::void_t<decltype(std::declval<T&>().reinit(std::declval<Args>()...))>, T, Args...>
+            : std::true_type {};
+
+        /// @brief `T::relocatable` names a static data member (not a non-static member or a function).
+        template<typename T, typename = void>
+        struct detect_static_relocatable : std::false_type {};
+
+        template<typename T>
+        struct detect_static_relocatable<T, std::void_t<decltype(&T::relocatable)>>
+            : std::bool_constant<!std::is_member_pointer_v<decltype(&T::relocatable)> &&
+                                 !std::is_function_v<std::remove_pointer_t<decltype(&T::relocatable)>>> {};
+
+        /// @brief `T::key` names a static data member (not a non-static member or a function).
+        template<typename T, typename = void>
+        struct detect_static_key : std::false_type {};
+
+        template<typename T>
+        struct detect_static_key<T, std::void_t<decltype(&T::key)>>
+            : std::bool_constant<!std::is_member_pointer_v<decltype(&T::key)> &&
+                                 !std::is_function_v<std::remove_pointer_t<decltype(&T::key)>>> {};
+
+        template<typename T, typename = void>
+        struct detect_fields : std::false_type {};
+
+        template<typename T>
+        struct detect_fields<T, std::void_t<decltype(std::declval<T&>().fields())>> : std::true_type {};
+
+        /// @brief `T::wire_fields` names a static data member (not a non-static member or a function).
+        template<typename T, typename = void>
+        struct detect_static_wire_fields : std::false_type {};
+
+        template<typename T>
+        struct detect_static_wire_fields<T, std::void_t<decltype(&T::wire_fields)>>
+            : std::bool_constant<!std::is_member_pointer_v<decltype(&T::wire_fields)> &&
+                                 !std::is_function_v<std::remove_pointer_t<decltype(&T::wire_fields)>>> {};
+    } // namespace details
+
+    /**
+    * @brief `true` if `t.reinit(std::declval<Args>()...)` is well-formed on a `T&`.
+    *
+    * A type that opts in promises that `reinit(args...)` leaves a live object in
+    * the same observable state as `T(args...)` would.
+    */
+    template<typename T, typename... Args>
+    inline constexpr bool is_reinitializable_v = details::detect_reinit<void, T, Args...>::value;
+
+    namespace details {
+        template<typename T, bool = detect_static_relocatable<T>::value>
+        struct relocatable_marker : std::false_type {};
+
+        template<typename T>
+        struct relocatable_marker<T, true> : std::bool_constant<static_cast<bool>(T::relocatable)> {};
+
+        template<typename T>
+        struct is_std_tuple : std::false_type {};
+
+        template<typename... Us>
+        struct is_std_tuple<std::tuple<Us...>> : std::true_type {};
+
+        /// @brief A `std::tuple` of non-const lvalue references, as `std::tie` returns.
+        template<typename T>
+        struct is_tie_tuple : std::false_type {};
+
+        template<typename... Us>
+        struct is_tie_tuple<std::tuple<Us...>>
+            : std::bool_constant<((std::is_lvalue_reference_v<Us> &&
+                                   !std::is_const_v<std::remove_reference_t<Us>>) && ...)> {};
+
+        template<typename T, bool = detect_static_wire_fields<T>::value>
+        struct wire_fields_marker : std::false_type {};
+
+        template<typename T>
+        struct wire_fields_marker<T, true> : std::bool_constant<static_cast<bool>(T::wire_fields)> {};
+    } // namespace details
+
+    /**
+    * @brief `true` if a `T` may be moved by copying its bytes and forgetting the source.
+    *
+    * Holds for trivially copyable types and for types that declare
+    * `static constexpr bool relocatable = true;` (e.g. types owning a heap
+    * pointer: the bytes move, the source is never destroyed).
+    */
+    template<typename T>
+    struct is_relocatable
+        : std::bool_constant<std::is_trivially_copyable_v<T> || details::relocatable_marker<T>::value> {};
+
+    /**
+    * @brief Helper variable template for `is_relocatable`.
+    */
+    template<typename T>
+    inline constexpr bool is_relocatable_v = is_relocatable<T>::value;
+
+    /**
+    * @brief `true` if `T` declares a static data member named `key`.
+    */
+    template<typename T>
+    inline constexpr bool has_static_key_v = details::detect_static_key<T>::value;
+
+    /**
+    * @brief Key extractor reading `T::key`, for `dispatch_factory` and `sorted_value_table`.
+    */
+    template<typename T>
+    struct static_key {
+        static_assert(has_static_key_v<T>, "static_key<T>: T must declare a static data member `key`");
+        static constexpr auto value = T::key;
+    };
+
+    /**
+    * @brief `true` if `t.fields()` is well-formed on a `T&` and returns a `std::tuple`
+    *        of non-const lvalue references (`std::tie(...)`).
+    *
+    * A tuple returned by value is rejected: assigning through it would write into a
+    * temporary and leave the members untouched.
+    */
+    template<typename T, typename = void>
+    struct has_fields : std::false_type {};
+
+    template<typename T>
+    struct has_fields<T, std::enable_if_t<details::detect_fields<T>::value>>
+        : details::is_tie_tuple<decltype(std::declval<T&>().fields())> {};
+
+    /**
+    * @brief Helper variable template for `has_fields`.
+    */
+    template<typename T>
+    inline constexpr bool has_fields_v = has_fields<T>::value;
+
+    /**
+    * @brief `true` if `T` is serialised field-wise: `has_fields_v<T>` and
+    *        `static constexpr bool wire_fields = true;`.
+    */
+    template<typename T>
+    struct has_wire_fields : std::bool_constant<has_fields_v<T> && details::wire_fields_marker<T>::value> {};
+
+    /**
+    * @brief Helper variable template for `has_wire_fields`.
+    */
+    template<typename T>
+    inline constexpr bool has_wire_fields_v = has_wire_fields<T>::value;
+
+} // namespace etools::meta
+
+#endif // ETOOLS_META_CAPABILITIES_HPP_
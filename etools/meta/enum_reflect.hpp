@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file enum_reflect.hpp
+*
+* @brief Compile-time enumerator discovery and O(1) enum <-> string conversion.
+*
+* @ingroup etools_meta etools::meta
+*
+* Enumerators are found without any registration: every value in
+* `enum_range<E>` is instantiated as a template argument and the compiler's
+* own spelling of it is read back from the function signature, exactly as
+* `type_name` does for types. Values the compiler prints as a cast
+* (`(color)5`) are not enumerators; everything else is, and the text after the
+* last `::` is its name.
+*
+* From that list three read-only tables are built at compile time:
+*
+* - `enum_values_v<E>` / `enum_names_v<E>`: the enumerators in ascending value
+*   order and their names.
+* - `to_string`: for contiguous enums a direct `names[v - first]` lookup; for
+*   sparse ones a `hashing::optimal_mph` keyed by the value (an `llut` or an
+*   `fks`, whichever is smaller).
+* - `from_string`: an `optimal_mph` keyed by the 64-bit hash of each name,
+*   followed by one string compare to reject non-members.
+*
+* ### Example
+* @code
+* #include "etools/meta/enum_reflect.hpp"
+* using namespace etools::meta;
+*
+* enum class color : std::uint8_t { red = 1, green = 2, blue = 4 };
+*
+* static_assert(enum_count_v<color> == 3);
+* static_assert(enum_name<color::green>() == "green");
+* static_assert(to_string(color::blue) == "blue");
+* static_assert(*from_string<color>("red") == color::red);
+* static_assert(!from_string<color>("purple"));
+* @endcode
+*
+* ### Range
+* Only values in `[enum_range<E>::min, enum_range<E>::max]` are probed:
+* `[-128, 127]` for signed underlying types, `[0, 255]` for unsigned ones
+* (clipped to the underlying type). Specialise `enum_range` to widen or narrow
+* it; compile time grows linearly with the range width.
+*
+* @note Needs `__PRETTY_FUNCTION__` (GCC, Clang) or `__FUNCSIG__` (MSVC).
+* @note When several enumerators share a value, the one the compiler prints is
+*       reported - usually the first declared. The other spellings are unknown
+*       to both directions.
+* @note Unscoped enums without a fixed underlying type may only be probed
+*       within their range of representable values; give them a fixed
+*       underlying type or a narrower `enum_range`.
+* @note Two distinct names hashing to the same 64-bit value would be rejected
+*       at compile time by `optimal_mph`'s duplicate-key check.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_ENUM_REFLECT_HPP_
+#define ETOOLS_META_ENUM_REFLECT_HPP_
+#include <array>       // For std::array
+#include <cstddef>     // For std::size_t
+#include <limits>      // For std::numeric_limits
+#include <optional>    // For std::optional
+#include <string_view> // For std::string_view
+#include <type_traits> // For std::underlying_type_t, std::is_enum_v
+
+namespace etools::meta {
+
+    /**
+    * @struct enum_range
+    *
+    * @brief Inclusive range of underlying values probed for enumerators of `E`.
+    *
+    * Specialise to change it:
+    * @code
+    * template<> struct etools::meta::enum_range<big_enum> {
+    *     static constexpr long long min = 0;
+    *     static constexpr long long max = 1023;
+    * };
+    * @endcode
+    *
+    * @tparam E Enumeration type.
+    */
+    template<typename E>
+    struct enum_range {
+        static_assert(std::is_enum_v<E>, "enum_range: E must be an enumeration");
+        using underlying_type = std::underlying_type_t<E>;
+
+        static constexpr long long min =
+            std::is_signed_v<underlying_type>
+                ? (static_cast<long long>((std::numeric_limits<underlying_type>::min)()) > -128
+                    ? static_cast<long long>((std::numeric_limits<underlying_type>::min)()) : -128)
+                : 0;
+
+        static constexpr long long max =
+            static_cast<unsigned long long>((std::numeric_limits<underlying_type>::max)())
+                < (std::is_signed_v<underlying_type> ? 127ULL : 255ULL)
+                ? static_cast<long long>((std::numeric_limits<underlying_type>::max)())
+                : (std::is_signed_v<underlying_type> ? 127 : 255);
+    };
+
+    namespace details {
+        template<typename E>
+        struct enum_tables;
+    } // namespace details
+
+    /**
+    * @brief Name of the enumerator `V`, or an empty view if `V` is not a named enumerator.
+    *
+    * Works for any value, inside or outside `enum_range`.
+    */
+    template<auto V>
+    [[nodiscard]] constexpr std::string_view enum_name() noexcept;
+
+    /// @brief Number of enumerators of `E` found in `enum_range<E>`.
+    template<typename E>
+    inline constexpr std::size_t enum_count_v = details::enum_tables<E>::count;
+
+    /// @brief Enumerators of `E` in ascending value order.
+    template<typename E>
+    inline constexpr const std::array<E, enum_count_v<E>>& enum_values_v = details::enum_tables<E>::values;
+
+    /// @brief Names of `enum_values_v<E>`, index for index.
+    template<typename E>
+    inline constexpr const std::array<std::string_view, enum_count_v<E>>& enum_names_v = details::enum_tables<E>::names;
+
+    /**
+    * @brief Position of `value` in `enum_values_v<E>`, or `enum_count_v<E>` if it is not an enumerator.
+    *
+    * O(1): a subtraction for contiguous enums, one perfect-hash probe otherwise.
+    */
+    template<typename E>
+    [[nodiscard]] constexpr std::size_t enum_index(E value) noexcept;
+
+    /**
+    * @brief Name of `value`, or an empty view if it is not an enumerator.
+    */
+    template<typename E>
+    [[nodiscard]] constexpr std::string_view to_string(E value) noexcept;
+
+    /**
+    * @brief Enumerator of `E` spelled exactly `name`, if any.
+    *
+    * O(|name|) for the hash plus one perfect-hash probe and one compare.
+    */
+    template<typename E>
+    [[nodiscard]] constexpr std::optional<E> from_string(std::string_view name) noexcept;
+
+} // namespace etools::meta
+
+#include "enum_reflect.tpp"
+#endif // ETOOLS_META_ENUM_REFLECT_HPP_
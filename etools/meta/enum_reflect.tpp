@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file enum_reflect.tpp
+*
+* @brief Definition of enum_reflect.hpp functions.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_ENUM_REFLECT_TPP_
+#define ETOOLS_META_ENUM_REFLECT_TPP_
+#include "enum_reflect.hpp"
+#include <utility>                     // For std::index_sequence
+#include "traits.hpp"                  // For always_false_v
+#include "type_id.hpp"                 // For details::hash_type_name
+#include "../hashing/optimal_mph.hpp"  // For optimal_mph
+
+namespace etools::meta::details {
+
+    /// @brief Full compiler-provided signature of this function for the value `V`.
+    template<typename E, E V>
+    constexpr std::string_view enum_signature() noexcept {
+    #if defined(__clang__) || defined(__GNUC__)
+        return __PRETTY_FUNCTION__;
+    #elif defined(_MSC_VER)
+        return __FUNCSIG__;
+    #else
+        static_assert(always_false_v<E>, "enum_name: unsupported compiler (needs __PRETTY_FUNCTION__ or __FUNCSIG__)");
+        return {};
+    #endif
+    }
+
+    /**
+    * @brief Extracts the enumerator name from an `enum_signature` string.
+    *
+    * GCC: `... [with E = ns::color; E V = ns::color::red; ...]`,
+    * Clang: `... [E = ns::color, V = ns::color::red]`,
+    * MSVC: `... enum_signature<enum ns::color,ns::color::red>(void)`.
+    * A non-enumerator is printed as a cast or a number and yields `""`.
+    */
+    constexpr std::string_view enumerator_of(std::string_view sig) noexcept {
+    #if defined(__clang__) || defined(__GNUC__)
+        const std::size_t at = sig.rfind("V = ");
+        if (at == std::string_view::npos) return {};
+        std::string_view v = sig.substr(at + 4);
+        v = v.substr(0, v.find_first_of(";]"));
+    #else
+        const std::size_t end = sig.rfind(">(void)");
+        if (end == std::string_view::npos) return {};
+        const std::size_t comma = sig.rfind(',', end);
+        std::string_view v = sig.substr(comma + 1, end - comma - 1);
+    #endif
+        if (v.empty() || v[0] == '(' || v[0] == '-' || (v[0] >= '0' && v[0] <= '9')) return {};
+        const std::size_t colon = v.rfind(':');
+        return colon == std::string_view::npos ? v : v.substr(colon + 1);
+    }
+
+    template<typename E, std::size_t... Is>
+    constexpr std::array<std::string_view, sizeof...(Is)> enum_scan(std::index_sequence<Is...>) noexcept {
+        constexpr long long lo = enum_range<E>::min;
+        return {{ enumerator_of(enum_signature<E, static_cast<E>(lo + static_cast<long long>(Is))>())... }};
+    }
+
+    template<std::size_t Span>
+    constexpr std::size_t enum_count_named(const std::array<std::string_view, Span>& all) noexcept {
+        std::size_t n = 0;
+        for (const auto& s : all) n += !s.empty();
+        return n;
+    }
+
+    /// @brief Probe results for every value in `enum_range<E>`, indexed by `value - min`.
+    template<typename E>
+    struct enum_probe {
+        static_assert(std::is_enum_v<E>, "enum reflection: E must be an enumeration");
+        static_assert(enum_range<E>::min <= enum_range<E>::max, "enum_range: min must not exceed max");
+
+        static constexpr std::size_t span = static_cast<std::size_t>(enum_range<E>::max - enum_range<E>::min) + 1;
+        static constexpr std::array<std::string_view, span> all = enum_scan<E>(std::make_index_sequence<span>{});
+        static constexpr std::size_t count = enum_count_named(all);
+    };
+
+    /// @brief Offset of `v` from `enum_range<E>::min`, as an unsigned key (wraps, never overflows).
+    template<typename E>
+    constexpr std::make_unsigned_t<std::underlying_type_t<E>> enum_key(E v) noexcept {
+        using key_t = std::make_unsigned_t<std::underlying_type_t<E>>;
+        return static_cast<key_t>(static_cast<key_t>(v) - static_cast<key_t>(enum_range<E>::min));
+    }
+
+    template<typename E, std::size_t N>
+    constexpr std::array<E, N> enum_collect_values() noexcept {
+        std::array<E, N> out{};
+        std::size_t k = 0;
+        for (std::size_t i = 0; i < enum_probe<E>::span; ++i)
+            if (!enum_probe<E>::all[i].empty())
+                out[k++] = static_cast<E>(enum_range<E>::min + static_cast<long long>(i));
+        return out;
+    }
+
+    template<typename E, std::size_t N>
+    constexpr std::array<std::string_view, N> enum_collect_names() noexcept {
+        std::array<std::string_view, N> out{};
+        std::size_t k = 0;
+        for (const auto& s : enum_probe<E>::all)
+            if (!s.empty()) out[k++] = s;
+        return out;
+    }
+
+    template<typename E, std::size_t N>
+    constexpr bool enum_contiguous(const std::array<E, N>& values) noexcept {
+        return N == 0 || static_cast<std::size_t>(enum_key(values[N - 1]) - enum_key(values[0])) == N - 1;
+    }
+
+    template<typename E, std::size_t N>
+    constexpr std::array<std::uint64_t, N> enum_name_hashes(const std::array<std::string_view, N>& names) noexcept {
+        std::array<std::uint64_t, N> out{};
+        for (std::size_t i = 0; i < N; ++i) out[i] = hash_type_name(names[i]);
+        return out;
+    }
+
+    template<typename E>
+    struct enum_tables {
+        using key_t = std::make_unsigned_t<std::underlying_type_t<E>>;
+
+        static constexpr std::size_t count = enum_probe<E>::count;
+        static_assert(count > 0, "enum reflection: no enumerator found in enum_range<E>");
+
+        static constexpr std::array<E, count> values = enum_collect_values<E, count>();
+        static constexpr std::array<std::string_view, count> names = enum_collect_names<E, count>();
+        static constexpr bool contiguous = enum_contiguous(values);
+        static constexpr std::array<std::uint64_t, count> name_hashes = enum_name_hashes<E>(names);
+    };
+
+    /// @brief Perfect hash from `enum_key(value)` to the position in `enum_values_v<E>`.
+    template<typename E, std::size_t... Is>
+    constexpr const auto& enum_value_mph(std::index_sequence<Is...>) noexcept {
+        using key_t = typename enum_tables<E>::key_t;
+        return hashing::optimal_mph<key_t>::template instance<enum_key(enum_tables<E>::values[Is])...>();
+    }
+
+    /// @brief Perfect hash from the 64-bit name hash to the position in `enum_names_v<E>`.
+    template<typename E, std::size_t... Is>
+    constexpr const auto& enum_name_mph(std::index_sequence<Is...>) noexcept {
+        return hashing::optimal_mph<std::uint64_t>::template instance<enum_tables<E>::name_hashes[Is]...>();
+    }
+
+} // namespace etools::meta::details
+
+namespace etools::meta {
+
+    template<auto V>
+    constexpr std::string_view enum_name() noexcept {
+        static_assert(std::is_enum_v<decltype(V)>, "enum_name: V must be an enumerator value");
+        return details::enumerator_of(details::enum_signature<decltype(V), V>());
+    }
+
+    template<typename E>
+    constexpr std::size_t enum_index(E value) noexcept {
+        using tables = details::enum_tables<E>;
+        if constexpr (tables::contiguous) {
+            const std::size_t i = static_cast<std::size_t>(
+                static_cast<typename tables::key_t>(details::enum_key(value) - details::enum_key(tables::values[0])));
+            return i < tables::count ? i : tables::count;
+        } else {
+            constexpr const auto& table = details::enum_value_mph<E>(std::make_index_sequence<tables::count>{});
+            return table(details::enum_key(value));
+        }
+    }
+
+    template<typename E>
+    constexpr std::string_view to_string(E value) noexcept {
+        const std::size_t i = enum_index(value);
+        return i < enum_count_v<E> ? enum_names_v<E>[i] : std::string_view{};
+    }
+
+    template<typename E>
+    constexpr std::optional<E> from_string(std::string_view name) noexcept {
+        using tables = details::enum_tables<E>;
+        constexpr const auto& table = details::enum_name_mph<E>(std::make_index_sequence<tables::count>{});
+        const std::size_t i = table(details::hash_type_name(name));
+        if (i < tables::count && tables::names[i] == name) return tables::values[i];
+        return std::nullopt;
+    }
+
+} // namespace etools::meta
+
+#endif // ETOOLS_META_ENUM_REFLECT_TPP_
@@ -0,0 +1,488 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file fast_variant.hpp
+*
+* @brief Tagged union with a compact discriminator and O(1) jump-table visitation.
+*
+* @ingroup etools_meta etools::meta
+*
+* `fast_variant<Ts...>` is a drop-in alternative to `unique_variant_t<Ts...>` for
+* hot paths where `std::visit` is the bottleneck:
+*
+* - **Deduplicated.** The alternative list is `unique_typelist_t<Ts...>`, so
+*   `fast_variant<int, double, int>` and `fast_variant<int, double>` are the same
+*   type and a one-lambda-per-type `overload{...}` visitor is always well-formed.
+* - **Compact discriminator.** The active index is stored in
+*   `smallest_uint_t<sizeof...(Ts)>` — one byte for up to 255 alternatives —
+*   placed after the storage block so it usually lands in tail padding.
+* - **Jump-table visitation.** Up to 16 alternatives, `visit` lowers to a
+*   dense `switch` that compilers emit as a single bounds-free jump table whose
+*   targets are the inlined visitor bodies. Beyond that it indexes a
+*   `constexpr` array of function pointers: one indirect call regardless of
+*   the alternative count. Neither path checks for a valueless state in
+*   release builds.
+* - **Trivial fast paths.** When every alternative is trivially copyable so
+*   is the variant: copies and moves are the implicit byte copy, and
+*   `std::is_trivially_copyable_v` holds (the variant can be `memcpy`'d, put in
+*   a `slot` without a move loop, and so on).
+*
+* ### Example
+* @code
+* #include "etools/meta/fast_variant.hpp"
+* #include "etools/meta/overload.hpp"
+* using namespace etools::meta;
+*
+* fast_variant<int, float, std::string> v = 3.5f;
+*
+* v.visit(overload{
+*     [](int i)                { ... },
+*     [](float f)              { ... },
+*     [](const std::string& s) { ... },
+* });
+*
+* v.emplace<std::string>("hello");
+* assert(v.holds<std::string>());
+* if (auto* s = v.get_if<std::string>()) s->append("!");
+* @endcode
+*
+* @note Converting construction / assignment only accepts a value whose decayed
+*       type *is* one of the alternatives. `std::variant`'s overload-resolution
+*       based conversion (e.g. `const char*` -> `std::string`) is intentionally
+*       not replicated; use `std::in_place_type<T>` or `emplace<T>(...)` instead.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_FAST_VARIANT_HPP_
+#define ETOOLS_META_FAST_VARIANT_HPP_
+#include <cstddef>     // For std::byte, std::size_t
+#include <functional>  // For std::invoke
+#include <new>         // For std::launder
+#include <type_traits> // For std::invoke_result_t, std::decay_t, ...
+#include <utility>     // For std::in_place_type_t, std::in_place_index_t, std::forward
+#include "traits.hpp"         // For smallest_uint_t, nth_t, index_of_v, is_distinct_v
+#include "typelist.hpp"       // For typelist
+#include "unique_variant.hpp" // For unique_typelist_t
+
+namespace etools::meta::details {
+
+    /**
+    * @brief Largest `sizeof` across `Ts...`.
+    */
+    template<typename... Ts>
+    constexpr std::size_t fv_max_size() noexcept {
+        std::size_t m = 0;
+        ((m = sizeof(Ts) > m ? sizeof(Ts) : m), ...);
+        return m;
+    }
+
+    /**
+    * @brief Reinterprets the storage as the alternative referenced by `Q`
+    *        and invokes `f` with it.
+    *
+    * @tparam R   Common result type of the visitor.
+    * @tparam F   Visitor type (forwarding reference).
+    * @tparam Q   Qualified alternative reference (`T&`, `const T&` or `T&&`).
+    * @tparam Ptr `void*` or `const void*`, matching the constness of `Q`.
+    */
+    template<typename R, typename F, typename Q, typename Ptr>
+    R fv_thunk(F&& f, Ptr storage) {
+        using T = std::remove_reference_t<Q>;
+        return std::invoke(std::forward<F>(f), static_cast<Q>(*std::launder(static_cast<T*>(storage))));
+    }
+
+    /**
+    * @brief One function pointer per alternative, indexed by the discriminator.
+    */
+    template<typename R, typename F, typename Ptr, typename... Qs>
+    inline constexpr R (*fv_table[])(F&&, Ptr) = { &fv_thunk<R, F, Qs, Ptr>... };
+
+    /// @brief Largest alternative count lowered to a `switch`; longer lists use `fv_table`.
+    inline constexpr std::size_t fv_switch_limit = 16;
+
+    /**
+    * @brief Resolves the common visitor result over `Qs...` and dispatches on the index.
+    *
+    * Up to `fv_switch_limit` alternatives the visit is a dense `switch`: case
+    * labels past the end of `Qs...` are discarded with `if constexpr`, so the
+    * compiler emits one fully-covered jump table whose targets are the
+    * *inlined* visitor bodies. Longer lists index `fv_table` instead — one
+    * indirect call, independent of the alternative count.
+    */
+    template<typename... Qs>
+    struct fv_dispatch {
+        template<typename F, typename Ptr>
+        static decltype(auto) run(std::size_t index, F&& f, Ptr storage) {
+            using R = std::invoke_result_t<F, nth_t<0, Qs...>>;
+            static_assert((std::is_same_v<R, std::invoke_result_t<F, Qs>> and ...),
+                "fast_variant::visit: the visitor must return the same type for every alternative");
+            if constexpr (sizeof...(Qs) <= fv_switch_limit)
+                return by_switch<R>(index, std::forward<F>(f), storage);
+            else
+                return fv_table<R, F, Ptr, Qs...>[index](std::forward<F>(f), storage);
+        }
+
+    private:
+        template<typename R, typename F, typename Ptr>
+        static R by_switch(std::size_t index, F&& f, Ptr storage) {
+            constexpr std::size_t n = sizeof...(Qs);
+            static_assert(fv_switch_limit == 16, "fv_dispatch::by_switch spells out exactly 16 cases");
+            switch (index) {
+#define ETOOLS_FV_CASE(K) \
+                case K: \
+                    if constexpr ((K) < n) \
+                        return fv_thunk<R, F, nth_t<(K) < n ? (K) : 0, Qs...>, Ptr>(std::forward<F>(f), storage); \
+                    else break;
+                ETOOLS_FV_CASE(0)  ETOOLS_FV_CASE(1)  ETOOLS_FV_CASE(2)  ETOOLS_FV_CASE(3)
+                ETOOLS_FV_CASE(4)  ETOOLS_FV_CASE(5)  ETOOLS_FV_CASE(6)  ETOOLS_FV_CASE(7)
+                ETOOLS_FV_CASE(8)  ETOOLS_FV_CASE(9)  ETOOLS_FV_CASE(10) ETOOLS_FV_CASE(11)
+                ETOOLS_FV_CASE(12) ETOOLS_FV_CASE(13) ETOOLS_FV_CASE(14) ETOOLS_FV_CASE(15)
+#undef ETOOLS_FV_CASE
+                default: break;
+            }
+            // The caller guarantees index < n; let the optimizer drop the range check.
+        #if defined(__GNUC__) || defined(__clang__)
+            __builtin_unreachable();
+        #elif defined(_MSC_VER)
+            __assume(0);
+        #endif
+            return fv_thunk<R, F, nth_t<0, Qs...>, Ptr>(std::forward<F>(f), storage);
+        }
+    };
+
+    /**
+    * @brief Storage and discriminator of `basic_fast_variant`, with implicit
+    *        (trivial) special members.
+    *
+    * Used as is when every alternative is trivially copyable, so the variant is
+    * trivially copyable too; otherwise `fv_storage` adds the per-alternative
+    * copy / move logic on top.
+    *
+    * @tparam Ts Distinct alternatives.
+    */
+    template<typename... Ts>
+    class fv_layout {
+    protected:
+        using index_type = smallest_uint_t<sizeof...(Ts)>;
+        static constexpr std::size_t npos = sizeof...(Ts);
+        static constexpr bool all_trivially_destructible = (std::is_trivially_destructible_v<Ts> and ...);
+
+        /// @brief User-provided so value-initialization does not zero-fill the storage.
+        fv_layout() noexcept {}
+
+        template<typename T>
+        T* ptr() noexcept { return std::launder(reinterpret_cast<T*>(_storage)); }
+        template<typename T>
+        const T* ptr() const noexcept { return std::launder(reinterpret_cast<const T*>(_storage)); }
+
+        /// @brief Constructs alternative `I`; the variant is valueless while `T`'s constructor runs.
+        template<std::size_t I, typename... Args>
+        nth_t<I, Ts...>& construct(Args&&... args);
+
+        /// @brief Destroys the active alternative, if any, and marks the variant valueless.
+        void destroy() noexcept;
+
+        alignas(Ts...) std::byte _storage[fv_max_size<Ts...>()];
+        index_type _index = static_cast<index_type>(npos);
+    };
+
+    /**
+    * @brief `fv_layout` plus the copy / move logic for alternatives that are not
+    *        all trivially copyable.
+    *
+    * The special members live here so that `basic_fast_variant` can default its
+    * own and let `fv_ctor_ctrl` / `fv_assign_ctrl` delete the ones its
+    * alternatives do not support. Members of this class are instantiated only
+    * when used, so a deleted operation never instantiates its body.
+    *
+    * @tparam Ts Distinct alternatives.
+    */
+    template<typename... Ts>
+    class fv_storage : protected fv_layout<Ts...> {
+    protected:
+        using base = fv_layout<Ts...>;
+        using typename base::index_type;
+        using base::npos;
+        using base::_storage;
+        using base::_index;
+        using base::destroy;
+
+        fv_storage() noexcept = default;
+        fv_storage(const fv_storage& other);
+        fv_storage(fv_storage&& other) noexcept((std::is_nothrow_move_constructible_v<Ts> and ...));
+        fv_storage& operator=(const fv_storage& other);
+        fv_storage& operator=(fv_storage&& other) noexcept(
+            (std::is_nothrow_move_constructible_v<Ts> and ...) and (std::is_nothrow_move_assignable_v<Ts> and ...));
+        ~fv_storage() noexcept;
+    };
+
+    /// @brief `fv_layout` when every alternative is trivially copyable, else `fv_storage`.
+    template<typename... Ts>
+    using fv_storage_t = std::conditional_t<(std::is_trivially_copyable_v<Ts> and ...), fv_layout<Ts...>, fv_storage<Ts...>>;
+
+    /**
+    * @brief Deletes the copy / move constructor of `basic_fast_variant` when an
+    *        alternative lacks it (cf. `memory::details::slot_move_ctrl`).
+    */
+    template<bool Copy, bool Move>
+    struct fv_ctor_ctrl {};
+
+    template<>
+    struct fv_ctor_ctrl<false, true> {
+        fv_ctor_ctrl() = default;
+        fv_ctor_ctrl(const fv_ctor_ctrl&) = delete;
+        fv_ctor_ctrl(fv_ctor_ctrl&&) = default;
+        fv_ctor_ctrl& operator=(const fv_ctor_ctrl&) = default;
+        fv_ctor_ctrl& operator=(fv_ctor_ctrl&&) = default;
+    };
+
+    template<>
+    struct fv_ctor_ctrl<true, false> {
+        fv_ctor_ctrl() = default;
+        fv_ctor_ctrl(const fv_ctor_ctrl&) = default;
+        fv_ctor_ctrl(fv_ctor_ctrl&&) = delete;
+        fv_ctor_ctrl& operator=(const fv_ctor_ctrl&) = default;
+        fv_ctor_ctrl& operator=(fv_ctor_ctrl&&) = default;
+    };
+
+    template<>
+    struct fv_ctor_ctrl<false, false> {
+        fv_ctor_ctrl() = default;
+        fv_ctor_ctrl(const fv_ctor_ctrl&) = delete;
+        fv_ctor_ctrl(fv_ctor_ctrl&&) = delete;
+        fv_ctor_ctrl& operator=(const fv_ctor_ctrl&) = default;
+        fv_ctor_ctrl& operator=(fv_ctor_ctrl&&) = default;
+    };
+
+    /**
+    * @brief Deletes the copy / move assignment of `basic_fast_variant` when an
+    *        alternative cannot be both constructed and assigned that way.
+    */
+    template<bool Copy, bool Move>
+    struct fv_assign_ctrl {};
+
+    template<>
+    struct fv_assign_ctrl<false, true> {
+        fv_assign_ctrl() = default;
+        fv_assign_ctrl(const fv_assign_ctrl&) = default;
+        fv_assign_ctrl(fv_assign_ctrl&&) = default;
+        fv_assign_ctrl& operator=(const fv_assign_ctrl&) = delete;
+        fv_assign_ctrl& operator=(fv_assign_ctrl&&) = default;
+    };
+
+    template<>
+    struct fv_assign_ctrl<true, false> {
+        fv_assign_ctrl() = default;
+        fv_assign_ctrl(const fv_assign_ctrl&) = default;
+        fv_assign_ctrl(fv_assign_ctrl&&) = default;
+        fv_assign_ctrl& operator=(const fv_assign_ctrl&) = default;
+        fv_assign_ctrl& operator=(fv_assign_ctrl&&) = delete;
+    };
+
+    template<>
+    struct fv_assign_ctrl<false, false> {
+        fv_assign_ctrl() = default;
+        fv_assign_ctrl(const fv_assign_ctrl&) = default;
+        fv_assign_ctrl(fv_assign_ctrl&&) = default;
+        fv_assign_ctrl& operator=(const fv_assign_ctrl&) = delete;
+        fv_assign_ctrl& operator=(fv_assign_ctrl&&) = delete;
+    };
+
+} // namespace etools::meta::details
+
+namespace etools::meta {
+
+    /**
+    * @class basic_fast_variant
+    *
+    * @brief Tagged union over an already-distinct `typelist`.
+    *
+    * Most code should spell the type as `fast_variant<Ts...>`, which
+    * deduplicates first. The primary template rejects anything that is not a
+    * `typelist`.
+    *
+    * @tparam List `typelist<Ts...>` of distinct, non-reference, object types.
+    */
+    template<typename List>
+    class basic_fast_variant {
+        static_assert(always_false_v<List>, "basic_fast_variant expects a meta::typelist<Ts...>");
+    };
+
+    template<typename... Ts>
+    class basic_fast_variant<typelist<Ts...>>
+        : private details::fv_storage_t<Ts...>,
+          private details::fv_ctor_ctrl<(std::is_copy_constructible_v<Ts> and ...),
+                                        (std::is_move_constructible_v<Ts> and ...)>,
+          private details::fv_assign_ctrl<(std::is_copy_constructible_v<Ts> and ...) and (std::is_copy_assignable_v<Ts> and ...),
+                                          (std::is_move_constructible_v<Ts> and ...) and (std::is_move_assignable_v<Ts> and ...)> {
+        static_assert(sizeof...(Ts) > 0, "fast_variant needs at least one alternative");
+        static_assert(is_distinct_v<Ts...>, "basic_fast_variant alternatives must be distinct (use fast_variant<Ts...>)");
+        static_assert((std::is_object_v<Ts> and ...) and not (std::is_array_v<Ts> or ...),
+            "fast_variant alternatives must be non-array object types");
+        static_assert((std::is_nothrow_destructible_v<Ts> and ...),
+            "fast_variant alternatives must be nothrow-destructible");
+
+        using storage = details::fv_storage_t<Ts...>;
+        using storage::_storage;
+        using storage::_index;
+        using storage::destroy;
+
+        template<typename T>
+        using if_alternative = std::enable_if_t<(index_of_v<std::decay_t<T>, Ts...> < sizeof...(Ts))>;
+
+    public:
+        /// @brief The distinct alternatives, in declaration order.
+        using types = typelist<Ts...>;
+        /// @brief Narrowest unsigned type able to hold every index plus `npos`.
+        using index_type = smallest_uint_t<sizeof...(Ts)>;
+
+        /// @brief Number of alternatives.
+        static constexpr std::size_t alternatives = sizeof...(Ts);
+        /// @brief Index reported by a valueless variant (see `valueless()`).
+        static constexpr std::size_t npos = sizeof...(Ts);
+
+        /// @brief Index of alternative `T`, or `npos` if `T` is not an alternative.
+        template<typename T>
+        static constexpr std::size_t index_of = index_of_v<T, Ts...>;
+
+        /// @brief Alternative at index `I`.
+        template<std::size_t I>
+        using alternative_t = nth_t<I, Ts...>;
+
+        /**
+        * @brief Value-initialises the first alternative (same as `std::variant`).
+        */
+        basic_fast_variant() noexcept(std::is_nothrow_default_constructible_v<alternative_t<0>>);
+
+        /**
+        * @brief Constructs the alternative whose type is exactly `std::decay_t<T>`.
+        */
+        template<typename T, typename = if_alternative<T>>
+        basic_fast_variant(T&& value) noexcept(std::is_nothrow_constructible_v<std::decay_t<T>, T&&>);
+
+        /**
+        * @brief Constructs alternative `T` in place from `args...`.
+        */
+        template<typename T, typename... Args>
+        explicit basic_fast_variant(std::in_place_type_t<T>, Args&&... args);
+
+        /**
+        * @brief Constructs alternative `I` in place from `args...`.
+        */
+        template<std::size_t I, typename... Args>
+        explicit basic_fast_variant(std::in_place_index_t<I>, Args&&... args);
+
+        /**
+        * @name Copy and move
+        * Each is deleted unless every alternative supports it (assignment also needs
+        * the matching constructor), so `std::is_copy_constructible_v` and friends
+        * report the truth. Moves are `noexcept` iff every alternative's are.
+        */
+        ///@{
+        basic_fast_variant(const basic_fast_variant& other) = default;
+        basic_fast_variant(basic_fast_variant&& other) = default;
+        basic_fast_variant& operator=(const basic_fast_variant& other) = default;
+        basic_fast_variant& operator=(basic_fast_variant&& other) = default;
+        ///@}
+
+        /**
+        * @brief Assigns to the active alternative if it has type `std::decay_t<T>`,
+        *        otherwise destroys it and constructs that alternative.
+        */
+        template<typename T, typename = if_alternative<T>>
+        basic_fast_variant& operator=(T&& value);
+
+        ~basic_fast_variant() = default;
+
+        /**
+        * @brief Destroys the active alternative and constructs `T` from `args...`.
+        *
+        * @return Reference to the new value.
+        */
+        template<typename T, typename... Args>
+        T& emplace(Args&&... args);
+
+        /**
+        * @brief Destroys the active alternative and constructs alternative `I` from `args...`.
+        */
+        template<std::size_t I, typename... Args>
+        alternative_t<I>& emplace(Args&&... args);
+
+        /// @brief Index of the active alternative, or `npos` if valueless.
+        [[nodiscard]] std::size_t index() const noexcept;
+        /**
+        * @brief `true` once an alternative constructor threw after the old value was destroyed.
+        *
+        * That can happen in `emplace`, in the converting `operator=` when the new value is
+        * a different alternative, and in copy/move assignment from a variant holding a
+        * different alternative. Copying, moving or assigning from a valueless variant
+        * also yields a valueless variant.
+        */
+        [[nodiscard]] bool valueless() const noexcept;
+
+        /// @brief `true` iff the active alternative is `T`.
+        template<typename T>
+        [[nodiscard]] bool holds() const noexcept;
+
+        /**
+        * @brief Unchecked access to alternative `T`. Asserts in debug if `T` is not active.
+        */
+        template<typename T> [[nodiscard]] T& get() & noexcept;
+        template<typename T> [[nodiscard]] const T& get() const& noexcept;
+        template<typename T> [[nodiscard]] T&& get() && noexcept;
+
+        /**
+        * @brief Unchecked access to alternative `I`. Asserts in debug if `I` is not active.
+        */
+        template<std::size_t I> [[nodiscard]] alternative_t<I>& get() & noexcept;
+        template<std::size_t I> [[nodiscard]] const alternative_t<I>& get() const& noexcept;
+        template<std::size_t I> [[nodiscard]] alternative_t<I>&& get() && noexcept;
+
+        /**
+        * @brief Pointer to alternative `T` if it is active, `nullptr` otherwise.
+        */
+        template<typename T> [[nodiscard]] T* get_if() noexcept;
+        template<typename T> [[nodiscard]] const T* get_if() const noexcept;
+
+        /**
+        * @brief Invokes `f` with the active alternative through the jump table.
+        *
+        * The reference category follows the variant's (`T&`, `const T&`, `T&&`).
+        * Every call `f(alt)` must yield the same type, which is the return type.
+        * Asserts in debug if the variant is valueless.
+        */
+        template<typename F> decltype(auto) visit(F&& f) &;
+        template<typename F> decltype(auto) visit(F&& f) const&;
+        template<typename F> decltype(auto) visit(F&& f) &&;
+
+    };
+
+    /**
+    * @brief Tagged union over the distinct members of `Ts...`.
+    *
+    * Repeats collapse to one alternative (see `unique_typelist_t`), so the
+    * spelling order of duplicates never changes the type.
+    */
+    template<typename... Ts>
+    using fast_variant = basic_fast_variant<unique_typelist_t<Ts...>>;
+
+    /**
+    * @brief Free-function spelling of `v.visit(f)`, mirroring `std::visit(f, v)`.
+    */
+    template<typename F, typename... Ts>
+    decltype(auto) visit(F&& f, basic_fast_variant<typelist<Ts...>>& v);
+    template<typename F, typename... Ts>
+    decltype(auto) visit(F&& f, const basic_fast_variant<typelist<Ts...>>& v);
+    template<typename F, typename... Ts>
+    decltype(auto) visit(F&& f, basic_fast_variant<typelist<Ts...>>&& v);
+
+} // namespace etools::meta
+
+#include "fast_variant.tpp"
+#endif // ETOOLS_META_FAST_VARIANT_HPP_
@@ -0,0 +1,288 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file fast_variant.tpp
+*
+* @brief Definition of fast_variant.hpp methods.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_FAST_VARIANT_TPP_
+#define ETOOLS_META_FAST_VARIANT_TPP_
+#include "fast_variant.hpp"
+#include <cassert>
+
+namespace etools::meta {
+
+    // --- storage ------------------------------------------------------------
+
+    namespace details {
+
+        template<typename... Ts>
+        template<std::size_t I, typename... Args>
+        nth_t<I, Ts...>& fv_layout<Ts...>::construct(Args&&... args) {
+            using T = nth_t<I, Ts...>;
+            // Mark valueless first: if T's constructor throws, the variant stays consistent.
+            _index = static_cast<index_type>(npos);
+            T* p = ::new (static_cast<void*>(_storage)) T(std::forward<Args>(args)...);
+            _index = static_cast<index_type>(I);
+            return *p;
+        }
+
+        template<typename... Ts>
+        void fv_layout<Ts...>::destroy() noexcept {
+            if constexpr (not all_trivially_destructible) {
+                if (_index != npos) {
+                    fv_dispatch<Ts&...>::run(_index, [](auto& alt) noexcept {
+                        using T = std::remove_reference_t<decltype(alt)>;
+                        alt.~T();
+                    }, static_cast<void*>(_storage));
+                }
+            }
+            _index = static_cast<index_type>(npos);
+        }
+
+        template<typename... Ts>
+        fv_storage<Ts...>::fv_storage(const fv_storage& other) : base{} {
+            if (other._index == npos) return;
+            fv_dispatch<const Ts&...>::run(other._index, [this](const auto& alt) {
+                using T = std::decay_t<decltype(alt)>;
+                this->template construct<index_of_v<T, Ts...>>(alt);
+            }, static_cast<const void*>(other._storage));
+        }
+
+        template<typename... Ts>
+        fv_storage<Ts...>::fv_storage(fv_storage&& other)
+            noexcept((std::is_nothrow_move_constructible_v<Ts> and ...)) : base{} {
+            if (other._index == npos) return;
+            fv_dispatch<Ts&...>::run(other._index, [this](auto& alt) {
+                using T = std::decay_t<decltype(alt)>;
+                this->template construct<index_of_v<T, Ts...>>(std::move(alt));
+            }, static_cast<void*>(other._storage));
+        }
+
+        template<typename... Ts>
+        fv_storage<Ts...>& fv_storage<Ts...>::operator=(const fv_storage& other) {
+            if (this == &other) return *this;
+            if (other._index == npos) {
+                destroy();
+            } else if (_index == other._index) {
+                fv_dispatch<const Ts&...>::run(other._index, [this](const auto& alt) {
+                    using T = std::decay_t<decltype(alt)>;
+                    *this->template ptr<T>() = alt;
+                }, static_cast<const void*>(other._storage));
+            } else {
+                destroy();
+                fv_dispatch<const Ts&...>::run(other._index, [this](const auto& alt) {
+                    using T = std::decay_t<decltype(alt)>;
+                    this->template construct<index_of_v<T, Ts...>>(alt);
+                }, static_cast<const void*>(other._storage));
+            }
+            return *this;
+        }
+
+        template<typename... Ts>
+        fv_storage<Ts...>& fv_storage<Ts...>::operator=(fv_storage&& other) noexcept(
+            (std::is_nothrow_move_constructible_v<Ts> and ...) and (std::is_nothrow_move_assignable_v<Ts> and ...)) {
+            if (this == &other) return *this;
+            if (other._index == npos) {
+                destroy();
+            } else if (_index == other._index) {
+                fv_dispatch<Ts&...>::run(other._index, [this](auto& alt) {
+                    using T = std::decay_t<decltype(alt)>;
+                    *this->template ptr<T>() = std::move(alt);
+                }, static_cast<void*>(other._storage));
+            } else {
+                destroy();
+                fv_dispatch<Ts&...>::run(other._index, [this](auto& alt) {
+                    using T = std::decay_t<decltype(alt)>;
+                    this->template construct<index_of_v<T, Ts...>>(std::move(alt));
+                }, static_cast<void*>(other._storage));
+            }
+            return *this;
+        }
+
+        template<typename... Ts>
+        fv_storage<Ts...>::~fv_storage() noexcept {
+            destroy();
+        }
+
+    } // namespace details
+
+    // --- construction --------------------------------------------------------
+
+    template<typename... Ts>
+    basic_fast_variant<typelist<Ts...>>::basic_fast_variant()
+        noexcept(std::is_nothrow_default_constructible_v<alternative_t<0>>) {
+        this->template construct<0>();
+    }
+
+    template<typename... Ts>
+    template<typename T, typename>
+    basic_fast_variant<typelist<Ts...>>::basic_fast_variant(T&& value)
+        noexcept(std::is_nothrow_constructible_v<std::decay_t<T>, T&&>) {
+        this->template construct<index_of<std::decay_t<T>>>(std::forward<T>(value));
+    }
+
+    template<typename... Ts>
+    template<typename T, typename... Args>
+    basic_fast_variant<typelist<Ts...>>::basic_fast_variant(std::in_place_type_t<T>, Args&&... args) {
+        static_assert(index_of<T> < npos, "fast_variant: T is not one of the alternatives");
+        this->template construct<index_of<T>>(std::forward<Args>(args)...);
+    }
+
+    template<typename... Ts>
+    template<std::size_t I, typename... Args>
+    basic_fast_variant<typelist<Ts...>>::basic_fast_variant(std::in_place_index_t<I>, Args&&... args) {
+        static_assert(I < npos, "fast_variant: alternative index out of range");
+        this->template construct<I>(std::forward<Args>(args)...);
+    }
+
+    template<typename... Ts>
+    template<typename T, typename>
+    auto basic_fast_variant<typelist<Ts...>>::operator=(T&& value) -> basic_fast_variant& {
+        using U = std::decay_t<T>;
+        if (holds<U>()) {
+            *this->template ptr<U>() = std::forward<T>(value);
+        } else {
+            destroy();
+            this->template construct<index_of<U>>(std::forward<T>(value));
+        }
+        return *this;
+    }
+
+    // --- modifiers -----------------------------------------------------------
+
+    template<typename... Ts>
+    template<typename T, typename... Args>
+    T& basic_fast_variant<typelist<Ts...>>::emplace(Args&&... args) {
+        static_assert(index_of<T> < npos, "fast_variant::emplace: T is not one of the alternatives");
+        destroy();
+        return this->template construct<index_of<T>>(std::forward<Args>(args)...);
+    }
+
+    template<typename... Ts>
+    template<std::size_t I, typename... Args>
+    auto basic_fast_variant<typelist<Ts...>>::emplace(Args&&... args) -> alternative_t<I>& {
+        static_assert(I < npos, "fast_variant::emplace: alternative index out of range");
+        destroy();
+        return this->template construct<I>(std::forward<Args>(args)...);
+    }
+
+    // --- observers -----------------------------------------------------------
+
+    template<typename... Ts>
+    std::size_t basic_fast_variant<typelist<Ts...>>::index() const noexcept {
+        return _index;
+    }
+
+    template<typename... Ts>
+    bool basic_fast_variant<typelist<Ts...>>::valueless() const noexcept {
+        return _index == npos;
+    }
+
+    template<typename... Ts>
+    template<typename T>
+    bool basic_fast_variant<typelist<Ts...>>::holds() const noexcept {
+        static_assert(index_of<T> < npos, "fast_variant::holds: T is not one of the alternatives");
+        return _index == index_of<T>;
+    }
+
+    template<typename... Ts>
+    template<typename T>
+    T& basic_fast_variant<typelist<Ts...>>::get() & noexcept {
+        assert(holds<T>() && "fast_variant::get(): requested alternative is not active");
+        return *this->template ptr<T>();
+    }
+
+    template<typename... Ts>
+    template<typename T>
+    const T& basic_fast_variant<typelist<Ts...>>::get() const& noexcept {
+        assert(holds<T>() && "fast_variant::get(): requested alternative is not active");
+        return *this->template ptr<T>();
+    }
+
+    template<typename... Ts>
+    template<typename T>
+    T&& basic_fast_variant<typelist<Ts...>>::get() && noexcept {
+        assert(holds<T>() && "fast_variant::get(): requested alternative is not active");
+        return std::move(*this->template ptr<T>());
+    }
+
+    template<typename... Ts>
+    template<std::size_t I>
+    auto basic_fast_variant<typelist<Ts...>>::get() & noexcept -> alternative_t<I>& {
+        return get<alternative_t<I>>();
+    }
+
+    template<typename... Ts>
+    template<std::size_t I>
+    auto basic_fast_variant<typelist<Ts...>>::get() const& noexcept -> const alternative_t<I>& {
+        return get<alternative_t<I>>();
+    }
+
+    template<typename... Ts>
+    template<std::size_t I>
+    auto basic_fast_variant<typelist<Ts...>>::get() && noexcept -> alternative_t<I>&& {
+        return std::move(*this).template get<alternative_t<I>>();
+    }
+
+    template<typename... Ts>
+    template<typename T>
+    T* basic_fast_variant<typelist<Ts...>>::get_if() noexcept {
+        return holds<T>() ? this->template ptr<T>() : nullptr;
+    }
+
+    template<typename... Ts>
+    template<typename T>
+    const T* basic_fast_variant<typelist<Ts...>>::get_if() const noexcept {
+        return holds<T>() ? this->template ptr<T>() : nullptr;
+    }
+
+    // --- visitation ----------------------------------------------------------
+
+    template<typename... Ts>
+    template<typename F>
+    decltype(auto) basic_fast_variant<typelist<Ts...>>::visit(F&& f) & {
+        assert(not valueless() && "fast_variant::visit(): variant is valueless");
+        return details::fv_dispatch<Ts&...>::run(_index, std::forward<F>(f), static_cast<void*>(_storage));
+    }
+
+    template<typename... Ts>
+    template<typename F>
+    decltype(auto) basic_fast_variant<typelist<Ts...>>::visit(F&& f) const& {
+        assert(not valueless() && "fast_variant::visit(): variant is valueless");
+        return details::fv_dispatch<const Ts&...>::run(_index, std::forward<F>(f), static_cast<const void*>(_storage));
+    }
+
+    template<typename... Ts>
+    template<typename F>
+    decltype(auto) basic_fast_variant<typelist<Ts...>>::visit(F&& f) && {
+        assert(not valueless() && "fast_variant::visit(): variant is valueless");
+        return details::fv_dispatch<Ts&&...>::run(_index, std::forward<F>(f), static_cast<void*>(_storage));
+    }
+
+    template<typename F, typename... Ts>
+    decltype(auto) visit(F&& f, basic_fast_variant<typelist<Ts...>>& v) {
+        return v.visit(std::forward<F>(f));
+    }
+
+    template<typename F, typename... Ts>
+    decltype(auto) visit(F&& f, const basic_fast_variant<typelist<Ts...>>& v) {
+        return v.visit(std::forward<F>(f));
+    }
+
+    template<typename F, typename... Ts>
+    decltype(auto) visit(F&& f, basic_fast_variant<typelist<Ts...>>&& v) {
+        return std::move(v).visit(std::forward<F>(f));
+    }
+
+} // namespace etools::meta
+
+#endif // ETOOLS_META_FAST_VARIANT_TPP_
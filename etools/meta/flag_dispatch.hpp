@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file flag_dispatch.hpp
+*
+* @brief Compile-time flag -> handler table that dispatches only the set bits of a mask.
+*
+* @ingroup etools_meta etools::meta
+*
+* `flag_dispatch<Enum, flag_handler<Flag, Fn>...>` binds each single-bit
+* enumerator of an `enable_flags` enum to a function. The bindings are turned
+* into a `constexpr` bit-index -> function-pointer table, so dispatching a
+* mask costs one `ctz` and one indirect call per set, handled flag. Unset bits
+* are never inspected and set bits without a handler are masked off up front.
+*
+* ### Ordering
+* By default handlers run in ascending bit order. Giving any handler a
+* non-default `Priority` switches to priority order: larger priorities run
+* first, ties fall back to bit order. The permutation is computed at compile
+* time; at run time the set bits are first re-mapped into rank space (one
+* `ctz` + shift per flag) and then walked in rank order, so the cost stays
+* O(popcount).
+*
+* ### Example
+* @code
+* enum class ev : std::uint32_t { rx = 1u << 0, tx = 1u << 1, error = 1u << 5 };
+* template<> struct etools::meta::enable_flags<ev> : std::true_type {};
+*
+* void on_rx(conn&);  void on_tx(conn&);  void on_error(conn&);
+*
+* using namespace etools::meta;
+* using events = flag_dispatch<ev,
+*     flag_handler<ev::rx, &on_rx>,
+*     flag_handler<ev::tx, &on_tx>,
+*     flag_handler<ev::error, &on_error, 10>>;   // errors first
+*
+* events::dispatch(fired, c);   // calls only the handlers of the fired events
+* @endcode
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_FLAG_DISPATCH_HPP_
+#define ETOOLS_META_FLAG_DISPATCH_HPP_
+#include <array>       // For std::array
+#include <cstddef>     // For std::size_t
+#include <cstdint>     // For std::uint64_t
+#include <type_traits> // For std::is_pointer_v, std::is_function_v
+#include "flags.hpp"   // For enable_flags, popcount, flag_index
+#include "traits.hpp"  // For nth_t
+
+namespace etools::meta {
+
+    /**
+    * @struct flag_handler
+    *
+    * @brief Registration tag binding a single-bit flag to a function.
+    *
+    * @tparam Flag     A single-bit enumerator of an `enable_flags` enum.
+    * @tparam Fn       Function pointer (or function name) invoked for `Flag`.
+    * @tparam Priority Dispatch priority; larger runs first. Defaults to 0.
+    */
+    template<auto Flag, auto Fn, int Priority = 0>
+    struct flag_handler {
+        using flag_type = decltype(Flag);
+        using fn_type   = decltype(Fn);
+
+        static constexpr flag_type flag     = Flag;
+        static constexpr fn_type   fn       = Fn;
+        static constexpr int       priority = Priority;
+    };
+
+    /**
+    * @class flag_dispatch
+    *
+    * @brief Static dispatcher invoking the handler of every set flag in a mask.
+    *
+    * @tparam Enum     An `enum class` opted in via `enable_flags`.
+    * @tparam Handlers `flag_handler<Flag, Fn, Priority>` registrations. Flags must
+    *                  be single-bit enumerators of `Enum` and pairwise distinct;
+    *                  all `Fn` must share one function-pointer type.
+    *
+    * The class has no state; every member is static.
+    */
+    template<typename Enum, typename... Handlers>
+    class flag_dispatch {
+        static_assert(std::is_enum_v<Enum> && enable_flags_v<Enum>,
+            "flag_dispatch: Enum must be an enum opted in via etools::meta::enable_flags");
+        static_assert(sizeof...(Handlers) > 0, "flag_dispatch: at least one handler is required");
+        static_assert((std::is_same_v<typename Handlers::flag_type, Enum> && ...),
+            "flag_dispatch: every handler flag must be an enumerator of Enum");
+
+    public:
+        /// @brief Function-pointer type shared by all handlers.
+        using fn_type = typename nth_t<0, Handlers...>::fn_type;
+
+        static_assert(std::is_pointer_v<fn_type> && std::is_function_v<std::remove_pointer_t<fn_type>>,
+            "flag_dispatch: handlers must be functions or function pointers");
+        static_assert((std::is_same_v<typename Handlers::fn_type, fn_type> && ...),
+            "flag_dispatch: all handlers must have the same signature");
+
+        /// @brief Union of all handled flags.
+        static constexpr Enum mask = (Handlers::flag | ...);
+
+        /// @brief Number of registered handlers.
+        static constexpr std::size_t size = sizeof...(Handlers);
+
+        /// @brief `true` if any handler has a non-default priority.
+        static constexpr bool prioritized = ((Handlers::priority != 0) || ...);
+
+        /**
+        * @brief Invokes the handler of every set flag in `value`.
+        *
+        * Flags without a handler are ignored. `args` are passed to each handler
+        * as lvalues, so they must not be consumed (moved from) by a handler.
+        *
+        * @return Number of handlers invoked.
+        */
+        template<typename... Args>
+        static constexpr std::size_t dispatch(Enum value, Args&&... args);
+
+        /**
+        * @brief `true` if every flag set in `value` has a handler.
+        */
+        [[nodiscard]] static constexpr bool handles(Enum value) noexcept;
+
+        /**
+        * @brief The handled flags in the order `dispatch` visits them.
+        */
+        [[nodiscard]] static constexpr std::array<Enum, sizeof...(Handlers)> order() noexcept;
+
+    private:
+        using bits_type = std::make_unsigned_t<std::underlying_type_t<Enum>>;
+        static constexpr std::size_t width = sizeof(bits_type) * 8;
+
+        static_assert(((popcount(Handlers::flag) == 1) && ...),
+            "flag_dispatch: every handler flag must have exactly one bit set");
+        static_assert(popcount(mask) == sizeof...(Handlers),
+            "flag_dispatch: handler flags must be pairwise distinct");
+    };
+
+} // namespace etools::meta
+
+#include "flag_dispatch.tpp"
+#endif // ETOOLS_META_FLAG_DISPATCH_HPP_
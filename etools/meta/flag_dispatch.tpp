@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file flag_dispatch.tpp
+*
+* @brief Definition of flag_dispatch.hpp methods.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_FLAG_DISPATCH_TPP_
+#define ETOOLS_META_FLAG_DISPATCH_TPP_
+#include "flag_dispatch.hpp"
+
+namespace etools::meta::details {
+
+    /**
+    * @brief Dispatch rank of each handler: priority descending, then bit index
+    *        ascending. Without priorities this is plain bit order.
+    */
+    template<typename... Hs>
+    constexpr std::array<std::size_t, sizeof...(Hs)> fd_make_rank() noexcept {
+        constexpr std::size_t count = sizeof...(Hs);
+        constexpr std::size_t bits[] = { flag_index(Hs::flag)... };
+        constexpr int priorities[] = { Hs::priority... };
+        std::array<std::size_t, count> rank{};
+        for (std::size_t h = 0; h < count; ++h)
+            for (std::size_t o = 0; o < count; ++o)
+                rank[h] += priorities[o] > priorities[h] ||
+                           (priorities[o] == priorities[h] && bits[o] < bits[h]);
+        return rank;
+    }
+
+    /// @brief Bit index -> handler; entries of unhandled bits are null.
+    template<std::size_t Width, typename Fn, typename... Hs>
+    constexpr std::array<Fn, Width> fd_make_by_bit() noexcept {
+        std::array<Fn, Width> table{};
+        ((table[flag_index(Hs::flag)] = Hs::fn), ...);
+        return table;
+    }
+
+    /// @brief Bit index -> dispatch rank.
+    template<std::size_t Width, typename... Hs>
+    constexpr std::array<std::uint8_t, Width> fd_make_rank_of_bit() noexcept {
+        constexpr auto rank = fd_make_rank<Hs...>();
+        constexpr std::size_t bits[] = { flag_index(Hs::flag)... };
+        std::array<std::uint8_t, Width> table{};
+        for (std::size_t h = 0; h < sizeof...(Hs); ++h) table[bits[h]] = static_cast<std::uint8_t>(rank[h]);
+        return table;
+    }
+
+    /// @brief Dispatch rank -> handler.
+    template<typename Fn, typename... Hs>
+    constexpr std::array<Fn, sizeof...(Hs)> fd_make_by_rank() noexcept {
+        constexpr auto rank = fd_make_rank<Hs...>();
+        constexpr Fn fns[] = { Hs::fn... };
+        std::array<Fn, sizeof...(Hs)> table{};
+        for (std::size_t h = 0; h < sizeof...(Hs); ++h) table[rank[h]] = fns[h];
+        return table;
+    }
+
+    /**
+    * @brief Compile-time tables behind `flag_dispatch<Enum, Hs...>`.
+    *
+    * `by_bit` serves bit-order dispatch; `rank_of_bit` and `by_rank` serve
+    * priority-order dispatch.
+    */
+    template<typename Enum, typename... Hs>
+    struct fd_tables {
+        using fn_type = typename nth_t<0, Hs...>::fn_type;
+        static constexpr std::size_t width = sizeof(std::underlying_type_t<Enum>) * 8;
+
+        static constexpr std::array<std::size_t, sizeof...(Hs)> rank = fd_make_rank<Hs...>();
+        static constexpr std::array<fn_type, width> by_bit = fd_make_by_bit<width, fn_type, Hs...>();
+        static constexpr std::array<std::uint8_t, width> rank_of_bit = fd_make_rank_of_bit<width, Hs...>();
+        static constexpr std::array<fn_type, sizeof...(Hs)> by_rank = fd_make_by_rank<fn_type, Hs...>();
+    };
+
+} // namespace etools::meta::details
+
+namespace etools::meta {
+
+    template<typename Enum, typename... Handlers>
+    template<typename... Args>
+    constexpr std::size_t flag_dispatch<Enum, Handlers...>::dispatch(Enum value, Args&&... args) {
+        using tables = details::fd_tables<Enum, Handlers...>;
+        std::size_t n = 0;
+        bits_type bits = details::flag_bits(value & mask);
+
+        if constexpr (!prioritized) {
+            for (; bits; bits = details::flag_clear_lowest(bits), ++n)
+                tables::by_bit[details::flag_ctz(bits)](args...);
+        } else {
+            // At most 64 handlers (one per bit), so rank space fits one word.
+            std::uint64_t ranks = 0;
+            for (; bits; bits = details::flag_clear_lowest(bits))
+                ranks |= std::uint64_t{1} << tables::rank_of_bit[details::flag_ctz(bits)];
+            for (; ranks; ranks = details::flag_clear_lowest(ranks), ++n)
+                tables::by_rank[details::flag_ctz(ranks)](args...);
+        }
+        return n;
+    }
+
+    template<typename Enum, typename... Handlers>
+    constexpr bool flag_dispatch<Enum, Handlers...>::handles(Enum value) noexcept {
+        return (value & ~mask) == static_cast<Enum>(0);
+    }
+
+    template<typename Enum, typename... Handlers>
+    constexpr std::array<Enum, sizeof...(Handlers)> flag_dispatch<Enum, Handlers...>::order() noexcept {
+        using tables = details::fd_tables<Enum, Handlers...>;
+        std::array<Enum, sizeof...(Handlers)> out{};
+        constexpr Enum flags[] = { Handlers::flag... };
+        for (std::size_t h = 0; h < sizeof...(Handlers); ++h) out[tables::rank[h]] = flags[h];
+        return out;
+    }
+
+} // namespace etools::meta
+
+#endif // ETOOLS_META_FLAG_DISPATCH_TPP_
@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file flag_set.tpp
+*
+* @brief Definition of flag_set.hpp methods.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_FLAG_SET_TPP_
+#define ETOOLS_META_FLAG_SET_TPP_
+#include "flag_set.hpp"
+#include <cassert>
+
+namespace etools::meta {
+
+    // --- iterator --------------------------------------------------------------
+
+    template<typename Enum, std::size_t N>
+    constexpr flag_set<Enum, N>::iterator::iterator(const word_type* words, std::size_t word) noexcept
+        : _words(words), _word(word), _bits(words[word]) {
+        skip_empty();
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr void flag_set<Enum, N>::iterator::skip_empty() noexcept {
+        while (_bits == 0 && ++_word < word_count)
+            _bits = _words[_word];
+        if (_bits == 0) _word = word_count;
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr std::size_t flag_set<Enum, N>::iterator::index() const noexcept {
+        assert(_bits != 0 && "flag_set::iterator::index(): past-the-end iterator");
+        return _word * word_bits + details::flag_ctz(_bits);
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr typename flag_set<Enum, N>::iterator& flag_set<Enum, N>::iterator::operator++() noexcept {
+        _bits = details::flag_clear_lowest(_bits);
+        skip_empty();
+        return *this;
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr typename flag_set<Enum, N>::iterator flag_set<Enum, N>::iterator::operator++(int) noexcept {
+        iterator old = *this;
+        ++*this;
+        return old;
+    }
+
+    // --- flag_set --------------------------------------------------------------
+
+    template<typename Enum, std::size_t N>
+    constexpr std::size_t flag_set<Enum, N>::word_of(Enum flag) noexcept {
+        const auto i = static_cast<std::size_t>(flag);
+        assert(i < N && "flag_set: flag out of range");
+        return i / word_bits;
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr typename flag_set<Enum, N>::word_type flag_set<Enum, N>::bit_of(Enum flag) noexcept {
+        return word_type{1} << (static_cast<std::size_t>(flag) % word_bits);
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr flag_set<Enum, N>::flag_set(std::initializer_list<Enum> flags) noexcept {
+        for (Enum f : flags) set(f);
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr flag_set<Enum, N> flag_set<Enum, N>::full() noexcept {
+        flag_set s;
+        for (auto& w : s._words) w = ~word_type{0};
+        s._words[word_count - 1] = tail_mask;
+        return s;
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr bool flag_set<Enum, N>::test(Enum flag) const noexcept {
+        return (_words[word_of(flag)] & bit_of(flag)) != 0;
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr flag_set<Enum, N>& flag_set<Enum, N>::set(Enum flag) noexcept {
+        _words[word_of(flag)] |= bit_of(flag);
+        return *this;
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr flag_set<Enum, N>& flag_set<Enum, N>::reset(Enum flag) noexcept {
+        _words[word_of(flag)] &= ~bit_of(flag);
+        return *this;
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr flag_set<Enum, N>& flag_set<Enum, N>::flip(Enum flag) noexcept {
+        _words[word_of(flag)] ^= bit_of(flag);
+        return *this;
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr flag_set<Enum, N>& flag_set<Enum, N>::clear() noexcept {
+        for (auto& w : _words) w = 0;
+        return *this;
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr std::size_t flag_set<Enum, N>::count() const noexcept {
+        std::size_t n = 0;
+        for (auto w : _words) n += details::flag_popcount(w);
+        return n;
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr bool flag_set<Enum, N>::any() const noexcept {
+        word_type acc = 0;
+        for (auto w : _words) acc |= w;
+        return acc != 0;
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr bool flag_set<Enum, N>::all() const noexcept {
+        word_type acc = ~word_type{0};
+        for (std::size_t i = 0; i + 1 < word_count; ++i) acc &= _words[i];
+        return acc == ~word_type{0} && _words[word_count - 1] == tail_mask;
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr flag_set<Enum, N>& flag_set<Enum, N>::operator|=(const flag_set& rhs) noexcept {
+        for (std::size_t i = 0; i < word_count; ++i) _words[i] |= rhs._words[i];
+        return *this;
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr flag_set<Enum, N>& flag_set<Enum, N>::operator&=(const flag_set& rhs) noexcept {
+        for (std::size_t i = 0; i < word_count; ++i) _words[i] &= rhs._words[i];
+        return *this;
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr flag_set<Enum, N>& flag_set<Enum, N>::operator^=(const flag_set& rhs) noexcept {
+        for (std::size_t i = 0; i < word_count; ++i) _words[i] ^= rhs._words[i];
+        return *this;
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr flag_set<Enum, N> flag_set<Enum, N>::operator~() const noexcept {
+        flag_set s;
+        for (std::size_t i = 0; i < word_count; ++i) s._words[i] = ~_words[i];
+        s._words[word_count - 1] &= tail_mask;
+        return s;
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr bool flag_set<Enum, N>::operator==(const flag_set& rhs) const noexcept {
+        word_type diff = 0;
+        for (std::size_t i = 0; i < word_count; ++i) diff |= _words[i] ^ rhs._words[i];
+        return diff == 0;
+    }
+
+    template<typename Enum, std::size_t N>
+    template<typename Fn>
+    constexpr void flag_set<Enum, N>::for_each(Fn&& fn) const {
+        for (std::size_t i = 0; i < word_count; ++i)
+            for (word_type bits = _words[i]; bits; bits = details::flag_clear_lowest(bits))
+                fn(static_cast<Enum>(i * word_bits + details::flag_ctz(bits)));
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr flag_set<Enum, N> operator|(flag_set<Enum, N> lhs, const flag_set<Enum, N>& rhs) noexcept {
+        return lhs |= rhs;
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr flag_set<Enum, N> operator&(flag_set<Enum, N> lhs, const flag_set<Enum, N>& rhs) noexcept {
+        return lhs &= rhs;
+    }
+
+    template<typename Enum, std::size_t N>
+    constexpr flag_set<Enum, N> operator^(flag_set<Enum, N> lhs, const flag_set<Enum, N>& rhs) noexcept {
+        return lhs ^= rhs;
+    }
+
+} // namespace etools::meta
+
+#endif // ETOOLS_META_FLAG_SET_TPP_
@@ -60,6 +60,12 @@
 * - `extract_flags(value)`: compacted listing - the set bits are placed at the
 *   front of the returned array, and the count of set bits is returned
 *   alongside it.
+* - `popcount(value)`, `lowest_flag(value)`, `flag_index(flag)`: single-
+*   instruction queries (`popcnt`, `blsi`, `tzcnt` where available).
+* - `flag_range(value)` / `for_each_flag(value, fn)`: lazy iteration over the
+*   set bits only, driven by count-trailing-zeros and clear-lowest-bit. Cost
+*   is proportional to the number of set flags, not to the width of the
+*   underlying type, and nothing is materialised.
 *
 * ## Important Notes
 *
@@ -84,6 +90,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 
@@ -267,7 +274,9 @@ namespace etools::meta {
     *       function body; violations produce a diagnostic at instantiation.
     * @note `Size` may legitimately be smaller than the full underlying width
     *       when the caller knows that only the low `Size` bits are
-    *       meaningful - this trims the returned array and the loop.
+    *       meaningful - this trims the returned array.
+    * @note Only the set bits are visited; prefer `flag_range` when the
+    *       positional array itself is not needed.
     *
     * ## Example
     * @code
@@ -315,6 +324,8 @@ namespace etools::meta {
     *       function body; violations produce a diagnostic at instantiation.
     * @note Because the array is sized at compile time, no allocation occurs
     *       and the function is suitable for use in embedded code paths.
+    * @note Only the set bits are visited; prefer `flag_range` when the
+    *       compacted array itself is not needed.
     *
     * ## Example
     * @code
@@ -330,6 +341,140 @@ namespace etools::meta {
     constexpr std::pair<std::array<Enum, Size>, std::size_t>
     extract_flags(Enum value) noexcept;
 
+    /**
+    * @name Set-bit Queries and Iteration
+    * @brief O(popcount) helpers built on count-trailing-zeros / clear-lowest-bit.
+    *
+    * These never scan unset bit positions. On GCC/Clang they lower to
+    * `popcnt`/`tzcnt`/`blsr` (given a suitable `-march`); elsewhere a portable
+    * `constexpr` fallback is used.
+    */
+    ///@{
+
+    /**
+    * @brief Number of set bits in `value`.
+    *
+    * @tparam Enum An `enum class` type opted-in via `enable_flags`.
+    * @param[in] value The bitmask to inspect.
+    */
+    template <typename Enum>
+    constexpr std::enable_if_t<enable_flags<Enum>::value, std::size_t>
+    popcount(Enum value) noexcept;
+
+    /**
+    * @brief The lowest set flag of `value` (`value & -value`).
+    *
+    * @tparam Enum An `enum class` type opted-in via `enable_flags`.
+    * @param[in] value The bitmask to inspect.
+    * @return The single-bit `Enum` of the lowest set bit, or `Enum(0)` if
+    *         `value` is empty.
+    */
+    template <typename Enum>
+    constexpr std::enable_if_t<enable_flags<Enum>::value, Enum>
+    lowest_flag(Enum value) noexcept;
+
+    /**
+    * @brief Bit position of the lowest set bit of `value`.
+    *
+    * For a single-bit flag this is its index, i.e. `flag == Enum(1 << flag_index(flag))`.
+    *
+    * @tparam Enum An `enum class` type opted-in via `enable_flags`.
+    * @param[in] value A non-empty bitmask.
+    * @pre `value != Enum(0)` (checked by `assert`).
+    */
+    template <typename Enum>
+    constexpr std::enable_if_t<enable_flags<Enum>::value, std::size_t>
+    flag_index(Enum value) noexcept;
+
+    /**
+    * @class flag_range
+    *
+    * @brief Lazy, allocation-free range over the set flags of a bitmask.
+    *
+    * The range holds a copy of the mask. Each increment of its iterator clears
+    * the lowest set bit (`x &= x - 1`) and each dereference isolates it, so a
+    * full traversal costs exactly `popcount(value)` steps. Flags are produced in
+    * ascending bit order as single-bit `Enum` values; `iterator::index()`
+    * additionally exposes the bit position.
+    *
+    * Constructed through class template argument deduction:
+    * @code
+    * for (perms p : etools::meta::flag_range(mask)) { ... }
+    * @endcode
+    *
+    * @tparam Enum An `enum class` type opted-in via `enable_flags`.
+    */
+    template <typename Enum>
+    class flag_range {
+        static_assert(std::is_enum_v<Enum>,
+            "etools::meta::flag_range: Enum must be an enum type.");
+        static_assert(enable_flags<Enum>::value,
+            "etools::meta::flag_range: Enum must opt-in via etools::meta::enable_flags<Enum>.");
+
+    public:
+        /// @brief Unsigned working representation of `Enum`.
+        using bits_type = std::make_unsigned_t<std::underlying_type_t<Enum>>;
+
+        /// @brief Forward iterator yielding the set flags in ascending bit order.
+        class iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = Enum;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = void;
+            using reference         = Enum;
+
+            constexpr iterator() noexcept = default;
+            constexpr explicit iterator(bits_type bits) noexcept : _bits(bits) {}
+
+            /// @brief The current (lowest remaining) flag.
+            constexpr Enum operator*() const noexcept;
+            /// @brief Bit position of the current flag.
+            constexpr std::size_t index() const noexcept;
+
+            constexpr iterator& operator++() noexcept;
+            constexpr iterator operator++(int) noexcept;
+
+            constexpr bool operator==(const iterator& o) const noexcept { return _bits == o._bits; }
+            constexpr bool operator!=(const iterator& o) const noexcept { return _bits != o._bits; }
+
+        private:
+            bits_type _bits = 0;
+        };
+
+        constexpr flag_range() noexcept = default;
+        constexpr explicit flag_range(Enum value) noexcept
+            : _bits(static_cast<bits_type>(value)) {}
+
+        constexpr iterator begin() const noexcept { return iterator{_bits}; }
+        constexpr iterator end() const noexcept { return iterator{}; }
+
+        /// @brief Number of flags in the range (`popcount`).
+        constexpr std::size_t size() const noexcept;
+        constexpr bool empty() const noexcept { return _bits == 0; }
+
+    private:
+        bits_type _bits = 0;
+    };
+
+    /**
+    * @brief Invokes `fn(flag)` for each set flag of `value`, lowest bit first.
+    *
+    * If `fn` is also invocable as `fn(flag, index)` it receives the bit position
+    * as a second `std::size_t` argument. Equivalent to a range-for over
+    * `flag_range(value)`; provided for call sites that prefer a callback.
+    *
+    * @tparam Enum An `enum class` type opted-in via `enable_flags`.
+    * @tparam Fn   Callable as `fn(Enum)` or `fn(Enum, std::size_t)`.
+    * @param[in] value The bitmask to walk.
+    * @param[in] fn    The callback.
+    */
+    template <typename Enum, typename Fn>
+    constexpr std::enable_if_t<enable_flags<Enum>::value>
+    for_each_flag(Enum value, Fn&& fn);
+
+    ///@}
+
 } // namespace etools::meta
 
 #include "flags.tpp"
@@ -19,10 +19,57 @@
 #define ETOOLS_META_FLAGS_TPP_
 #include "flags.hpp"
 #include <array>
+#include <cassert>
 #include <cstddef>
 #include <type_traits>
 #include <utility>
 
+namespace etools::meta::details {
+
+    /// @brief Count of trailing zero bits of a non-zero unsigned value.
+    template <typename U>
+    constexpr std::size_t flag_ctz(U x) noexcept {
+    #if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_ctzll(static_cast<unsigned long long>(x)));
+    #else
+        std::size_t n = 0;
+        while (!(x & U{1})) { x = static_cast<U>(x >> 1); ++n; }
+        return n;
+    #endif
+    }
+
+    /// @brief Number of set bits of an unsigned value.
+    template <typename U>
+    constexpr std::size_t flag_popcount(U x) noexcept {
+    #if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_popcountll(static_cast<unsigned long long>(x)));
+    #else
+        std::size_t n = 0;
+        for (; x; x = static_cast<U>(x & (x - 1))) ++n;
+        return n;
+    #endif
+    }
+
+    /// @brief `x` with its lowest set bit cleared (`blsr`).
+    template <typename U>
+    constexpr U flag_clear_lowest(U x) noexcept {
+        return static_cast<U>(x & (x - 1));
+    }
+
+    /// @brief The lowest set bit of `x` in isolation (`blsi`); zero if `x == 0`.
+    template <typename U>
+    constexpr U flag_isolate_lowest(U x) noexcept {
+        return static_cast<U>(x & (~x + 1));
+    }
+
+    /// @brief Unsigned representation of a flag enum value.
+    template <typename Enum>
+    constexpr std::make_unsigned_t<std::underlying_type_t<Enum>> flag_bits(Enum value) noexcept {
+        return static_cast<std::make_unsigned_t<std::underlying_type_t<Enum>>>(value);
+    }
+
+} // namespace etools::meta::details
+
 namespace etools::meta {
 
     template <typename Enum>
@@ -93,12 +140,14 @@ namespace etools::meta {
             "operations by specializing etools::meta::enable_flags<Enum> "
             "as std::true_type."
         );
-        using underlying = std::underlying_type_t<Enum>;
+        using bits_type = std::make_unsigned_t<std::underlying_type_t<Enum>>;
+        constexpr std::size_t width = sizeof(bits_type) * 8ULL;
+        bits_type bits = details::flag_bits(value);
+        if constexpr (Size < width)
+            bits = static_cast<bits_type>(bits & ((bits_type{1} << Size) - 1u));
         std::array<Enum, Size> flags{};
-        for (std::size_t i = 0; i < Size; ++i) {
-            const auto bit = static_cast<Enum>(static_cast<underlying>(1) << i);
-            flags[i] = value & bit;
-        }
+        for (; bits; bits = details::flag_clear_lowest(bits))
+            flags[details::flag_ctz(bits)] = static_cast<Enum>(details::flag_isolate_lowest(bits));
         return flags;
     }
 
@@ -116,18 +165,80 @@ namespace etools::meta {
             "operations by specializing etools::meta::enable_flags<Enum> "
             "as std::true_type."
         );
-        using underlying = std::underlying_type_t<Enum>;
+        using bits_type = std::make_unsigned_t<std::underlying_type_t<Enum>>;
+        constexpr std::size_t width = sizeof(bits_type) * 8ULL;
+        bits_type bits = details::flag_bits(value);
+        if constexpr (Size < width)
+            bits = static_cast<bits_type>(bits & ((bits_type{1} << Size) - 1u));
         std::array<Enum, Size> flags{};
         std::size_t pos = 0;
-        for (std::size_t i = 0; i < Size; ++i) {
-            const auto bit = static_cast<Enum>(static_cast<underlying>(1) << i);
-            const auto masked = value & bit;
-            if (masked != static_cast<Enum>(0))
-                flags[pos++] = masked;
-        }
+        for (; bits; bits = details::flag_clear_lowest(bits))
+            flags[pos++] = static_cast<Enum>(details::flag_isolate_lowest(bits));
         return {flags, pos};
     }
 
+    template <typename Enum>
+    constexpr std::enable_if_t<enable_flags<Enum>::value, std::size_t>
+    popcount(Enum value) noexcept {
+        return details::flag_popcount(details::flag_bits(value));
+    }
+
+    template <typename Enum>
+    constexpr std::enable_if_t<enable_flags<Enum>::value, Enum>
+    lowest_flag(Enum value) noexcept {
+        return static_cast<Enum>(details::flag_isolate_lowest(details::flag_bits(value)));
+    }
+
+    template <typename Enum>
+    constexpr std::enable_if_t<enable_flags<Enum>::value, std::size_t>
+    flag_index(Enum value) noexcept {
+        assert(value != static_cast<Enum>(0) && "flag_index(): empty flag value");
+        return details::flag_ctz(details::flag_bits(value));
+    }
+
+    template <typename Enum>
+    constexpr Enum flag_range<Enum>::iterator::operator*() const noexcept {
+        return static_cast<Enum>(details::flag_isolate_lowest(_bits));
+    }
+
+    template <typename Enum>
+    constexpr std::size_t flag_range<Enum>::iterator::index() const noexcept {
+        assert(_bits != 0 && "flag_range::iterator::index(): past-the-end iterator");
+        return details::flag_ctz(_bits);
+    }
+
+    template <typename Enum>
+    constexpr typename flag_range<Enum>::iterator&
+    flag_range<Enum>::iterator::operator++() noexcept {
+        _bits = details::flag_clear_lowest(_bits);
+        return *this;
+    }
+
+    template <typename Enum>
+    constexpr typename flag_range<Enum>::iterator
+    flag_range<Enum>::iterator::operator++(int) noexcept {
+        iterator old = *this;
+        ++*this;
+        return old;
+    }
+
+    template <typename Enum>
+    constexpr std::size_t flag_range<Enum>::size() const noexcept {
+        return details::flag_popcount(_bits);
+    }
+
+    template <typename Enum, typename Fn>
+    constexpr std::enable_if_t<enable_flags<Enum>::value>
+    for_each_flag(Enum value, Fn&& fn) {
+        for (auto bits = details::flag_bits(value); bits; bits = details::flag_clear_lowest(bits)) {
+            const auto flag = static_cast<Enum>(details::flag_isolate_lowest(bits));
+            if constexpr (std::is_invocable_v<Fn&, Enum, std::size_t>)
+                fn(flag, details::flag_ctz(bits));
+            else
+                fn(flag);
+        }
+    }
+
 } // namespace etools::meta
 
 #endif // ETOOLS_META_FLAGS_TPP_
@@ -28,6 +28,7 @@
 #define ETOOLS_INFO_GEN_HPP_
 #include <type_traits>
 #include <cstddef>
+#include <utility>
 
 /**
 * @brief Generates a type trait to detect the presence of a specific member in a class.
@@ -369,6 +370,55 @@ namespace etools::meta {
 } // etools::meta
 
 
+/**
+* @brief Generates a type trait to detect whether a type exposes a callable named `<method>`
+*        that can be invoked on an lvalue of that type with a given argument list.
+*
+* This macro defines a template struct `has_callable_with_<method><T, Args...>` that evaluates
+* to `true` if the expression `std::declval<T&>().<method>(std::declval<Args>()...)` is
+* well-formed, and `false` otherwise. It also defines a helper variable template
+* `has_callable_with_<method>_v<T, Args...>`.
+*
+* This is the argument-aware form of `generate_has_callable`: it is overload-safe, and with
+* an empty `Args...` it answers the same question.
+*
+* @param method The name of the callable member to detect.
+*
+* @note `Args` are used as `std::declval<Args>()`, so pass `int&` / `const int&` / `int&&`
+* (or `int`, an rvalue) to select the value category each argument is called with.
+*
+* @example
+* generate_has_callable_with(reset)
+*
+* struct A { void reset(int, float); };
+* struct B { void reset(); };
+*
+* static_assert( etools::meta::has_callable_with_reset_v<A, int, float>);
+* static_assert(!etools::meta::has_callable_with_reset_v<A>);
+* static_assert( etools::meta::has_callable_with_reset_v<B>);
+* static_assert(!etools::meta::has_callable_with_reset_v<B, int>);
+*/
+#define generate_has_callable_with(method)                                             \
+namespace etools::meta {                                                               \
+    template <typename Void, typename T, typename... Args>                             \
+    struct has_callable_with_##method##_impl : std::false_type {};                     \
+                                                                                       \
+    template <typename T, typename... Args>                                            \
+    struct has_callable_with_##method##_impl<                                          \
+        std::void_t<decltype(std::declval<T&>().method(std::declval<Args>()...))>,     \
+        T, Args...                                                                     \
+    > : std::true_type {};                                                             \
+                                                                                       \
+    template <typename T, typename... Args>                                            \
+    struct has_callable_with_##method                                                  \
+        : has_callable_with_##method##_impl<void, T, Args...> {};                      \
+                                                                                       \
+    template <typename T, typename... Args>                                            \
+    inline constexpr bool has_callable_with_##method##_v =                             \
+        has_callable_with_##method<T, Args...>::value;                                 \
+} // etools::meta
+
+
 /**
 * @brief Generates a type trait to detect the presence of a public static member function.
 *
@@ -24,13 +24,24 @@
 */
 #ifndef ETOOLS_META_HPP_
 #define ETOOLS_META_HPP_
+#include "algorithm.hpp"
+#include "fast_variant.hpp"
+#include "flag_dispatch.hpp"
+#include "flag_set.hpp"
 #include "flags.hpp"
+#include "capabilities.hpp"
+#include "enum_reflect.hpp"
 #include "info_gen.hpp"
 #include "overload.hpp"
 #include "traits.hpp"
+#include "type_id.hpp"
+#include "type_map.hpp"
 #include "typelist.hpp"
 #include "typeset.hpp"
 #include "sort.hpp"
+#include "sorted_value_table.hpp"
 #include "unique_variant.hpp"
 #include "utility.hpp"
+#include "visit_batched.hpp"
+#include "with_index.hpp"
 #endif //ETOOLS_META_HPP_
\ No newline at end of file
@@ -56,16 +56,23 @@
 *
 * ## Algorithm
 *
-* Top-down merge sort.  The list is split sequentially at the midpoint
-* (`tl_take<N/2>` left, `tl_drop<N/2>` right), each half is sorted recursively,
-* and the two sorted halves are merged.  The sequential split ensures that every
-* element in the left half has an earlier original position than every element in
-* the right half; taking the left element first when two elements are equivalent
-* therefore always picks the element that appeared earlier in the input.
+* Top-down merge sort over element *positions*. A run is an
+* `std::index_sequence` of original positions; `[Lo, Lo + Len)` is split at the
+* midpoint by arithmetic alone, so splitting copies no types and recursion
+* depth is O(log N). Two sorted runs are merged along the merge path: the
+* output is cut into blocks of 64, the rank at which each block starts in the
+* left run is found by binary search, and each block is merged by a short
+* sequential walk. The merged run is assembled in a `constexpr` array. Types are
+* looked up by position (`pack_at_t`) once each.
 *
-* - Instantiation count: O(N log N) - a genuine improvement over insertion sort.
-* - Maximum recursion depth: O(log N) - important for compilers with template depth limits.
-* - Stability: preserved (see above).
+* - Instantiations: O(N log N) comparator evaluations and walk steps.
+* - Maximum recursion depth: O(log N) for the split plus 64 for a walk.
+* - Stability: the left run precedes the right run in the input, and ties
+*   between them take the left element, so equivalent types keep their order.
+*
+* Without `__type_pack_element` (GCC before 14) `pack_at_t` falls back to an
+* O(N) lookup, which then dominates for packs of more than a few hundred
+* types.
 *
 * @author Mark Tikhonov <mtik.philosopher@gmail.com>
 *
@@ -78,153 +85,165 @@
 */
 #ifndef ETOOLS_META_SORT_HPP_
 #define ETOOLS_META_SORT_HPP_
-#include <type_traits>
+#include <array>       // For std::array
+#include <cstddef>     // For std::size_t
+#include <cstdint>     // For std::uint64_t
+#include <type_traits> // For std::bool_constant, std::conditional_t
+#include <utility>     // For std::index_sequence
+#include "traits.hpp"  // For pack_at_t
 #include "typelist.hpp"
 
 namespace etools::meta {
 
     namespace details {
 
-        // -----------------------------------------------------------------
-        // tl_prepend: typelist<T, Ts...> from T and typelist<Ts...>
-        // -----------------------------------------------------------------
-
-        /**
-        * @brief Prepends a single type `T` to a `typelist`.
-        *
-        * @tparam T    Type to prepend.
-        * @tparam List A `typelist<...>` to prepend to.
-        */
-        template<typename T, typename List>
-        struct tl_prepend;
+        // Every helper below takes the pack through a single handle type
+        // (`rank_sort_pack<Ts...>`) or a run of indices, never the pack itself:
+        // the cost of creating or looking up a template specialization grows
+        // with its argument count - including the arguments of an enclosing
+        // class template - so a helper instantiated O(N log N) times must not
+        // carry N type arguments.
 
-        template<typename T, typename... Ts>
-        struct tl_prepend<T, typelist<Ts...>> { using type = typelist<T, Ts...>; };
+        /// @brief Handle for the pack being sorted.
+        template<typename... Ts>
+        struct rank_sort_pack {};
 
+        /// @brief Element at position `I` of the pack behind `Pack`; looked up once per `I`.
+        template<typename Pack, std::size_t I>
+        struct rank_sort_at;
 
-        // -----------------------------------------------------------------
-        // tl_take / tl_drop: sequential split at position N
-        // -----------------------------------------------------------------
+        template<std::size_t I, typename... Ts>
+        struct rank_sort_at<rank_sort_pack<Ts...>, I> { using type = pack_at_t<I, Ts...>; };
 
-        /**
-        * @brief Collects the first `N` types of a `typelist` into a new `typelist`.
-        *
-        * A 4th `void`-tagged SFINAE parameter keeps the recursive specialization from
-        * matching when `N == 0`, resolving what would otherwise be an ambiguous
-        * partial specialisation.
-        *
-        * @tparam N    Number of types to take (0 yields the accumulator as-is).
-        * @tparam List The source `typelist`.
-        * @tparam Acc  Accumulator (starts empty; do not supply explicitly).
-        */
-        template<std::size_t N, typename List, typename Acc = typelist<>, typename = void>
-        struct tl_take_impl { using type = Acc; };
+        /// @brief `true` if the element at position `I` strictly precedes the one at `J`.
+        template<template<typename, typename> class Cmp, typename Pack, std::size_t I, std::size_t J>
+        using rank_sort_before = Cmp<typename rank_sort_at<Pack, I>::type, typename rank_sort_at<Pack, J>::type>;
 
-        template<std::size_t N, typename H, typename... Ts, typename... As>
-        struct tl_take_impl<N, typelist<H, Ts...>, typelist<As...>,
-                            std::enable_if_t<(N > 0)>>
-            : tl_take_impl<N - 1, typelist<Ts...>, typelist<As..., H>> {};
+        /// @brief Output positions produced by one sequential merge walk; bounds recursion depth.
+        inline constexpr std::size_t rank_sort_block = 64;
 
         /**
-        * @brief Drops the first `N` types of a `typelist`, returning the remainder.
-        *
-        * Same SFINAE guard as `tl_take_impl`: the recursive case is disabled when
-        * `N == 0`, so the primary (which returns `List` unchanged) is the unambiguous
-        * winner at the base case.
+        * @brief Merges two sorted runs of positions (`M::left`, `M::right`).
         *
-        * @tparam N    Number of types to drop (0 returns the list unchanged).
-        * @tparam List The source `typelist`.
+        * Merge-path merge: the output is cut into blocks of `rank_sort_block`
+        * positions, the start of each block in both runs (its co-rank) is found
+        * by a binary search along the block's diagonal, and each block is then
+        * merged by an ordinary sequential walk recorded as a bitmask of
+        * left/right choices. Comparator evaluations are O(m) per merge plus
+        * O(log m) per block, and recursion depth is bounded by the block size
+        * instead of the run length. Ties take the left element, so the merge is
+        * stable.
         */
-        template<std::size_t N, typename List, typename = void>
-        struct tl_drop_impl { using type = List; };
+        template<template<typename, typename> class Cmp, typename Pack, typename Left, typename Right>
+        struct rank_sort_merge;
 
-        template<std::size_t N, typename H, typename... Ts>
-        struct tl_drop_impl<N, typelist<H, Ts...>, std::enable_if_t<(N > 0)>>
-            : tl_drop_impl<N - 1, typelist<Ts...>> {};
+        /// @brief Walk state: 0 done, 1 left run exhausted, 2 right run exhausted, 3 compare.
+        template<typename M, std::size_t I, std::size_t J, std::size_t Steps>
+        inline constexpr int rank_sort_walk_state = Steps == 0 ? 0 : I == M::nl ? 1 : J == M::nr ? 2 : 3;
 
+        /// @brief Choices of a `Steps`-long walk from `(I, J)`: bit `t` set if step `t` takes the left run.
+        template<typename M, std::size_t I, std::size_t J, std::size_t Steps,
+                 int State = rank_sort_walk_state<M, I, J, Steps>>
+        struct rank_sort_walk { static constexpr std::uint64_t mask = 0; };  // done, or only the right run remains
 
-        // -----------------------------------------------------------------
-        // merge_impl: merge two Cmp-sorted typelists into one
-        // -----------------------------------------------------------------
+        template<typename M, std::size_t I, std::size_t J, std::size_t Steps>
+        struct rank_sort_walk<M, I, J, Steps, 2> {
+            static constexpr std::uint64_t mask = Steps >= 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << Steps) - 1;
+        };
 
-        /**
-        * @brief Merges two `Cmp`-sorted typelists into a single sorted typelist.
-        *
-        * At each step, the head with higher priority per `Cmp` is prepended to the
-        * merged tail.  When `Cmp<L, R>::value` is false and `Cmp<R, L>::value` is
-        * also false (equivalent elements), `L` is taken first.  Because the
-        * sequential split guarantees every element in L had an earlier original
-        * position than every element in R, this rule preserves stability.
-        *
-        * @tparam Cmp   Binary comparator.
-        * @tparam Left  A `Cmp`-sorted `typelist`.
-        * @tparam Right A `Cmp`-sorted `typelist`.
-        */
-        template<template<typename, typename> class Cmp, typename Left, typename Right>
-        struct merge_impl;
+        template<typename M, std::size_t I, std::size_t J, std::size_t Steps>
+        struct rank_sort_walk<M, I, J, Steps, 3> {
+        private:
+            // Ties take the left element.
+            static constexpr bool left = !rank_sort_before<M::template cmp, typename M::pack, M::right[J], M::left[I]>::value;
+        public:
+            static constexpr std::uint64_t mask =
+                std::uint64_t{left} | (rank_sort_walk<M, I + left, J + !left, Steps - 1>::mask << 1);
+        };
 
-        /// @brief Base case: left is empty, result is right (possibly also empty).
-        template<template<typename, typename> class Cmp, typename... Rs>
-        struct merge_impl<Cmp, typelist<>, typelist<Rs...>> {
-            using type = typelist<Rs...>;
+        /// @brief Number of left-run elements among the first `K` outputs, searched in `[Lo, Hi)`.
+        template<typename M, std::size_t K, std::size_t Lo, std::size_t Hi, bool = (Lo >= Hi)>
+        struct rank_sort_corank : std::integral_constant<std::size_t, Lo> {};
+
+        template<typename M, std::size_t K, std::size_t Lo, std::size_t Hi>
+        struct rank_sort_corank<M, K, Lo, Hi, false> : std::conditional_t<
+            // left[mid] still belongs before output K if it does not follow right[K - mid - 1].
+            !rank_sort_before<M::template cmp, typename M::pack,
+                              M::right[K - (Lo + Hi) / 2 - 1], M::left[(Lo + Hi) / 2]>::value,
+            rank_sort_corank<M, K, (Lo + Hi) / 2 + 1, Hi>,
+            rank_sort_corank<M, K, Lo, (Lo + Hi) / 2>> {};
+
+        /// @brief Start (in the left run) and walk of output block `B`.
+        template<typename M, std::size_t B>
+        struct rank_sort_block_walk {
+            static constexpr std::size_t k = B * rank_sort_block;
+            static constexpr std::size_t steps = (M::nl + M::nr - k < rank_sort_block) ? M::nl + M::nr - k : rank_sort_block;
+            static constexpr std::size_t i = rank_sort_corank<M, k, (k > M::nr ? k - M::nr : 0), (k < M::nl ? k : M::nl)>::value;
+            static constexpr std::uint64_t mask = rank_sort_walk<M, i, k - i, steps>::mask;
         };
 
-        /// @brief Base case: right is empty (and left is non-empty).
-        template<template<typename, typename> class Cmp, typename L, typename... Ls>
-        struct merge_impl<Cmp, typelist<L, Ls...>, typelist<>> {
-            using type = typelist<L, Ls...>;
+        template<template<typename, typename> class Cmp, typename Pack, std::size_t... L, std::size_t... R>
+        struct rank_sort_merge<Cmp, Pack, std::index_sequence<L...>, std::index_sequence<R...>> {
+            template<typename T, typename U>
+            using cmp = Cmp<T, U>;
+            using pack = Pack;
+            static constexpr std::size_t nl = sizeof...(L);
+            static constexpr std::size_t nr = sizeof...(R);
+            static constexpr std::size_t left[]  = { L..., 0 };
+            static constexpr std::size_t right[] = { R..., 0 };
+
+        private:
+            static constexpr std::size_t blocks = (nl + nr + rank_sort_block - 1) / rank_sort_block;
+
+            template<std::size_t... B>
+            static constexpr std::array<std::size_t, nl + nr> place(std::index_sequence<B...>) noexcept {
+                std::array<std::size_t, nl + nr> out{};
+                const std::size_t starts[] = { rank_sort_block_walk<rank_sort_merge, B>::i..., 0 };
+                const std::uint64_t masks[] = { rank_sort_block_walk<rank_sort_merge, B>::mask..., 0 };
+                for (std::size_t b = 0; b < blocks; ++b) {
+                    std::size_t i = starts[b], j = b * rank_sort_block - starts[b];
+                    for (std::size_t k = b * rank_sort_block, t = 0; k < nl + nr && t < rank_sort_block; ++k, ++t)
+                        out[k] = (masks[b] >> t) & 1u ? left[i++] : right[j++];
+                }
+                return out;
+            }
+
+        public:
+            static constexpr std::array<std::size_t, nl + nr> merged = place(std::make_index_sequence<blocks>{});
+
+            template<std::size_t... K>
+            static std::index_sequence<merged[K]...> as_sequence(std::index_sequence<K...>);
+
+            using type = decltype(as_sequence(std::make_index_sequence<nl + nr>{}));
         };
 
-        /// @brief Recursive case: compare heads and prepend the winner.
-        template<template<typename, typename> class Cmp,
-                 typename L, typename... Ls,
-                 typename R, typename... Rs>
-        struct merge_impl<Cmp, typelist<L, Ls...>, typelist<R, Rs...>> {
-            using type = std::conditional_t<
-                Cmp<R, L>::value,   // R strictly before L -> take R
-                typename tl_prepend<R, typename merge_impl<Cmp, typelist<L, Ls...>, typelist<Rs...>>::type>::type,
-                typename tl_prepend<L, typename merge_impl<Cmp, typelist<Ls...>, typelist<R, Rs...>>::type>::type
-            >;
+        /// @brief Sorted positions of the run `[Lo, Lo + Len)`; split at the midpoint, depth O(log N).
+        template<template<typename, typename> class Cmp, typename Pack, std::size_t Lo, std::size_t Len, typename = void>
+        struct rank_sort_run {
+            using type = typename rank_sort_merge<Cmp, Pack,
+                typename rank_sort_run<Cmp, Pack, Lo, Len / 2>::type,
+                typename rank_sort_run<Cmp, Pack, Lo + Len / 2, Len - Len / 2>::type>::type;
         };
 
+        template<template<typename, typename> class Cmp, typename Pack, std::size_t Lo, std::size_t Len>
+        struct rank_sort_run<Cmp, Pack, Lo, Len, std::enable_if_t<(Len < 2)>> {
+            using type = std::conditional_t<Len == 0, std::index_sequence<>, std::index_sequence<Lo>>;
+        };
 
-        // -----------------------------------------------------------------
-        // sort_impl: top-down merge sort on a typelist
-        // -----------------------------------------------------------------
+        template<typename Pack, std::size_t... Is>
+        typelist<typename rank_sort_at<Pack, Is>::type...> rank_sort_gather(std::index_sequence<Is...>);
 
-        /**
-        * @brief Top-down merge sort on a `typelist`.
-        *
-        * Base cases (empty or singleton) return the list unchanged.
-        * Otherwise, split sequentially at the midpoint, sort each half
-        * recursively, then merge.
-        *
-        * @tparam Cmp  Binary comparator.
-        * @tparam List The `typelist` to sort.
-        */
+        /// @brief Unwraps a `typelist` argument so both `sort` forms share one instantiation.
         template<template<typename, typename> class Cmp, typename List>
         struct sort_impl;
 
-        /// @brief Base case: empty list.
-        template<template<typename, typename> class Cmp>
-        struct sort_impl<Cmp, typelist<>> { using type = typelist<>; };
-
-        /// @brief Base case: singleton list.
-        template<template<typename, typename> class Cmp, typename T>
-        struct sort_impl<Cmp, typelist<T>> { using type = typelist<T>; };
-
-        /// @brief Recursive case: sequential split at midpoint, sort, merge.
-        template<template<typename, typename> class Cmp, typename T1, typename T2, typename... Ts>
-        struct sort_impl<Cmp, typelist<T1, T2, Ts...>> {
+        template<template<typename, typename> class Cmp, typename... Ts>
+        struct sort_impl<Cmp, typelist<Ts...>> {
         private:
-            static constexpr std::size_t half = (2 + sizeof...(Ts)) / 2;
-            using list          = typelist<T1, T2, Ts...>;
-            using left_list     = typename tl_take_impl<half, list>::type;
-            using right_list    = typename tl_drop_impl<half, list>::type;
-            using sorted_left   = typename sort_impl<Cmp, left_list>::type;
-            using sorted_right  = typename sort_impl<Cmp, right_list>::type;
+            using pack = rank_sort_pack<Ts...>;
         public:
-            using type = typename merge_impl<Cmp, sorted_left, sorted_right>::type;
+            using type = decltype(rank_sort_gather<pack>(
+                typename rank_sort_run<Cmp, pack, 0, sizeof...(Ts)>::type{}));
         };
 
     } // namespace details
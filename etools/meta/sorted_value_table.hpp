@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file sorted_value_table.hpp
+*
+* @brief Compile-time sorted key table over a type pack, for branch-free range queries at run time.
+*
+* @ingroup etools_meta etools::meta
+*
+* `sorted_value_table<Extractor, Ts...>` extracts an integral (or enum) key
+* `Extractor<T>::value` from every type, sorts the keys at compile time and
+* keeps the permutation back to the pack. Questions such as "the registered
+* type with the smallest key >= x" then become one branch-free binary search
+* over a `constexpr` array (`lower_bound_index`) instead of a linear scan
+* across the types.
+*
+* The sort is stable: types with equal keys keep their order in `Ts...`, so
+* `sorted_types` is the same list `sort_t` produces for the equivalent
+* comparator - but the work is done on values, with `meta::sort_array`,
+* rather than by instantiating a comparator per pair of types.
+*
+* ### Example
+* @code
+* #include "etools/meta/sorted_value_table.hpp"
+* using namespace etools::meta;
+*
+* template<typename T> struct capacity_of { static constexpr std::size_t value = T::capacity; };
+*
+* // Pools registered in any order; pick the smallest one that fits a request.
+* using pools = sorted_value_table<capacity_of, pool_256, pool_64, pool_1k>;
+*
+* static_assert(pools::keys[0] == 64);
+* std::size_t i = pools::find_at_least(n);   // index into the pack, or pools::npos
+* std::size_t r = pools::lower_bound(n);     // rank, or pools::npos
+* if (r != pools::npos)
+*     pools::visit(r, [&](auto tag) { return decltype(tag)::type::allocate(n); });
+* @endcode
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_SORTED_VALUE_TABLE_HPP_
+#define ETOOLS_META_SORTED_VALUE_TABLE_HPP_
+#include <array>         // For std::array
+#include <cstddef>       // For std::size_t
+#include <type_traits>   // For std::is_integral_v, std::is_enum_v
+#include <utility>       // For std::index_sequence
+#include "algorithm.hpp" // For sort_array, lower_bound_index
+#include "traits.hpp"    // For member_t, index_of_v, smallest_uint_t, type_identity
+#include "typelist.hpp"  // For typelist
+
+namespace etools::meta {
+
+    namespace details {
+        template<template<typename> class Extractor, typename... Ts>
+        struct svt_tables;
+
+        template<template<typename> class Extractor, typename List, typename Ranks>
+        struct svt_sorted;
+    } // namespace details
+
+    /**
+    * @class sorted_value_table
+    *
+    * @brief Keys of `Ts...` sorted ascending at compile time, with the permutation to the pack.
+    *
+    * @tparam Extractor `template<class T> struct Extractor { static constexpr auto value; };`
+    *                   All keys must have the same integral or enum type.
+    * @tparam Ts        The types; a single `typelist<Ts...>` is also accepted.
+    *
+    * Terminology: the *index* of a type is its position in `Ts...`; its *rank*
+    * is its position in key order. Every member is static.
+    */
+    template<template<typename> class Extractor, typename... Ts>
+    class sorted_value_table {
+        static_assert(sizeof...(Ts) > 0, "sorted_value_table: at least one type is required");
+
+        using tables = details::svt_tables<Extractor, Ts...>;
+
+    public:
+        /// @brief Key type, `std::remove_cv_t<decltype(Extractor<T>::value)>`.
+        using value_type = member_t<Extractor, Ts...>;
+
+        static_assert(std::is_integral_v<value_type> || std::is_enum_v<value_type>,
+            "sorted_value_table: Extractor<T>::value must be integral or an enum");
+
+        /// @brief Smallest unsigned type that holds every index and rank.
+        using index_type = smallest_uint_t<sizeof...(Ts)>;
+
+        /// @brief Number of types.
+        static constexpr std::size_t size = sizeof...(Ts);
+
+        /// @brief Returned by queries with no matching type.
+        static constexpr std::size_t npos = sizeof...(Ts);
+
+        /// @brief The keys in ascending order; `keys[r]` belongs to the type of rank `r`.
+        static constexpr std::array<value_type, sizeof...(Ts)> keys = tables::keys;
+
+        /// @brief Rank -> index: `order[r]` is the position in `Ts...` of the type of rank `r`.
+        static constexpr std::array<index_type, sizeof...(Ts)> order = tables::order;
+
+        /// @brief Index -> rank; the inverse of `order`.
+        static constexpr std::array<index_type, sizeof...(Ts)> rank = tables::rank;
+
+        /// @brief `Ts...` in key order; equal keys keep their registration order.
+        using sorted_types = typename details::svt_sorted<Extractor, typelist<Ts...>,
+                                                          std::index_sequence_for<Ts...>>::type;
+
+        /**
+        * @brief Rank of the first key not less than `x`, or `npos`.
+        *
+        * Branch-free: `ceil(log2(size)) + 1` comparisons regardless of `x`.
+        */
+        [[nodiscard]] static constexpr std::size_t lower_bound(value_type x) noexcept;
+
+        /**
+        * @brief Rank of the first key greater than `x`, or `npos`.
+        */
+        [[nodiscard]] static constexpr std::size_t upper_bound(value_type x) noexcept;
+
+        /**
+        * @brief Index (in `Ts...`) of the type with the smallest key `>= x`, or `npos`.
+        *
+        * Among types with equal keys, the one registered first is returned.
+        */
+        [[nodiscard]] static constexpr std::size_t find_at_least(value_type x) noexcept;
+
+        /**
+        * @brief Rank of `T` in key order.
+        *
+        * If `T` occurs more than once in `Ts...`, its first occurrence counts.
+        */
+        template<typename T>
+        [[nodiscard]] static constexpr std::size_t rank_of() noexcept;
+
+        /**
+        * @brief Invokes `f(type_identity<T>{})` for the type `T` of rank `r`.
+        *
+        * Dispatches through a `constexpr` function-pointer table. Every
+        * instantiation of `f` must return the same type.
+        *
+        * @pre `r < size`.
+        */
+        template<typename F>
+        static constexpr decltype(auto) visit(std::size_t r, F&& f);
+    };
+
+    /**
+    * @brief `sorted_value_table` over the types of a `typelist`.
+    */
+    template<template<typename> class Extractor, typename... Ts>
+    class sorted_value_table<Extractor, typelist<Ts...>> : public sorted_value_table<Extractor, Ts...> {};
+
+} // namespace etools::meta
+
+#include "sorted_value_table.tpp"
+#endif // ETOOLS_META_SORTED_VALUE_TABLE_HPP_
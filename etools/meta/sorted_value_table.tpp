@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file sorted_value_table.tpp
+*
+* @brief Definition of sorted_value_table.hpp methods.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_SORTED_VALUE_TABLE_TPP_
+#define ETOOLS_META_SORTED_VALUE_TABLE_TPP_
+#include "sorted_value_table.hpp"
+#include <cassert>
+
+namespace etools::meta::details {
+
+    template<typename V, typename I, std::size_t N>
+    struct svt_built {
+        std::array<V, N> keys{};
+        std::array<I, N> order{};
+        std::array<I, N> rank{};
+    };
+
+    /**
+    * @brief Sorts the indices of `Ts...` by `(key, index)` and derives both permutations.
+    *
+    * The index tie-break makes the unstable `sort_array` produce a stable order.
+    */
+    template<template<typename> class Extractor, typename... Ts>
+    constexpr auto svt_build() noexcept {
+        using V = member_t<Extractor, Ts...>;
+        using I = smallest_uint_t<sizeof...(Ts)>;
+        constexpr std::size_t N = sizeof...(Ts);
+
+        const std::array<V, N> raw{ Extractor<Ts>::value... };
+        svt_built<V, I, N> b{};
+        for (std::size_t i = 0; i < N; ++i) b.order[i] = static_cast<I>(i);
+        sort_array(b.order, [&raw](I l, I r) {
+            return raw[l] < raw[r] || (!(raw[r] < raw[l]) && l < r);
+        });
+        for (std::size_t r = 0; r < N; ++r) {
+            b.keys[r] = raw[b.order[r]];
+            b.rank[b.order[r]] = static_cast<I>(r);
+        }
+        return b;
+    }
+
+    /**
+    * @brief Tables of `sorted_value_table<Extractor, Ts...>`, built once per instantiation.
+    */
+    template<template<typename> class Extractor, typename... Ts>
+    struct svt_tables {
+        static constexpr auto value = svt_build<Extractor, Ts...>();
+        static constexpr auto keys  = value.keys;
+        static constexpr auto order = value.order;
+        static constexpr auto rank  = value.rank;
+    };
+
+    template<template<typename> class Extractor, typename... Ts, std::size_t... Rs>
+    struct svt_sorted<Extractor, typelist<Ts...>, std::index_sequence<Rs...>> {
+        using type = typelist<pack_at_t<svt_tables<Extractor, Ts...>::order[Rs], Ts...>...>;
+    };
+
+    template<typename R, typename T, typename F>
+    constexpr R svt_thunk(F& f) {
+        return f(type_identity<T>{});
+    }
+
+    template<typename R, typename F, typename... Us>
+    inline constexpr R (*svt_table[])(F&) = { &svt_thunk<R, Us, F>... };
+
+    /**
+    * @brief Runtime rank -> type dispatch over the sorted list.
+    */
+    template<typename F, typename U0, typename... Us>
+    constexpr decltype(auto) svt_visit(std::size_t r, F& f, typelist<U0, Us...>) {
+        using R = decltype(f(type_identity<U0>{}));
+        static_assert((std::is_same_v<R, decltype(f(type_identity<Us>{}))> and ...),
+            "sorted_value_table::visit: the visitor must return the same type for every type");
+        assert(r < 1 + sizeof...(Us) && "sorted_value_table::visit(): rank out of range");
+        return svt_table<R, F, U0, Us...>[r](f);
+    }
+
+} // namespace etools::meta::details
+
+namespace etools::meta {
+
+    template<template<typename> class Extractor, typename... Ts>
+    constexpr std::size_t sorted_value_table<Extractor, Ts...>::lower_bound(value_type x) noexcept {
+        return lower_bound_index(keys, x);
+    }
+
+    template<template<typename> class Extractor, typename... Ts>
+    constexpr std::size_t sorted_value_table<Extractor, Ts...>::upper_bound(value_type x) noexcept {
+        return lower_bound_index(keys, x, size, [](value_type k, value_type v) { return !(v < k); });
+    }
+
+    template<template<typename> class Extractor, typename... Ts>
+    constexpr std::size_t sorted_value_table<Extractor, Ts...>::find_at_least(value_type x) noexcept {
+        const std::size_t r = lower_bound(x);
+        return r < size ? order[r] : npos;
+    }
+
+    template<template<typename> class Extractor, typename... Ts>
+    template<typename T>
+    constexpr std::size_t sorted_value_table<Extractor, Ts...>::rank_of() noexcept {
+        constexpr std::size_t i = index_of_v<T, Ts...>;
+        static_assert(i < size, "sorted_value_table::rank_of<T>(): T is not registered");
+        return rank[i];
+    }
+
+    template<template<typename> class Extractor, typename... Ts>
+    template<typename F>
+    constexpr decltype(auto) sorted_value_table<Extractor, Ts...>::visit(std::size_t r, F&& f) {
+        return details::svt_visit(r, f, sorted_types{});
+    }
+
+} // namespace etools::meta
+
+#endif // ETOOLS_META_SORTED_VALUE_TABLE_TPP_
@@ -440,6 +440,47 @@ namespace etools::meta {
         */
         template<std::size_t N, typename... Ts>
         using nth_t = typename nth<N, Ts...>::type;
+
+        namespace details {
+            /// @brief First position of `T` in `Ts...`, or `sizeof...(Ts)`; backs `index_of`.
+            template<typename T, typename... Ts>
+            constexpr std::size_t index_of_scan() noexcept {
+                constexpr bool hits[] = { std::is_same_v<T, Ts>..., false };
+                std::size_t i = 0;
+                while (i < sizeof...(Ts) && !hits[i]) ++i;
+                return i;
+            }
+        } // namespace details
+
+        /**
+        * @struct index_of
+        * @brief Position of `T` in the parameter pack `Ts...` — the inverse of `nth`.
+        *
+        * `::value` is the zero-based index of the first occurrence of `T`, or
+        * `sizeof...(Ts)` if `T` does not occur, so the result doubles as a
+        * membership test (`index_of_v<T, Ts...> < sizeof...(Ts)`).
+        *
+        * @tparam T  Type to look up.
+        * @tparam Ts Parameter pack to search.
+        *
+        * @note Evaluated with a single constexpr scan over a `bool` array, so
+        *       instantiation depth stays constant in `sizeof...(Ts)`.
+        *
+        * @see index_of_v
+        */
+        template<typename T, typename... Ts>
+        struct index_of : std::integral_constant<std::size_t, details::index_of_scan<T, Ts...>()> {};
+
+        /**
+        * @brief Convenience alias for `index_of<T, Ts...>::value`.
+        *
+        * @code
+        * static_assert(etools::meta::index_of_v<double, int, double, float> == 1);
+        * static_assert(etools::meta::index_of_v<char, int, double> == 2); // not found
+        * @endcode
+        */
+        template<typename T, typename... Ts>
+        inline constexpr std::size_t index_of_v = index_of<T, Ts...>::value;
         
         /**
         * @brief Type trait that resolves to the smallest unsigned integer type
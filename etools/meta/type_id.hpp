@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file type_id.hpp
+*
+* @brief RTTI-free compile-time type names and 64-bit type IDs.
+*
+* @ingroup etools_meta etools::meta
+*
+* `type_name<T>()` recovers the spelling of `T` from the compiler-provided
+* function signature (`__PRETTY_FUNCTION__` on GCC/Clang, `__FUNCSIG__` on
+* MSVC) as a `constexpr std::string_view`. `type_id<T>()` hashes that string at
+* compile time with FNV-1a followed by the `hashing::mix_u64` finaliser.
+*
+* The ID is an ordinary integral constant, so it can be used wherever a
+* hand-assigned key was needed before:
+*
+* - as a key pack for `hashing::optimal_mph<type_id_t>::instance<...>()`;
+* - as the key of a `factories::dispatch_factory` through the `type_id_of`
+*   extractor, removing the per-type `static constexpr key` bookkeeping.
+*
+* Neither `typeid` nor `std::type_info` is involved, so everything works under
+* `-fno-rtti`.
+*
+* ### Example
+* @code
+* #include "etools/meta/type_id.hpp"
+* using namespace etools::meta;
+*
+* static_assert(type_name<int>() == "int");
+* static_assert(type_id<Cat>() != type_id<Dog>());
+*
+* // Keys for a dispatch_factory without hand-assigned constants.
+* dispatch_factory<animal, type_id_of, Cat, Dog> zoo;
+* auto h = zoo.emplace(type_id<Dog>());
+* @endcode
+*
+* @note IDs are stable for a given compiler family and version; they are not
+*       guaranteed to match across GCC, Clang and MSVC because each spells
+*       some types differently (e.g. `unsigned int` vs `unsigned`, or MSVC's
+*       `struct`/`class` prefixes). cv- and reference qualifiers are part of
+*       the type: `type_id<const T>() != type_id<T>()`.
+*
+* @note Distinct types receive distinct IDs with overwhelming probability (64
+*       bits of a well-mixed hash), not by construction. Consumers that need a
+*       guarantee should check the key pack — `optimal_mph` and
+*       `dispatch_factory` already reject duplicate keys at compile time.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_TYPE_ID_HPP_
+#define ETOOLS_META_TYPE_ID_HPP_
+#include <cstdint>     // For std::uint64_t
+#include <string_view> // For std::string_view
+#include "traits.hpp"            // For always_false_v
+#include "../hashing/utils.hpp"  // For mix_u64
+
+namespace etools::meta {
+
+    /// @brief Integral type of the IDs returned by `type_id`.
+    using type_id_t = std::uint64_t;
+
+    /**
+    * @brief Spelling of `T` as produced by the compiler, e.g. `"int"` or `"ns::widget"`.
+    *
+    * @tparam T Any type.
+    * @return A view into a string with static storage duration.
+    */
+    template<typename T>
+    [[nodiscard]] constexpr std::string_view type_name() noexcept;
+
+    /**
+    * @brief Compile-time 64-bit ID of `T`: FNV-1a over `type_name<T>()`, finalised with `mix_u64`.
+    *
+    * @tparam T Any type.
+    */
+    template<typename T>
+    [[nodiscard]] constexpr type_id_t type_id() noexcept;
+
+    /**
+    * @struct type_id_of
+    *
+    * @brief Key extractor exposing `type_id<T>()` as `::value`.
+    *
+    * Matches the `Extractor` contract of `factories::dispatch_factory`, so a
+    * factory keyed by type needs no per-type key constants.
+    *
+    * @tparam T Type whose ID is exposed.
+    */
+    template<typename T>
+    struct type_id_of {
+        static constexpr type_id_t value = type_id<T>();
+    };
+
+    /**
+    * @brief Convenience alias for `type_id_of<T>::value`.
+    */
+    template<typename T>
+    inline constexpr type_id_t type_id_v = type_id_of<T>::value;
+
+} // namespace etools::meta
+
+#include "type_id.tpp"
+#endif // ETOOLS_META_TYPE_ID_HPP_
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file type_id.tpp
+*
+* @brief Definition of type_id.hpp functions.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_TYPE_ID_TPP_
+#define ETOOLS_META_TYPE_ID_TPP_
+#include "type_id.hpp"
+
+namespace etools::meta::details {
+
+    /**
+    * @brief Full compiler-provided signature of this function for `T`.
+    *
+    * Everything except the spelling of `T` is identical across instantiations,
+    * which is what `type_name_prefix` / `type_name_suffix` rely on.
+    */
+    template<typename T>
+    constexpr std::string_view signature_of() noexcept {
+    #if defined(__clang__) || defined(__GNUC__)
+        return __PRETTY_FUNCTION__;
+    #elif defined(_MSC_VER)
+        return __FUNCSIG__;
+    #else
+        static_assert(always_false_v<T>, "type_name: unsupported compiler (needs __PRETTY_FUNCTION__ or __FUNCSIG__)");
+        return {};
+    #endif
+    }
+
+    // Calibrate once on a type with a known spelling. `rfind` skips any
+    // earlier "int" in the function's own qualified name or return type.
+    inline constexpr std::string_view type_name_probe     = signature_of<int>();
+    inline constexpr std::size_t      type_name_prefix    = type_name_probe.rfind("int");
+    inline constexpr std::size_t      type_name_suffix    = type_name_probe.size() - type_name_prefix - 3;
+    static_assert(type_name_prefix != std::string_view::npos, "type_name: cannot locate the probe type in the signature");
+
+    /// @brief 64-bit FNV-1a over `s`, finalised with `mix_u64` for full avalanche.
+    constexpr type_id_t hash_type_name(std::string_view s) noexcept {
+        std::uint64_t h = 0xCBF29CE484222325ULL;
+        for (char c : s) {
+            h ^= static_cast<unsigned char>(c);
+            h *= 0x100000001B3ULL;
+        }
+        return hashing::mix_u64(h);
+    }
+
+} // namespace etools::meta::details
+
+namespace etools::meta {
+
+    template<typename T>
+    constexpr std::string_view type_name() noexcept {
+        constexpr std::string_view sig = details::signature_of<T>();
+        return sig.substr(details::type_name_prefix,
+                          sig.size() - details::type_name_prefix - details::type_name_suffix);
+    }
+
+    template<typename T>
+    constexpr type_id_t type_id() noexcept {
+        return details::hash_type_name(type_name<T>());
+    }
+
+} // namespace etools::meta
+
+#endif // ETOOLS_META_TYPE_ID_TPP_
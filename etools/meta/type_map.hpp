@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file type_map.hpp
+*
+* @brief Dense, RTTI-free associative container keyed by type.
+*
+* @ingroup etools_meta etools::meta
+*
+* `type_map` replaces the `std::unordered_map<std::type_index, V>` pattern for
+* per-type state (counters, pools, handlers, ...) over a set of types known at
+* compile time. Every key maps to a fixed slot in a dense array, so:
+*
+* - access by type (`get<T>()`) is a constant offset — no hashing, no
+*   `typeid`, no RTTI;
+* - access by runtime index (`visit(i, f)`) goes through a `constexpr`
+*   function-pointer table built from `nth_t`, handing the visitor both the
+*   key type (as `type_identity<K>`) and the value.
+*
+* Two forms are provided:
+*
+* - **Homogeneous** — `type_map<typelist<Ks...>, Value>`: one `Value` per key,
+*   stored in a `std::array`; also indexable and iterable like an array.
+* - **Heterogeneous** — `type_map<type_pair<K, V>...>`: each key carries its
+*   own value type, stored in a `std::tuple`.
+*
+* ### Example
+* @code
+* #include "etools/meta/type_map.hpp"
+* using namespace etools::meta;
+*
+* type_map<typelist<Cat, Dog, Bird>, std::uint32_t> created{};
+* ++created.get<Dog>();
+*
+* type_map<type_pair<Cat, cat_pool>, type_pair<Dog, dog_pool>> pools;
+* pools.get<Cat>().reserve(16);
+*
+* // Runtime index (e.g. a stored tag) -> key type + value.
+* created.visit(tag, [](auto key, std::uint32_t& n) {
+*     using K = typename decltype(key)::type;
+*     log(K::name, n);
+* });
+* @endcode
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_TYPE_MAP_HPP_
+#define ETOOLS_META_TYPE_MAP_HPP_
+#include <array>       // For std::array
+#include <cstddef>     // For std::size_t
+#include <tuple>       // For std::tuple
+#include <type_traits> // For std::invoke_result_t, std::is_same_v
+#include <utility>     // For std::index_sequence
+#include "traits.hpp"   // For index_of_v, nth_t, type_identity, is_distinct_v
+#include "typelist.hpp" // For typelist
+
+namespace etools::meta {
+
+    /**
+    * @struct type_pair
+    *
+    * @brief Key/value type pair used to spell a heterogeneous `type_map`.
+    *
+    * @tparam Key   Key type (never instantiated).
+    * @tparam Value Type of the value stored for `Key`.
+    */
+    template<typename Key, typename Value>
+    struct type_pair {
+        using key   = Key;
+        using value = Value;
+    };
+
+    /**
+    * @class type_map
+    *
+    * @brief Associative container keyed by type. See the file-level documentation.
+    *
+    * Only the two specialisations below are defined:
+    * `type_map<typelist<Ks...>, Value>` and `type_map<type_pair<Ks, Vs>...>`.
+    */
+    template<typename... Args>
+    class type_map {
+        static_assert(always_false_v<typelist<Args...>>,
+            "type_map expects either <typelist<Ks...>, Value> or <type_pair<K, V>...>");
+    };
+
+    /**
+    * @brief Homogeneous form: one `Value` per key type, stored densely in key order.
+    *
+    * @tparam Ks    Distinct key types.
+    * @tparam Value Value type stored for every key.
+    */
+    template<typename... Ks, typename Value>
+    class type_map<typelist<Ks...>, Value> {
+        static_assert(is_distinct_v<Ks...>, "type_map keys must be distinct");
+    public:
+        using keys       = typelist<Ks...>;
+        using value_type = Value;
+
+        /// @brief Slot index of key `K`, or `size()` if `K` is not a key.
+        template<typename K>
+        static constexpr std::size_t index_of = index_of_v<K, Ks...>;
+        /// @brief `true` iff `K` is one of the keys.
+        template<typename K>
+        static constexpr bool contains = index_of<K> < sizeof...(Ks);
+        /// @brief Key type stored at slot `I`.
+        template<std::size_t I>
+        using key_t = nth_t<I, Ks...>;
+
+        /// @brief Value-initialises every slot.
+        constexpr type_map() = default;
+        /// @brief Initialises every slot with a copy of `fill`.
+        constexpr explicit type_map(const Value& fill);
+
+        /// @brief Number of keys.
+        [[nodiscard]] static constexpr std::size_t size() noexcept { return sizeof...(Ks); }
+
+        /// @brief Value stored for key `K` (compile error if `K` is not a key).
+        template<typename K> [[nodiscard]] constexpr Value& get() noexcept;
+        template<typename K> [[nodiscard]] constexpr const Value& get() const noexcept;
+        /// @brief Value stored at slot `I`.
+        template<std::size_t I> [[nodiscard]] constexpr Value& get() noexcept;
+        template<std::size_t I> [[nodiscard]] constexpr const Value& get() const noexcept;
+
+        /// @brief Value at runtime slot `i`. Asserts in debug if `i >= size()`.
+        [[nodiscard]] constexpr Value& operator[](std::size_t i) noexcept;
+        [[nodiscard]] constexpr const Value& operator[](std::size_t i) const noexcept;
+
+        [[nodiscard]] constexpr Value* begin() noexcept { return _values.data(); }
+        [[nodiscard]] constexpr Value* end() noexcept { return _values.data() + sizeof...(Ks); }
+        [[nodiscard]] constexpr const Value* begin() const noexcept { return _values.data(); }
+        [[nodiscard]] constexpr const Value* end() const noexcept { return _values.data() + sizeof...(Ks); }
+
+        /**
+        * @brief Calls `f(type_identity<K>{}, value)` for the key at runtime slot `i`.
+        *
+        * Dispatches through a function-pointer table; every instantiation of
+        * `f` must return the same type. Asserts in debug if `i >= size()`.
+        */
+        template<typename F> constexpr decltype(auto) visit(std::size_t i, F&& f);
+        template<typename F> constexpr decltype(auto) visit(std::size_t i, F&& f) const;
+
+        /// @brief Calls `f(type_identity<K>{}, value)` for every key, in key order.
+        template<typename F> constexpr void for_each(F&& f);
+        template<typename F> constexpr void for_each(F&& f) const;
+
+    private:
+        std::array<Value, sizeof...(Ks)> _values{};
+    };
+
+    /**
+    * @brief Heterogeneous form: key `Ks` stores a value of type `Vs`.
+    *
+    * @tparam Ks Distinct key types.
+    * @tparam Vs Value type for the corresponding key.
+    */
+    template<typename... Ks, typename... Vs>
+    class type_map<type_pair<Ks, Vs>...> {
+        static_assert(is_distinct_v<Ks...>, "type_map keys must be distinct");
+    public:
+        using keys = typelist<Ks...>;
+
+        /// @brief Slot index of key `K`, or `size()` if `K` is not a key.
+        template<typename K>
+        static constexpr std::size_t index_of = index_of_v<K, Ks...>;
+        /// @brief `true` iff `K` is one of the keys.
+        template<typename K>
+        static constexpr bool contains = index_of<K> < sizeof...(Ks);
+        /// @brief Key type stored at slot `I`.
+        template<std::size_t I>
+        using key_t = nth_t<I, Ks...>;
+        /// @brief Value type stored for key `K`.
+        template<typename K>
+        using value_t = nth_t<index_of<K>, Vs...>;
+
+        /// @brief Value-initialises every slot.
+        constexpr type_map() = default;
+
+        /// @brief Number of keys.
+        [[nodiscard]] static constexpr std::size_t size() noexcept { return sizeof...(Ks); }
+
+        /// @brief Value stored for key `K` (compile error if `K` is not a key).
+        template<typename K> [[nodiscard]] constexpr value_t<K>& get() noexcept;
+        template<typename K> [[nodiscard]] constexpr const value_t<K>& get() const noexcept;
+        /// @brief Value stored at slot `I`.
+        /// The return type clamps `I` so an out-of-range slot reaches the `static_assert` in the body.
+        template<std::size_t I> [[nodiscard]] constexpr nth_t<(I < sizeof...(Vs) ? I : 0), Vs...>& get() noexcept;
+        template<std::size_t I> [[nodiscard]] constexpr const nth_t<(I < sizeof...(Vs) ? I : 0), Vs...>& get() const noexcept;
+
+        /**
+        * @brief Calls `f(type_identity<K>{}, value)` for the key at runtime slot `i`.
+        *
+        * Dispatches through a function-pointer table; every instantiation of
+        * `f` must return the same type. Asserts in debug if `i >= size()`.
+        */
+        template<typename F> constexpr decltype(auto) visit(std::size_t i, F&& f);
+        template<typename F> constexpr decltype(auto) visit(std::size_t i, F&& f) const;
+
+        /// @brief Calls `f(type_identity<K>{}, value)` for every key, in key order.
+        template<typename F> constexpr void for_each(F&& f);
+        template<typename F> constexpr void for_each(F&& f) const;
+
+    private:
+        std::tuple<Vs...> _values{};
+    };
+
+} // namespace etools::meta
+
+#include "type_map.tpp"
+#endif // ETOOLS_META_TYPE_MAP_HPP_
@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file type_map.tpp
+*
+* @brief Definition of type_map.hpp methods.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_TYPE_MAP_TPP_
+#define ETOOLS_META_TYPE_MAP_TPP_
+#include "type_map.hpp"
+#include <cassert>
+
+namespace etools::meta::details {
+
+    /**
+    * @brief Jump-table entry for slot `I`: passes the key tag and the slot's value to `f`.
+    *
+    * `Map` may be const-qualified; `get<I>()` then yields a const reference.
+    */
+    template<typename R, std::size_t I, typename Map, typename F>
+    constexpr R tm_thunk(Map& map, F& f) {
+        using key = typename std::remove_const_t<Map>::template key_t<I>;
+        return f(type_identity<key>{}, map.template get<I>());
+    }
+
+    template<typename R, typename Map, typename F, std::size_t... Is>
+    inline constexpr R (*tm_table[])(Map&, F&) = { &tm_thunk<R, Is, Map, F>... };
+
+    template<typename Map, typename F, std::size_t I>
+    using tm_result_t = decltype(std::declval<F&>()(
+        type_identity<typename std::remove_const_t<Map>::template key_t<I>>{},
+        std::declval<Map&>().template get<I>()));
+
+    /**
+    * @brief Runtime slot -> key type dispatch shared by both `type_map` forms.
+    */
+    template<typename Map, typename F, std::size_t... Is>
+    constexpr decltype(auto) tm_visit(Map& map, std::size_t i, F& f, std::index_sequence<Is...>) {
+        static_assert(sizeof...(Is) > 0, "type_map::visit on an empty map");
+        using R = tm_result_t<Map, F, 0>;
+        static_assert((std::is_same_v<R, tm_result_t<Map, F, Is>> and ...),
+            "type_map::visit: the visitor must return the same type for every key");
+        assert(i < sizeof...(Is) && "type_map::visit(): slot out of range");
+        return tm_table<R, Map, F, Is...>[i](map, f);
+    }
+
+    template<typename Map, typename F, std::size_t... Is>
+    constexpr void tm_for_each(Map& map, F& f, std::index_sequence<Is...>) {
+        (f(type_identity<typename std::remove_const_t<Map>::template key_t<Is>>{}, map.template get<Is>()), ...);
+    }
+
+} // namespace etools::meta::details
+
+namespace etools::meta {
+
+    // --- homogeneous ---------------------------------------------------------
+
+    template<typename... Ks, typename Value>
+    constexpr type_map<typelist<Ks...>, Value>::type_map(const Value& fill) {
+        for (auto& v : _values) v = fill;
+    }
+
+    template<typename... Ks, typename Value>
+    template<typename K>
+    constexpr Value& type_map<typelist<Ks...>, Value>::get() noexcept {
+        static_assert(contains<K>, "type_map::get<K>(): K is not a key of this map");
+        return _values[index_of<K>];
+    }
+
+    template<typename... Ks, typename Value>
+    template<typename K>
+    constexpr const Value& type_map<typelist<Ks...>, Value>::get() const noexcept {
+        static_assert(contains<K>, "type_map::get<K>(): K is not a key of this map");
+        return _values[index_of<K>];
+    }
+
+    template<typename... Ks, typename Value>
+    template<std::size_t I>
+    constexpr Value& type_map<typelist<Ks...>, Value>::get() noexcept {
+        static_assert(I < sizeof...(Ks), "type_map::get<I>(): slot out of range");
+        return _values[I];
+    }
+
+    template<typename... Ks, typename Value>
+    template<std::size_t I>
+    constexpr const Value& type_map<typelist<Ks...>, Value>::get() const noexcept {
+        static_assert(I < sizeof...(Ks), "type_map::get<I>(): slot out of range");
+        return _values[I];
+    }
+
+    template<typename... Ks, typename Value>
+    constexpr Value& type_map<typelist<Ks...>, Value>::operator[](std::size_t i) noexcept {
+        assert(i < sizeof...(Ks) && "type_map::operator[]: slot out of range");
+        return _values[i];
+    }
+
+    template<typename... Ks, typename Value>
+    constexpr const Value& type_map<typelist<Ks...>, Value>::operator[](std::size_t i) const noexcept {
+        assert(i < sizeof...(Ks) && "type_map::operator[]: slot out of range");
+        return _values[i];
+    }
+
+    template<typename... Ks, typename Value>
+    template<typename F>
+    constexpr decltype(auto) type_map<typelist<Ks...>, Value>::visit(std::size_t i, F&& f) {
+        return details::tm_visit(*this, i, f, std::index_sequence_for<Ks...>{});
+    }
+
+    template<typename... Ks, typename Value>
+    template<typename F>
+    constexpr decltype(auto) type_map<typelist<Ks...>, Value>::visit(std::size_t i, F&& f) const {
+        return details::tm_visit(*this, i, f, std::index_sequence_for<Ks...>{});
+    }
+
+    template<typename... Ks, typename Value>
+    template<typename F>
+    constexpr void type_map<typelist<Ks...>, Value>::for_each(F&& f) {
+        details::tm_for_each(*this, f, std::index_sequence_for<Ks...>{});
+    }
+
+    template<typename... Ks, typename Value>
+    template<typename F>
+    constexpr void type_map<typelist<Ks...>, Value>::for_each(F&& f) const {
+        details::tm_for_each(*this, f, std::index_sequence_for<Ks...>{});
+    }
+
+    // --- heterogeneous -------------------------------------------------------
+
+    template<typename... Ks, typename... Vs>
+    template<typename K>
+    constexpr auto type_map<type_pair<Ks, Vs>...>::get() noexcept -> value_t<K>& {
+        static_assert(contains<K>, "type_map::get<K>(): K is not a key of this map");
+        return std::get<index_of<K>>(_values);
+    }
+
+    template<typename... Ks, typename... Vs>
+    template<typename K>
+    constexpr auto type_map<type_pair<Ks, Vs>...>::get() const noexcept -> const value_t<K>& {
+        static_assert(contains<K>, "type_map::get<K>(): K is not a key of this map");
+        return std::get<index_of<K>>(_values);
+    }
+
+    template<typename... Ks, typename... Vs>
+    template<std::size_t I>
+    constexpr auto type_map<type_pair<Ks, Vs>...>::get() noexcept -> nth_t<(I < sizeof...(Vs) ? I : 0), Vs...>& {
+        static_assert(I < sizeof...(Ks), "type_map::get<I>(): slot out of range");
+        return std::get<I>(_values);
+    }
+
+    template<typename... Ks, typename... Vs>
+    template<std::size_t I>
+    constexpr auto type_map<type_pair<Ks, Vs>...>::get() const noexcept -> const nth_t<(I < sizeof...(Vs) ? I : 0), Vs...>& {
+        static_assert(I < sizeof...(Ks), "type_map::get<I>(): slot out of range");
+        return std::get<I>(_values);
+    }
+
+    template<typename... Ks, typename... Vs>
+    template<typename F>
+    constexpr decltype(auto) type_map<type_pair<Ks, Vs>...>::visit(std::size_t i, F&& f) {
+        return details::tm_visit(*this, i, f, std::index_sequence_for<Ks...>{});
+    }
+
+    template<typename... Ks, typename... Vs>
+    template<typename F>
+    constexpr decltype(auto) type_map<type_pair<Ks, Vs>...>::visit(std::size_t i, F&& f) const {
+        return details::tm_visit(*this, i, f, std::index_sequence_for<Ks...>{});
+    }
+
+    template<typename... Ks, typename... Vs>
+    template<typename F>
+    constexpr void type_map<type_pair<Ks, Vs>...>::for_each(F&& f) {
+        details::tm_for_each(*this, f, std::index_sequence_for<Ks...>{});
+    }
+
+    template<typename... Ks, typename... Vs>
+    template<typename F>
+    constexpr void type_map<type_pair<Ks, Vs>...>::for_each(F&& f) const {
+        details::tm_for_each(*this, f, std::index_sequence_for<Ks...>{});
+    }
+
+} // namespace etools::meta
+
+#endif // ETOOLS_META_TYPE_MAP_TPP_
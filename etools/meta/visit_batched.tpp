@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file visit_batched.tpp
+*
+* @brief Definition of visit_batched.hpp functions.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_VISIT_BATCHED_TPP_
+#define ETOOLS_META_VISIT_BATCHED_TPP_
+#include "visit_batched.hpp"
+
+namespace etools::meta::details {
+
+    /**
+    * @brief Runs the handler for alternative `I` over its group `order[begin, end)`.
+    *
+    * The loop body is fully typed: no dispatch happens per element.
+    */
+    template<std::size_t I, typename Traits, typename V, typename Pos, typename F>
+    void visit_group(V* data, const Pos* order, std::size_t begin, std::size_t end, F& f) {
+        for (std::size_t j = begin; j < end; ++j)
+            f(Traits::template get<I>(data[order[j]]));
+    }
+
+    template<typename Traits, typename V, typename Pos, typename F, std::size_t... Is>
+    void visit_groups(V* data, const Pos* order, const std::size_t* start, F& f, std::index_sequence<Is...>) {
+        (visit_group<Is, Traits>(data, order, start[Is], start[Is + 1], f), ...);
+    }
+
+} // namespace etools::meta::details
+
+namespace etools::meta {
+
+    template<std::size_t Chunk, typename V, typename F>
+    void visit_batched(V* data, std::size_t count, F&& f) {
+        static_assert(Chunk > 0, "visit_batched: Chunk must be positive");
+        using traits = details::batch_traits<std::remove_const_t<V>>;
+        using pos_t  = smallest_uint_t<Chunk - 1>;
+        constexpr std::size_t buckets = traits::size + 1; // last bucket collects valueless elements
+
+        // Positions are split into `lanes` contiguous stripes, each with its own
+        // counters, so a run of one alternative does not serialise every
+        // increment on a single counter.
+        constexpr std::size_t lanes = 4;
+        using tag_t = smallest_uint_t<traits::size>;
+        pos_t order[Chunk];
+        tag_t tag[Chunk];
+        for (std::size_t base = 0; base < count; base += Chunk) {
+            V* chunk = data + base;
+            const std::size_t n = count - base < Chunk ? count - base : Chunk;
+            const std::size_t stripe = (n + lanes - 1) / lanes;
+
+            // Tag pass. Also counts alternative switches between neighbours: when
+            // they are rare, per-element dispatch predicts well and is cheaper
+            // than sorting, so the chunk is visited in place.
+            std::size_t switches = 0;
+            tag_t prev = static_cast<tag_t>(traits::bucket(chunk[0]));
+            for (std::size_t i = 0; i < n; ++i) {
+                tag[i] = static_cast<tag_t>(traits::bucket(chunk[i]));
+                switches += tag[i] != prev;
+                prev = tag[i];
+            }
+            if (switches * visit_batched_switch_ratio < n) {
+                for (std::size_t i = 0; i < n; ++i)
+                    if (tag[i] < traits::size) traits::visit(chunk[i], f);
+                continue;
+            }
+
+            std::size_t hist[lanes][buckets] = {};
+            for (std::size_t j = 0; j < stripe; ++j)
+                for (std::size_t l = 0; l < lanes; ++l) {
+                    const std::size_t i = l * stripe + j;
+                    if (i < n) ++hist[l][tag[i]];
+                }
+
+            // Exclusive prefix sum in (bucket, lane) order keeps the sort stable.
+            std::size_t start[buckets + 1];
+            std::size_t acc = 0;
+            for (std::size_t b = 0; b < buckets; ++b) {
+                start[b] = acc;
+                for (std::size_t l = 0; l < lanes; ++l) {
+                    const std::size_t c = hist[l][b];
+                    hist[l][b] = acc;
+                    acc += c;
+                }
+            }
+            start[buckets] = acc;
+
+            for (std::size_t j = 0; j < stripe; ++j)
+                for (std::size_t l = 0; l < lanes; ++l) {
+                    const std::size_t i = l * stripe + j;
+                    if (i < n) order[hist[l][tag[i]]++] = static_cast<pos_t>(i);
+                }
+
+            details::visit_groups<traits>(chunk, order, start, f, std::make_index_sequence<traits::size>{});
+        }
+    }
+
+} // namespace etools::meta
+
+#endif // ETOOLS_META_VISIT_BATCHED_TPP_
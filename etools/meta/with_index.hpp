@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file with_index.hpp
+*
+* @brief O(1) runtime index -> compile-time index dispatch.
+*
+* @ingroup etools_meta etools::meta
+*
+* `with_index<N>(i, f)` calls `f(std::integral_constant<std::size_t, I>{})`
+* with `I == i`. It replaces the common
+*
+* @code
+* ((i == Is ? (f(std::integral_constant<std::size_t, Is>{}), true) : false) || ...);
+* @endcode
+*
+* idiom, which compiles to a chain of up to `N` compares. Up to 16 indices the
+* call lowers to a dense `switch` (one jump table whose targets are the
+* inlined bodies of `f`); beyond that it indexes a `constexpr` array of
+* function pointers, so the cost is one indirect call for any `N`.
+*
+* ### Example
+* @code
+* #include "etools/meta/with_index.hpp"
+* using namespace etools::meta;
+*
+* std::tuple<A, B, C> t;
+* with_index<3>(i, [&](auto I) { std::get<I()>(t).run(); });
+*
+* // Results are forwarded; every instantiation must return the same type.
+* std::size_t sz = with_index<3>(i, [](auto I) { return sizeof(nth_t<I(), A, B, C>); });
+* @endcode
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_WITH_INDEX_HPP_
+#define ETOOLS_META_WITH_INDEX_HPP_
+#include <cstddef>     // For std::size_t
+#include <type_traits> // For std::integral_constant, std::is_same_v
+#include <utility>     // For std::index_sequence
+
+namespace etools::meta {
+
+    namespace details {
+        template<typename F, typename Seq>
+        struct wi_traits;
+    } // namespace details
+
+    /**
+    * @brief Invokes `f(std::integral_constant<std::size_t, I>{})` for `I == i`.
+    *
+    * Usable in constant expressions. `noexcept` iff every instantiation of
+    * `f` is.
+    *
+    * @tparam N Number of indices; must be at least 1.
+    * @tparam F Callable accepting `std::integral_constant<std::size_t, I>` for
+    *           every `I < N`, returning the same type for each.
+    * @param[in] i Runtime index.
+    * @param[in] f Callable; invoked as an lvalue.
+    * @return Whatever `f` returns.
+    *
+    * @pre `i < N` (checked by `assert`; undefined otherwise).
+    */
+    template<std::size_t N, typename F>
+    constexpr decltype(auto) with_index(std::size_t i, F&& f)
+        noexcept(details::wi_traits<F&, std::make_index_sequence<N>>::nothrow);
+
+} // namespace etools::meta
+
+#include "with_index.tpp"
+#endif // ETOOLS_META_WITH_INDEX_HPP_
@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file with_index.tpp
+*
+* @brief Definition of with_index.hpp functions.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_META_WITH_INDEX_TPP_
+#define ETOOLS_META_WITH_INDEX_TPP_
+#include "with_index.hpp"
+#include <cassert>
+
+namespace etools::meta::details {
+
+    template<std::size_t I>
+    using wi_index = std::integral_constant<std::size_t, I>;
+
+    /**
+    * @brief Common result and `noexcept`-ness of `F` over `wi_index<Is>...`.
+    */
+    template<typename F, std::size_t I0, std::size_t... Is>
+    struct wi_traits<F, std::index_sequence<I0, Is...>> {
+        using result = decltype(std::declval<F>()(wi_index<I0>{}));
+        static_assert((std::is_same_v<result, decltype(std::declval<F>()(wi_index<Is>{}))> and ...),
+            "with_index: the callable must return the same type for every index");
+        static constexpr bool nothrow = (noexcept(std::declval<F>()(wi_index<I0>{})) and ...
+                                         and noexcept(std::declval<F>()(wi_index<Is>{})));
+    };
+
+    template<typename F>
+    struct wi_traits<F, std::index_sequence<>> {
+        static_assert(sizeof(F) == 0, "with_index<N>: N must be at least 1");
+        using result = void;
+        static constexpr bool nothrow = true;
+    };
+
+    template<typename R, std::size_t I, typename F>
+    constexpr R wi_thunk(F& f) {
+        return f(wi_index<I>{});
+    }
+
+    template<typename R, typename F, std::size_t... Is>
+    inline constexpr R (*wi_table[])(F&) = { &wi_thunk<R, Is, F>... };
+
+    /// @brief Largest `N` lowered to a `switch`; larger `N` use `wi_table`.
+    inline constexpr std::size_t wi_switch_limit = 16;
+
+    template<typename R, std::size_t N, typename F>
+    constexpr R wi_switch(std::size_t i, F& f) {
+        static_assert(wi_switch_limit == 16, "wi_switch spells out exactly 16 cases");
+        switch (i) {
+#define ETOOLS_WI_CASE(K) \
+            case K: \
+                if constexpr ((K) < N) \
+                    return f(wi_index<((K) < N ? (K) : 0)>{}); \
+                else break;
+            ETOOLS_WI_CASE(0)  ETOOLS_WI_CASE(1)  ETOOLS_WI_CASE(2)  ETOOLS_WI_CASE(3)
+            ETOOLS_WI_CASE(4)  ETOOLS_WI_CASE(5)  ETOOLS_WI_CASE(6)  ETOOLS_WI_CASE(7)
+            ETOOLS_WI_CASE(8)  ETOOLS_WI_CASE(9)  ETOOLS_WI_CASE(10) ETOOLS_WI_CASE(11)
+            ETOOLS_WI_CASE(12) ETOOLS_WI_CASE(13) ETOOLS_WI_CASE(14) ETOOLS_WI_CASE(15)
+#undef ETOOLS_WI_CASE
+            default: break;
+        }
+        // with_index asserted i < N; let the optimizer drop the range check.
+    #if defined(__GNUC__) || defined(__clang__)
+        __builtin_unreachable();
+    #elif defined(_MSC_VER)
+        __assume(0);
+    #endif
+        return f(wi_index<0>{});
+    }
+
+    template<typename R, typename F, std::size_t... Is>
+    constexpr R wi_dispatch(std::size_t i, F& f, std::index_sequence<Is...>) {
+        if constexpr (sizeof...(Is) <= wi_switch_limit)
+            return wi_switch<R, sizeof...(Is)>(i, f);
+        else
+            return wi_table<R, F, Is...>[i](f);
+    }
+
+} // namespace etools::meta::details
+
+namespace etools::meta {
+
+    template<std::size_t N, typename F>
+    constexpr decltype(auto) with_index(std::size_t i, F&& f)
+        noexcept(details::wi_traits<F&, std::make_index_sequence<N>>::nothrow)
+    {
+        using R = typename details::wi_traits<F&, std::make_index_sequence<N>>::result;
+        assert(i < N && "with_index(): index out of range");
+        return details::wi_dispatch<R>(i, f, std::make_index_sequence<N>{});
+    }
+
+} // namespace etools::meta
+
+#endif // ETOOLS_META_WITH_INDEX_TPP_
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file events.hpp
+*
+* @brief Trace event vocabulary and the no-op trace policy.
+*
+* @ingroup etools_trace etools::trace
+*
+* Every hook point in etools reports one of the `event` values below, plus a
+* single `std::uint64_t` argument whose meaning is fixed per event:
+*
+* | Event | Fired by | Kind | Argument |
+* |---|---|---|---|
+* | `factory_emplace` | `factories::dispatch_factory::emplace` | span | key |
+* | `factory_release` | handle deleter of `dispatch_factory` | span | key |
+* | `pool_acquire` | a `dispatch_factory` slot is taken | instant | slot index |
+* | `pool_release` | a `dispatch_factory` slot is freed | instant | slot index |
+* | `buffer_pack` | `memory::buffer::pack` | span | bytes written (at end) |
+* | `buffer_unpack` | `memory::buffer::unpack`, `memory::buffer_view::unpack` | span | bytes read |
+* | `hash_hit` | `hashing::fks` / `hashing::llut` lookup (hence `optimal_mph`) | instant | key |
+* | `hash_miss` | same, key not in the set | instant | key |
+*
+* A trace policy is any type of the shape of `null_policy`; see `hooks.hpp`
+* for how one is selected.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_TRACE_EVENTS_HPP_
+#define ETOOLS_TRACE_EVENTS_HPP_
+#include <cstddef> // For std::size_t
+#include <cstdint> // For std::uint8_t, std::uint64_t
+
+namespace etools::trace {
+
+    /// @brief Hook points reported to the active trace policy.
+    enum class event : std::uint8_t {
+        factory_emplace,
+        factory_release,
+        pool_acquire,
+        pool_release,
+        buffer_pack,
+        buffer_unpack,
+        hash_hit,
+        hash_miss,
+    };
+
+    /// @brief Number of `event` enumerators.
+    inline constexpr std::size_t event_count = 8;
+
+    /// @brief Display name of `e`, e.g. `"buffer::pack"`.
+    constexpr const char* name(event e) noexcept {
+        switch (e) {
+            case event::factory_emplace: return "dispatch_factory::emplace";
+            case event::factory_release: return "dispatch_factory::release";
+            case event::pool_acquire:    return "pool::acquire";
+            case event::pool_release:    return "pool::release";
+            case event::buffer_pack:     return "buffer::pack";
+            case event::buffer_unpack:   return "buffer::unpack";
+            case event::hash_hit:        return "mph::hit";
+            case event::hash_miss:       return "mph::miss";
+        }
+        return "?";
+    }
+
+    /// @brief Name of the etools module that fires `e` (`"factories"`, `"memory"` or `"hashing"`).
+    constexpr const char* category(event e) noexcept {
+        switch (e) {
+            case event::factory_emplace:
+            case event::factory_release:
+            case event::pool_acquire:
+            case event::pool_release:    return "factories";
+            case event::buffer_pack:
+            case event::buffer_unpack:   return "memory";
+            case event::hash_hit:
+            case event::hash_miss:       return "hashing";
+        }
+        return "?";
+    }
+
+    /**
+    * @brief Default trace policy: records nothing.
+    *
+    * With `enabled == false` every hook compiles to nothing - the member
+    * functions are never called and exist only to document the interface a
+    * policy must provide.
+    */
+    struct null_policy {
+        /// @brief `false` removes every hook at compile time.
+        static constexpr bool enabled = false;
+
+        /// @brief A span named `e` starts on the calling thread.
+        static void begin(event, std::uint64_t) noexcept {}
+
+        /// @brief The innermost open span named `e` on the calling thread ends.
+        static void end(event, std::uint64_t) noexcept {}
+
+        /// @brief A point event.
+        static void instant(event, std::uint64_t) noexcept {}
+    };
+
+} // namespace etools::trace
+
+#endif // ETOOLS_TRACE_EVENTS_HPP_
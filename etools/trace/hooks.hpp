@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file hooks.hpp
+*
+* @brief Compile-time selected tracing hooks used inside etools.
+*
+* @ingroup etools_trace etools::trace
+*
+* The library reports the events listed in `events.hpp` through the policy
+* named by the `ETOOLS_TRACE_POLICY` macro. It defaults to `null_policy`,
+* whose `enabled == false` turns `span` into an empty object and `instant` /
+* `lookup` into nothing: an untraced build emits exactly the code it emitted
+* before the hooks existed.
+*
+* ### Selecting a policy
+* A policy is a type with `static constexpr bool enabled` and the three
+* static `noexcept` functions of `null_policy`. Name it before the first etools
+* header is seen, either in a config header:
+*
+* @code
+* #include "etools/trace/ring_recorder.hpp"
+* #define ETOOLS_TRACE_POLICY ::etools::trace::ring_recorder<>
+* #include "etools/etools.hpp"
+* @endcode
+*
+* or on the command line, together with the header that declares it:
+*
+* @code
+* -DETOOLS_TRACE_POLICY_HEADER='"etools/trace/ring_recorder.hpp"' -DETOOLS_TRACE_POLICY='::etools::trace::ring_recorder<>'
+* @endcode
+*
+* @warning Every translation unit of a program must see the same policy;
+*          mixing policies across translation units is an ODR violation.
+* @note Hash lookup hooks stay silent during constant evaluation. They need
+*       `__builtin_is_constant_evaluated` (GCC 9, Clang 9, MSVC 19.25); on
+*       compilers without it lookups are never traced.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_TRACE_HOOKS_HPP_
+#define ETOOLS_TRACE_HOOKS_HPP_
+#include <cstddef>    // For std::size_t
+#include <cstdint>    // For std::uint64_t
+#include "events.hpp" // For event, null_policy
+
+#ifdef ETOOLS_TRACE_POLICY_HEADER
+    #include ETOOLS_TRACE_POLICY_HEADER
+#endif
+
+#ifndef ETOOLS_TRACE_POLICY
+    #define ETOOLS_TRACE_POLICY ::etools::trace::null_policy
+#endif
+
+namespace etools::trace {
+
+    /// @brief The policy selected by `ETOOLS_TRACE_POLICY`.
+    using policy = ETOOLS_TRACE_POLICY;
+
+    /// @brief `true` if the active policy records anything.
+    inline constexpr bool enabled = policy::enabled;
+
+    /**
+    * @brief RAII span: `policy::begin(E, arg)` on construction, `policy::end(E, arg)` on destruction.
+    *
+    * The argument can be replaced before the span closes with `arg()`, e.g. to
+    * report a byte count that is only known at the end. Empty and inert when
+    * tracing is disabled.
+    *
+    * @tparam E Event reported for both ends of the span.
+    */
+    template<event E, bool Enabled = enabled>
+    class span {
+    public:
+        explicit span(std::uint64_t arg = 0) noexcept;
+        ~span() noexcept;
+
+        span(const span&) = delete;
+        span& operator=(const span&) = delete;
+
+        /// @brief Sets the argument reported by `end`.
+        void arg(std::uint64_t value) noexcept;
+
+    private:
+        std::uint64_t _arg;
+    };
+
+    /// @cond INTERNAL
+    template<event E>
+    class span<E, false> {
+    public:
+        constexpr explicit span(std::uint64_t = 0) noexcept {}
+        span(const span&) = delete;
+        span& operator=(const span&) = delete;
+        constexpr void arg(std::uint64_t) noexcept {}
+    };
+    /// @endcond
+
+    /**
+    * @brief Reports a point event `E` with argument `arg`.
+    */
+    template<event E>
+    void instant(std::uint64_t arg) noexcept;
+
+    /**
+    * @brief Reports a perfect-hash lookup result and returns it unchanged.
+    *
+    * Fires `hash_miss` when `index == not_found`, `hash_hit` otherwise, with
+    * the key as argument. Usable in constant expressions; nothing is reported
+    * during constant evaluation.
+    *
+    * @param[in] index     Result of the lookup.
+    * @param[in] not_found The table's miss sentinel.
+    * @param[in] key       Queried key (integral or enum).
+    * @return `index`.
+    */
+    template<typename Key>
+    constexpr std::size_t lookup(std::size_t index, std::size_t not_found, Key key) noexcept;
+
+} // namespace etools::trace
+
+#include "hooks.tpp"
+#endif // ETOOLS_TRACE_HOOKS_HPP_
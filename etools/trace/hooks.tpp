@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file hooks.tpp
+*
+* @brief Definition of hooks.hpp methods.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_TRACE_HOOKS_TPP_
+#define ETOOLS_TRACE_HOOKS_TPP_
+#include "hooks.hpp"
+
+// Local wrapper: defining `__has_builtin` itself would leak a reserved name into every includer.
+#ifdef __has_builtin
+    #define ETOOLS_TRACE_HAS_BUILTIN(x) __has_builtin(x)
+#else
+    #define ETOOLS_TRACE_HAS_BUILTIN(x) 0
+#endif
+
+namespace etools::trace {
+
+    namespace details {
+
+        /// @brief `true` while constant-evaluating; always `true` when the compiler cannot tell.
+        constexpr bool constant_evaluated() noexcept {
+        #if ETOOLS_TRACE_HAS_BUILTIN(__builtin_is_constant_evaluated) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+            return __builtin_is_constant_evaluated();
+        #else
+            return true;
+        #endif
+        }
+
+    } // namespace details
+
+    template<event E, bool Enabled>
+    span<E, Enabled>::span(std::uint64_t arg) noexcept
+        : _arg{arg}
+    {
+        policy::begin(E, _arg);
+    }
+
+    template<event E, bool Enabled>
+    span<E, Enabled>::~span() noexcept {
+        policy::end(E, _arg);
+    }
+
+    template<event E, bool Enabled>
+    void span<E, Enabled>::arg(std::uint64_t value) noexcept {
+        _arg = value;
+    }
+
+    template<event E>
+    inline void instant(std::uint64_t arg) noexcept {
+        if constexpr (enabled) policy::instant(E, arg);
+        else (void)arg;
+    }
+
+    template<typename Key>
+    constexpr std::size_t lookup(std::size_t index, std::size_t not_found, Key key) noexcept {
+        if constexpr (enabled) {
+            if (!details::constant_evaluated())
+                policy::instant(index == not_found ? event::hash_miss : event::hash_hit,
+                                static_cast<std::uint64_t>(key));
+        } else {
+            (void)not_found;
+            (void)key;
+        }
+        return index;
+    }
+
+} // namespace etools::trace
+
+#undef ETOOLS_TRACE_HAS_BUILTIN
+
+#endif // ETOOLS_TRACE_HOOKS_TPP_
@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file ring_recorder.hpp
+*
+* @brief Trace policy recording into lock-free per-thread ring buffers, with Chrome trace JSON export.
+*
+* @ingroup etools_trace etools::trace
+*
+* `ring_recorder<Capacity, MaxThreads>` is a ready-made policy for
+* `ETOOLS_TRACE_POLICY` (see `hooks.hpp`). Each thread that fires an event
+* claims one of `MaxThreads` statically allocated rings on first use and from
+* then on writes only to its own ring: one timestamp read, one 24-byte store
+* and one release store of the ring head per event - no locks, no atomics
+* shared between threads, no allocation. Once a ring is full the oldest
+* records are overwritten.
+*
+* Timestamps come from `read_tsc()`: the time-stamp counter on x86, the
+* virtual counter on AArch64, `std::chrono::steady_clock` in nanoseconds
+* elsewhere. `write_chrome_trace` converts them to microseconds and writes a
+* file that `chrome://tracing` and Perfetto open directly.
+*
+* ### Example
+* @code
+* #include "etools/trace/ring_recorder.hpp"
+* #define ETOOLS_TRACE_POLICY ::etools::trace::ring_recorder<>
+* #include "etools/etools.hpp"
+*
+* // ... run the workload ...
+*
+* std::FILE* f = std::fopen("etools.trace.json", "w");
+* etools::trace::ring_recorder<>::write_chrome_trace(f);
+* std::fclose(f);
+* @endcode
+*
+* @note Rings are never returned: a thread that exits keeps its ring, so its
+*       events still appear in the dump, and the `MaxThreads + 1`-th thread
+*       to fire an event records nothing (`dropped()` counts those events).
+* @note The static footprint is `24 * Capacity * MaxThreads` bytes plus one
+*       cache line per ring. This is a host-side tool; embedded targets keep
+*       the default `null_policy`.
+* @warning `write_chrome_trace` and `clear` read or reset other threads'
+*          rings. Call them while traced threads are idle; a ring that wraps
+*          during a dump may contribute torn records at its oldest end.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_TRACE_RING_RECORDER_HPP_
+#define ETOOLS_TRACE_RING_RECORDER_HPP_
+#include <array>      // For std::array
+#include <atomic>     // For std::atomic
+#include <cstddef>    // For std::size_t
+#include <cstdint>    // For std::uint64_t
+#include <cstdio>     // For std::FILE
+#include "events.hpp" // For event
+
+namespace etools::trace {
+
+    /**
+    * @brief Reads the fastest monotonic tick counter available.
+    *
+    * `rdtsc` on x86/x86-64, `cntvct_el0` on AArch64, nanoseconds of
+    * `std::chrono::steady_clock` otherwise.
+    */
+    inline std::uint64_t read_tsc() noexcept;
+
+    /**
+    * @brief Number of `read_tsc()` ticks per microsecond.
+    *
+    * Measured once against `std::chrono::steady_clock` over about 10 ms on
+    * first call and cached; exactly `1000` when `read_tsc()` already counts
+    * nanoseconds.
+    */
+    inline double tsc_ticks_per_us() noexcept;
+
+    /**
+    * @brief Trace policy writing every event to the calling thread's ring buffer.
+    *
+    * @tparam Capacity   Records kept per thread; must be a power of two.
+    * @tparam MaxThreads Number of rings, i.e. of distinct threads recorded.
+    */
+    template<std::size_t Capacity = 4096, std::size_t MaxThreads = 16>
+    class ring_recorder {
+        static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0,
+            "ring_recorder: Capacity must be a power of two");
+        static_assert(MaxThreads != 0, "ring_recorder: MaxThreads must be at least 1");
+
+    public:
+        static constexpr bool enabled = true;
+
+        /// @brief Records the start of a span (`"ph":"B"`).
+        static void begin(event e, std::uint64_t arg) noexcept;
+
+        /// @brief Records the end of a span (`"ph":"E"`).
+        static void end(event e, std::uint64_t arg) noexcept;
+
+        /// @brief Records a thread-scoped instant event (`"ph":"i"`).
+        static void instant(event e, std::uint64_t arg) noexcept;
+
+        /**
+        * @brief Writes every retained record as Chrome trace event JSON.
+        *
+        * Timestamps are relative to the oldest retained record. Each ring is
+        * reported as its own thread, numbered from 1 in claim order.
+        *
+        * @param[in] out          Destination stream.
+        * @param[in] ticks_per_us Conversion factor; defaults to `tsc_ticks_per_us()`.
+        * @return Number of events written.
+        */
+        static std::size_t write_chrome_trace(std::FILE* out) noexcept;
+        static std::size_t write_chrome_trace(std::FILE* out, double ticks_per_us) noexcept;
+
+        /// @brief Number of records currently retained across all rings.
+        [[nodiscard]] static std::size_t size() noexcept;
+
+        /// @brief Events discarded because more than `MaxThreads` threads fired events.
+        [[nodiscard]] static std::size_t dropped() noexcept;
+
+        /// @brief Discards all retained records. Rings stay claimed by their threads.
+        static void clear() noexcept;
+
+    private:
+        enum class phase : std::uint8_t { begin, end, instant };
+
+        struct record {
+            std::uint64_t tsc;
+            std::uint64_t arg;
+            event e;
+            phase ph;
+        };
+
+        struct alignas(64) ring {
+            std::atomic<std::uint64_t> head; // total records ever pushed
+            std::array<record, Capacity> records;
+        };
+
+        static ring* local() noexcept;
+        static void push(event e, phase ph, std::uint64_t arg) noexcept;
+        static std::size_t claimed() noexcept;
+
+        static inline std::array<ring, MaxThreads> _rings{};
+        static inline std::atomic<std::size_t> _claimed{0};
+        static inline std::atomic<std::size_t> _dropped{0};
+    };
+
+} // namespace etools::trace
+
+#include "ring_recorder.tpp"
+#endif // ETOOLS_TRACE_RING_RECORDER_HPP_
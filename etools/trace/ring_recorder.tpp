@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file ring_recorder.tpp
+*
+* @brief Definition of ring_recorder.hpp methods.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_TRACE_RING_RECORDER_TPP_
+#define ETOOLS_TRACE_RING_RECORDER_TPP_
+#include "ring_recorder.hpp"
+#include <chrono>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define ETOOLS_TRACE_TSC_X86 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #include <x86intrin.h>
+    #define ETOOLS_TRACE_TSC_X86 1
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+    #define ETOOLS_TRACE_TSC_ARM64 1
+#endif
+
+namespace etools::trace {
+
+    inline std::uint64_t read_tsc() noexcept {
+    #if defined(ETOOLS_TRACE_TSC_X86)
+        return static_cast<std::uint64_t>(__rdtsc());
+    #elif defined(ETOOLS_TRACE_TSC_ARM64)
+        std::uint64_t v;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(v));
+        return v;
+    #else
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    #endif
+    }
+
+    inline double tsc_ticks_per_us() noexcept {
+    #if defined(ETOOLS_TRACE_TSC_X86) || defined(ETOOLS_TRACE_TSC_ARM64)
+        static const double rate = [] {
+            using clock = std::chrono::steady_clock;
+            const auto t0 = clock::now();
+            const std::uint64_t c0 = read_tsc();
+            auto t1 = t0;
+            while (t1 - t0 < std::chrono::milliseconds(10)) t1 = clock::now();
+            const std::uint64_t c1 = read_tsc();
+            const double us = std::chrono::duration<double, std::micro>(t1 - t0).count();
+            return static_cast<double>(c1 - c0) / us;
+        }();
+        return rate;
+    #else
+        return 1000.0;
+    #endif
+    }
+
+    template<std::size_t Capacity, std::size_t MaxThreads>
+    auto ring_recorder<Capacity, MaxThreads>::local() noexcept -> ring* {
+        thread_local ring* const r = [] () noexcept -> ring* {
+            const std::size_t i = _claimed.fetch_add(1, std::memory_order_relaxed);
+            return i < MaxThreads ? &_rings[i] : nullptr;
+        }();
+        return r;
+    }
+
+    template<std::size_t Capacity, std::size_t MaxThreads>
+    inline void ring_recorder<Capacity, MaxThreads>::push(event e, phase ph, std::uint64_t arg) noexcept {
+        ring* r = local();
+        if (!r) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        // Single writer per ring: the head only needs to publish the record to readers.
+        const std::uint64_t h = r->head.load(std::memory_order_relaxed);
+        r->records[h & (Capacity - 1)] = record{read_tsc(), arg, e, ph};
+        r->head.store(h + 1, std::memory_order_release);
+    }
+
+    template<std::size_t Capacity, std::size_t MaxThreads>
+    void ring_recorder<Capacity, MaxThreads>::begin(event e, std::uint64_t arg) noexcept {
+        push(e, phase::begin, arg);
+    }
+
+    template<std::size_t Capacity, std::size_t MaxThreads>
+    void ring_recorder<Capacity, MaxThreads>::end(event e, std::uint64_t arg) noexcept {
+        push(e, phase::end, arg);
+    }
+
+    template<std::size_t Capacity, std::size_t MaxThreads>
+    void ring_recorder<Capacity, MaxThreads>::instant(event e, std::uint64_t arg) noexcept {
+        push(e, phase::instant, arg);
+    }
+
+    template<std::size_t Capacity, std::size_t MaxThreads>
+    std::size_t ring_recorder<Capacity, MaxThreads>::claimed() noexcept {
+        const std::size_t n = _claimed.load(std::memory_order_acquire);
+        return n < MaxThreads ? n : MaxThreads;
+    }
+
+    template<std::size_t Capacity, std::size_t MaxThreads>
+    std::size_t ring_recorder<Capacity, MaxThreads>::size() noexcept {
+        std::size_t n = 0;
+        for (std::size_t t = 0; t < claimed(); ++t) {
+            const std::uint64_t h = _rings[t].head.load(std::memory_order_acquire);
+            n += static_cast<std::size_t>(h < Capacity ? h : Capacity);
+        }
+        return n;
+    }
+
+    template<std::size_t Capacity, std::size_t MaxThreads>
+    std::size_t ring_recorder<Capacity, MaxThreads>::dropped() noexcept {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+    template<std::size_t Capacity, std::size_t MaxThreads>
+    void ring_recorder<Capacity, MaxThreads>::clear() noexcept {
+        for (std::size_t t = 0; t < claimed(); ++t)
+            _rings[t].head.store(0, std::memory_order_release);
+        _dropped.store(0, std::memory_order_relaxed);
+    }
+
+    template<std::size_t Capacity, std::size_t MaxThreads>
+    std::size_t ring_recorder<Capacity, MaxThreads>::write_chrome_trace(std::FILE* out) noexcept {
+        return write_chrome_trace(out, tsc_ticks_per_us());
+    }
+
+    template<std::size_t Capacity, std::size_t MaxThreads>
+    std::size_t ring_recorder<Capacity, MaxThreads>::write_chrome_trace(std::FILE* out, double ticks_per_us) noexcept {
+        const std::size_t threads = claimed();
+        std::array<std::uint64_t, MaxThreads> heads{};
+        std::uint64_t origin = ~std::uint64_t{0};
+        for (std::size_t t = 0; t < threads; ++t) {
+            const std::uint64_t h = _rings[t].head.load(std::memory_order_acquire);
+            heads[t] = h;
+            if (h == 0) continue;
+            const std::uint64_t first = h > Capacity ? h - Capacity : 0;
+            const std::uint64_t tsc = _rings[t].records[first & (Capacity - 1)].tsc;
+            if (tsc < origin) origin = tsc;
+        }
+
+        static constexpr const char phases[] = {'B', 'E', 'i'};
+        std::size_t written = 0;
+        std::fputs("{\"traceEvents\":[", out);
+        for (std::size_t t = 0; t < threads; ++t) {
+            const std::uint64_t h = heads[t];
+            for (std::uint64_t i = h > Capacity ? h - Capacity : 0; i < h; ++i) {
+                const record& r = _rings[t].records[i & (Capacity - 1)];
+                const double ts = r.tsc >= origin ? static_cast<double>(r.tsc - origin) / ticks_per_us : 0.0;
+                std::fprintf(out,
+                    "%s\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",%s\"ts\":%.3f,\"pid\":1,\"tid\":%zu,"
+                    "\"args\":{\"arg\":%llu}}",
+                    written ? "," : "", name(r.e), category(r.e), phases[static_cast<std::size_t>(r.ph)],
+                    r.ph == phase::instant ? "\"s\":\"t\"," : "", ts, t + 1,
+                    static_cast<unsigned long long>(r.arg));
+                ++written;
+            }
+        }
+        std::fputs("\n],\"displayTimeUnit\":\"ns\"}\n", out);
+        return written;
+    }
+
+} // namespace etools::trace
+
+#endif // ETOOLS_TRACE_RING_RECORDER_TPP_
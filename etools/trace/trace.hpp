@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: MIT
+/**
+* @file trace.hpp
+*
+* @ingroup etools
+*
+* @defgroup etools_trace etools::trace
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-18
+*
+* @copyright
+* MIT License
+* Copyright (c) 2026 Mark Tikhonov
+* See the accompanying LICENSE file for details.
+*/
+#ifndef ETOOLS_TRACE_TRACE_HPP_
+#define ETOOLS_TRACE_TRACE_HPP_
+#include "events.hpp"
+#include "ring_recorder.hpp"
+#include "hooks.hpp"
+#endif // ETOOLS_TRACE_TRACE_HPP_
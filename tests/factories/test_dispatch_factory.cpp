@@ -1062,3 +1062,25 @@ TEST(DispatchFactoryMulti, EmptyHandleFromOverfill_IsSafeToDestroy) {
     EXPECT_EQ(dynamic_cast<b8*>(h1.get())->value, 2);
     EXPECT_EQ(dynamic_cast<b8*>(h2.get())->value, 3);
 }
+
+// ===========================================================================
+// keyed_dispatch_factory: extractor-free registration through `static key`
+// ===========================================================================
+
+TEST(KeyedDispatchFactory, SameTypeAsExplicitStaticKeyExtractor) {
+    static_assert(std::is_same_v<factories::keyed_dispatch_factory<base, a8, b8>,
+                                 dispatch_factory<base, meta::static_key, a8, b8>>);
+    static_assert(meta::has_static_key_v<a8>);
+    static_assert(!meta::has_static_key_v<base>);
+}
+
+TEST(KeyedDispatchFactory, EmplacesByOwnKey) {
+    factories::keyed_dispatch_factory<base, a8, capacity<b8, 2>> f;
+
+    auto ha = f.emplace(a8::key);
+    auto hb = f.emplace(b8::key, 42);
+    ASSERT_NE(ha, nullptr);
+    ASSERT_NE(hb, nullptr);
+    EXPECT_STREQ(ha->tag(), "a8");
+    EXPECT_EQ(dynamic_cast<b8*>(hb.get())->value, 42);
+}
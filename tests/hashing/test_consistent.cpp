@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <etools/hashing/consistent.hpp>
+
+using namespace etools::hashing;
+
+namespace {
+
+std::vector<std::uint64_t> make_keys(std::size_t n) {
+    std::vector<std::uint64_t> keys(n);
+    for (std::size_t i = 0; i < n; ++i) keys[i] = mix_u64(i + 1);
+    return keys;
+}
+
+} // namespace
+
+static_assert(jump_hash(123456789, 1) == 0);
+static_assert(jump_hash(0, 1000) < 1000);
+
+TEST(JumpHash, GrowingMovesKeysOnlyToTheNewBucket) {
+    const auto keys = make_keys(20000);
+    for (std::uint32_t n = 1; n < 40; ++n) {
+        std::size_t moved = 0;
+        for (std::uint64_t k : keys) {
+            const std::uint32_t a = jump_hash(k, n);
+            const std::uint32_t b = jump_hash(k, n + 1);
+            ASSERT_LT(a, n);
+            if (a != b) {
+                ASSERT_EQ(b, n);
+                ++moved;
+            }
+        }
+        // Expected fraction 1/(n+1); allow generous sampling noise.
+        const double frac = static_cast<double>(moved) / keys.size();
+        EXPECT_NEAR(frac, 1.0 / (n + 1), 0.02) << "n=" << n;
+    }
+}
+
+TEST(JumpHash, BalancedAndBatchMatchesScalar) {
+    const auto keys = make_keys(64000);
+    std::vector<std::uint32_t> out(keys.size());
+    jump_hash(keys.data(), keys.size(), 16, out.data());
+
+    std::array<std::size_t, 16> counts{};
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        ASSERT_EQ(out[i], jump_hash(keys[i], 16));
+        ++counts[out[i]];
+    }
+    for (std::size_t c : counts) EXPECT_NEAR(static_cast<double>(c), 4000.0, 300.0);
+}
+
+TEST(RendezvousHash, RemovingAnyNodeMovesOnlyItsKeys) {
+    const auto keys = make_keys(20000);
+    const std::uint64_t ids[] = {11, 22, 33, 44, 55};
+    const std::uint64_t without_33[] = {11, 22, 44, 55};
+
+    for (std::uint64_t k : keys) {
+        const std::uint64_t before = ids[rendezvous_hash(k, ids, 5)];
+        const std::uint64_t after = without_33[rendezvous_hash(k, without_33, 4)];
+        if (before != 33) { ASSERT_EQ(before, after); }
+    }
+}
+
+TEST(RendezvousHash, WeightsSetTheShareAndBatchMatchesScalar) {
+    const auto keys = make_keys(60000);
+    const hrw_node nodes[] = {{0xA1, 1.0}, {0xB2, 2.0}, {0xC3, 1.0}};
+    std::vector<std::uint32_t> out(keys.size());
+    rendezvous_hash(keys.data(), keys.size(), nodes, 3, out.data());
+
+    std::array<std::size_t, 3> counts{};
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        ASSERT_EQ(out[i], rendezvous_hash(keys[i], nodes, 3));
+        ++counts[out[i]];
+    }
+    EXPECT_NEAR(counts[0] / 60000.0, 0.25, 0.01);
+    EXPECT_NEAR(counts[1] / 60000.0, 0.50, 0.01);
+    EXPECT_NEAR(counts[2] / 60000.0, 0.25, 0.01);
+
+    // A node whose weight doubles only gains keys.
+    const hrw_node heavier[] = {{0xA1, 2.0}, {0xB2, 2.0}, {0xC3, 1.0}};
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        const std::uint32_t now = rendezvous_hash(keys[i], heavier, 3);
+        if (now != out[i]) { ASSERT_EQ(now, 0u); }
+    }
+}
+
+TEST(BoundedLoadHash, NoBucketExceedsCapacity) {
+    const auto keys = make_keys(10000);
+    bounded_load_hash<16> lb{10, 0.1};
+    for (std::uint64_t k : keys) {
+        const std::uint32_t cap = lb.capacity();
+        const std::uint32_t b = lb.assign(k);
+        ASSERT_LT(b, 10u);
+        ASSERT_LE(lb.load(b), cap);
+    }
+    EXPECT_EQ(lb.size(), keys.size());
+    for (std::uint32_t b = 0; b < 10; ++b) EXPECT_LE(lb.load(b), 1100u);
+}
+
+TEST(BoundedLoadHash, WithoutOverflowItIsJumpHash) {
+    const auto keys = make_keys(1000);
+    bounded_load_hash<8> lb{8, 100.0};
+    std::vector<std::uint32_t> out(keys.size());
+    lb.assign(keys.data(), keys.size(), out.data());
+    for (std::size_t i = 0; i < keys.size(); ++i) EXPECT_EQ(out[i], jump_hash(mix_u64(keys[i]), 8));
+}
+
+TEST(BoundedLoadHash, ReleaseAndClear) {
+    bounded_load_hash<4> lb{4};
+    const std::uint32_t a = lb.assign(1);
+    const std::uint32_t b = lb.assign(2);
+    EXPECT_EQ(lb.size(), 2u);
+    lb.release(a);
+    EXPECT_EQ(lb.size(), 1u);
+    EXPECT_EQ(lb.load(b), 1u);
+    lb.clear();
+    EXPECT_EQ(lb.size(), 0u);
+    for (std::uint32_t i = 0; i < 4; ++i) EXPECT_EQ(lb.load(i), 0u);
+}
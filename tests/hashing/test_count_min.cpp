@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <etools/hashing/count_min.hpp>
+
+using namespace etools::hashing;
+
+namespace {
+
+// Zipf-like stream: key k appears 1000 / k times.
+std::vector<std::uint64_t> skewed_stream() {
+    std::vector<std::uint64_t> keys;
+    for (std::uint64_t k = 1; k <= 1000; ++k)
+        for (std::uint64_t c = 0; c < 1000 / k; ++c) keys.push_back(k);
+    return keys;
+}
+
+} // namespace
+
+TEST(CountMinSketch, NeverUnderestimatesAndBoundsError) {
+    const auto keys = skewed_stream();
+    count_min_sketch<512, 4> s;
+    s.update(keys.data(), keys.size());
+    ASSERT_EQ(s.total(), keys.size());
+
+    const double bound = 2.718281828 / 512 * static_cast<double>(s.total());
+    std::size_t over_bound = 0;
+    for (std::uint64_t k = 1; k <= 1000; ++k) {
+        const std::uint32_t truth = static_cast<std::uint32_t>(1000 / k);
+        const std::uint32_t est = s.estimate(k);
+        ASSERT_GE(est, truth) << k;
+        over_bound += est - truth > bound;
+    }
+    EXPECT_LE(over_bound, 1000u / 20); // failure probability e^-4 < 2%
+}
+
+TEST(CountMinSketch, FindsHeavyHitters) {
+    count_min_sketch<1024, 4> s;
+    for (std::uint64_t i = 0; i < 100000; ++i) s.update(i % 10 == 0 ? 7 : 1000 + i);
+    EXPECT_GE(s.estimate(7), 10000u);
+    EXPECT_LT(s.estimate(1005), s.total() / 100);
+    s.update(7, 5);
+    EXPECT_GE(s.estimate(7), 10005u);
+}
+
+TEST(CountMinSketch, ConcurrentMergeEqualsSingleSketch) {
+    constexpr std::size_t threads = 4;
+    const auto keys = skewed_stream();
+    count_min_sketch<256, 3> shared, reference;
+    for (std::size_t t = 0; t < threads; ++t) reference.update(keys.data(), keys.size());
+
+    std::vector<std::thread> pool;
+    for (std::size_t t = 0; t < threads; ++t) {
+        pool.emplace_back([&] {
+            count_min_sketch<256, 3> mine;
+            mine.update(keys.data(), keys.size());
+            shared.merge(mine);
+        });
+    }
+    for (auto& th : pool) th.join();
+
+    EXPECT_EQ(shared.total(), reference.total());
+    for (std::uint64_t k = 1; k <= 1000; ++k) ASSERT_EQ(shared.estimate(k), reference.estimate(k)) << k;
+    shared.clear();
+    EXPECT_EQ(shared.total(), 0u);
+    EXPECT_EQ(shared.estimate(1), 0u);
+}
+
+TEST(CountSketch, MedianEstimateIsCloseForFrequentKeys) {
+    const auto keys = skewed_stream();
+    count_sketch<512, 5> s;
+    s.update(keys.data(), keys.size());
+    for (std::uint64_t k = 1; k <= 10; ++k) {
+        const std::int32_t truth = static_cast<std::int32_t>(1000 / k);
+        EXPECT_NEAR(s.estimate(k), truth, 30) << k;
+    }
+    EXPECT_NEAR(s.estimate(999999), 0, 30);
+}
+
+TEST(CountSketch, MergeAddsStreams) {
+    count_sketch<128, 5> a, b;
+    a.update(42, 100);
+    b.update(42, 50);
+    b.update(43, 7);
+    a.merge(b);
+    EXPECT_EQ(a.estimate(42), 150);
+    EXPECT_EQ(a.estimate(43), 7);
+    EXPECT_EQ(a.total(), 157u);
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <etools/hashing/hyperloglog.hpp>
+
+using namespace etools::hashing;
+
+namespace {
+
+// Within 4 standard errors of the true count.
+void expect_close(double estimate, double truth, std::size_t registers) {
+    const double sigma = 1.04 / std::sqrt(static_cast<double>(registers));
+    EXPECT_NEAR(estimate, truth, 4.0 * sigma * truth) << "truth " << truth;
+}
+
+} // namespace
+
+TEST(HyperLogLog, EmptyEstimatesZero) {
+    hyperloglog<> h;
+    EXPECT_EQ(h.estimate(), 0.0);
+    EXPECT_EQ(sizeof(h), hyperloglog<>::registers);
+}
+
+TEST(HyperLogLog, EstimatesDistinctCountAcrossRanges) {
+    for (std::size_t n : {10u, 1000u, 50000u, 1000000u}) {
+        auto h = std::make_unique<hyperloglog<12>>();
+        for (std::uint64_t i = 0; i < n; ++i) h->update(i);
+        for (std::uint64_t i = 0; i < n; ++i) h->update(i); // duplicates change nothing
+        expect_close(h->estimate(), static_cast<double>(n), hyperloglog<12>::registers);
+    }
+}
+
+TEST(HyperLogLog, MergeEstimatesUnionAndMatchesDirectUpdate) {
+    std::vector<std::uint64_t> a(30000), b(30000);
+    for (std::size_t i = 0; i < a.size(); ++i) { a[i] = i; b[i] = i + 20000; } // 50000 distinct
+    hyperloglog<10> ha, hb, both;
+    ha.update(a.data(), a.size());
+    hb.update(b.data(), b.size());
+    both.update(a.data(), a.size());
+    both.update(b.data(), b.size());
+
+    ha.merge(hb);
+    for (std::size_t i = 0; i < hyperloglog<10>::registers; ++i) ASSERT_EQ(ha.reg(i), both.reg(i)) << i;
+    expect_close(ha.estimate(), 50000.0, hyperloglog<10>::registers);
+}
+
+TEST(HyperLogLog, ConcurrentUpdatesAndMergesLoseNothing) {
+    constexpr std::size_t threads = 4, per_thread = 100000;
+    hyperloglog<12> shared, reference;
+    for (std::uint64_t i = 0; i < threads * per_thread; ++i) reference.update(i);
+
+    std::vector<std::thread> pool;
+    for (std::size_t t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t] {
+            hyperloglog<12> mine;
+            for (std::uint64_t i = 0; i < per_thread; ++i) {
+                const std::uint64_t k = t * per_thread + i;
+                if (i % 2) shared.update(k); else mine.update(k);
+            }
+            shared.merge(mine);
+        });
+    }
+    for (auto& th : pool) th.join();
+
+    for (std::size_t i = 0; i < hyperloglog<12>::registers; ++i) ASSERT_EQ(shared.reg(i), reference.reg(i)) << i;
+}
+
+TEST(HyperLogLog, ClearResets) {
+    hyperloglog<4> h;
+    for (std::uint64_t i = 0; i < 100; ++i) h.update(i);
+    EXPECT_GT(h.estimate(), 0.0);
+    h.clear();
+    EXPECT_EQ(h.estimate(), 0.0);
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+#include <etools/hashing/fks.hpp>
+#include <etools/hashing/key_provider.hpp>
+#include <etools/hashing/llut.hpp>
+#include <etools/hashing/optimal_mph.hpp>
+
+using namespace etools::hashing;
+
+namespace {
+
+struct opcodes {
+    static constexpr std::array<std::uint32_t, 5> keys{{0x10, 0x2A, 0x7F, 0x1000, 0xDEADBEEF}};
+};
+
+struct small_ids {
+    static constexpr std::array<std::uint8_t, 3> keys{{2, 5, 7}};
+};
+
+// A set far larger than is practical as an NTTP pack: 2000 sparse 32-bit keys.
+constexpr std::size_t big_count = 2000;
+
+constexpr std::uint32_t big_key(std::size_t i) {
+    return static_cast<std::uint32_t>(i * 2654435761u) ^ 0x5A5A5A5Au;
+}
+
+struct big_set {
+    static constexpr std::array<std::uint32_t, big_count> keys = [] {
+        std::array<std::uint32_t, big_count> k{};
+        for (std::size_t i = 0; i < big_count; ++i) k[i] = big_key(i);
+        return k;
+    }();
+};
+
+struct not_a_provider {
+    static constexpr int keys = 3;
+};
+
+} // namespace
+
+static_assert(is_key_provider_v<opcodes, std::uint32_t>);
+static_assert(is_key_provider_v<key_pack<std::uint16_t, 1, 2>, std::uint16_t>);
+static_assert(!is_key_provider_v<opcodes, std::uint16_t>);
+static_assert(!is_key_provider_v<not_a_provider, std::uint32_t>);
+static_assert(!is_key_provider_v<int, std::uint32_t>);
+
+// fks: same indices as the pack overload, but a distinct singleton keyed by the provider.
+constexpr const auto& F = fks<std::uint32_t>::instance<opcodes>();
+static_assert(F.size() == 5);
+static_assert(F(0x10) == 0 && F(0x7F) == 2 && F(0xDEADBEEF) == 4);
+static_assert(F(0x11) == F.not_found());
+static_assert(F.capacity() == fks<std::uint32_t>::instance<0x10, 0x2A, 0x7F, 0x1000, 0xDEADBEEF>().capacity());
+
+// llut
+constexpr const auto& L = llut<std::uint8_t>::instance<small_ids>();
+static_assert(L.size() == 3 && L.capacity() == 8);
+static_assert(L(2) == 0 && L(5) == 1 && L(7) == 2 && L(3) == L.not_found() && L(200) == L.not_found());
+
+// The pack overloads are the provider overloads over key_pack.
+static_assert(&llut<std::uint8_t>::instance<2, 5, 7>() == &llut<std::uint8_t>::instance<key_pack<std::uint8_t, 2, 5, 7>>());
+static_assert(&fks<std::uint8_t>::instance<2, 5, 7>() == &fks<std::uint8_t>::instance<key_pack<std::uint8_t, 2, 5, 7>>());
+
+// optimal_mph picks the same backend either way.
+static_assert(&optimal_mph<std::uint8_t>::instance<small_ids>() == &llut<std::uint8_t>::instance<small_ids>());
+static_assert(&optimal_mph<std::uint32_t>::instance<opcodes>() == &fks<std::uint32_t>::instance<opcodes>());
+
+TEST(KeyProvider, LargeProviderTableIndexesEveryKey) {
+    const auto& H = optimal_mph<std::uint32_t>::instance<big_set>();
+    ASSERT_EQ(H.size(), big_count);
+    for (std::size_t i = 0; i < big_count; ++i) ASSERT_EQ(H(big_key(i)), i) << i;
+    std::size_t misses = 0;
+    for (std::uint32_t k = 0; k < 10000; ++k) misses += H(k) == H.not_found();
+    EXPECT_GE(misses, 10000u - big_count);
+}
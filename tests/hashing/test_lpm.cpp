@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <etools/hashing/lpm.hpp>
+
+using namespace etools::hashing;
+
+namespace {
+
+using route32 = lpm_route<std::uint32_t>;
+
+constexpr auto fib = make_lpm_table(std::array<route32, 6>{{
+    {0x00000000u, 0},    // 0: default
+    {0x0A000000u, 8},    // 1: 10.0.0.0/8
+    {0x0A010000u, 16},   // 2: 10.1.0.0/16
+    {0x0A010200u, 24},   // 3: 10.1.2.0/24
+    {0xC0A80001u, 32},   // 4: 192.168.0.1/32
+    {0x0AFFFFFFu, 8},    // 5: same prefix as route 1 once masked: ignored
+}});
+
+// Brute force: longest matching route, first one on ties.
+template <typename Key>
+std::size_t reference(const std::vector<lpm_route<Key>>& routes, Key key, std::size_t not_found) {
+    constexpr int bits = std::numeric_limits<Key>::digits;
+    std::size_t best = not_found;
+    int best_len = -1;
+    for (std::size_t i = 0; i < routes.size(); ++i) {
+        const int len = routes[i].length;
+        const Key mask = len == 0 ? Key{0} : static_cast<Key>(~std::uintmax_t{0} << (bits - len));
+        if ((key & mask) == (routes[i].prefix & mask) && len > best_len) { best = i; best_len = len; }
+    }
+    return best;
+}
+
+} // namespace
+
+static_assert(fib.size() == 5);
+static_assert(fib.lengths() == 5);
+static_assert(fib(0x0A010203u) == 3);
+static_assert(fib(0x0A0102FFu) == 3);
+static_assert(fib(0x0A010303u) == 2);
+static_assert(fib(0x0A020304u) == 1);
+static_assert(fib(0xC0A80001u) == 4);
+static_assert(fib(0xC0A80002u) == 0);
+static_assert(fib(0x0B000000u) == 0);
+
+// Without a default route, a marker with no best matching prefix must still miss.
+constexpr auto sparse = make_lpm_table(std::array<lpm_route<std::uint8_t>, 3>{{
+    {0b00000000u, 2},
+    {0b01000000u, 5},
+    {0b10110011u, 8},   // leaves a marker 10110/5 with no best matching prefix
+}});
+static_assert(sparse.entries() == 4);
+static_assert(sparse(0b10110011u) == 2);
+static_assert(sparse(0b10110010u) == sparse.not_found());
+static_assert(sparse(0b01000111u) == 1);
+static_assert(sparse(0b00110011u) == 0);
+
+TEST(Lpm, RandomRoutesMatchBruteForce) {
+    std::vector<route32> routes;
+    std::uint64_t x = 0x9E3779B97F4A7C15ull;
+    const auto next = [&x] { x = x * 6364136223846793005ull + 1442695040888963407ull; return x >> 16; };
+    // Nested prefixes under a few roots, so searches cross many markers.
+    const std::uint32_t roots[] = {0x0A000000u, 0xAC100000u, 0xC0A80000u, 0x64400000u};
+    for (std::size_t i = 0; i < 3000; ++i) {
+        const auto len = static_cast<std::uint8_t>(next() % 33);
+        const auto bits = static_cast<std::uint32_t>(next());
+        const std::uint32_t prefix = (i % 2) ? (roots[i % 4] ^ (bits >> 12)) : bits;
+        routes.push_back({prefix, len});
+    }
+    auto table = std::make_unique<lpm_table<std::uint32_t, 3000>>(routes.data(), routes.size());
+    EXPECT_EQ(table->lengths(), 33u);
+    EXPECT_GE(table->entries(), table->size());
+
+    for (std::size_t q = 0; q < 20000; ++q) {
+        std::uint32_t key = static_cast<std::uint32_t>(next());
+        if (q % 2) key = routes[q % routes.size()].prefix ^ static_cast<std::uint32_t>(next() >> (20 + q % 12));
+        ASSERT_EQ((*table)(key), reference(routes, key, table->not_found())) << std::hex << key;
+    }
+}
+
+TEST(Lpm, SixtyFourBitKeys) {
+    std::vector<lpm_route<std::uint64_t>> routes;
+    std::uint64_t x = 12345;
+    const auto next = [&x] { x = x * 6364136223846793005ull + 1442695040888963407ull; return x; };
+    const std::uint64_t base = 0x20010DB800000000ull;   // 2001:db8::/32
+    for (std::size_t i = 0; i < 500; ++i)
+        routes.push_back({base | (next() >> 32), static_cast<std::uint8_t>(32 + next() % 33)});
+    routes.push_back({base, 32});
+    const auto table = std::make_unique<lpm_table<std::uint64_t, 501>>(routes.data(), routes.size());
+    for (std::size_t q = 0; q < 5000; ++q) {
+        const std::uint64_t key = (q % 3) ? routes[q % routes.size()].prefix ^ (next() >> (q % 64)) : next();
+        ASSERT_EQ((*table)(key), reference(routes, key, table->not_found())) << std::hex << key;
+    }
+}
+
+TEST(Lpm, EmptyTableAndDefaultRoute) {
+    const lpm_table<std::uint32_t, 4> empty{nullptr, 0};
+    EXPECT_EQ(empty.size(), 0u);
+    EXPECT_EQ(empty(0x0A000001u), empty.not_found());
+
+    const std::array<route32, 1> all{{{0, 0}}};
+    const lpm_table<std::uint32_t, 1> any{all};
+    EXPECT_EQ(any(0u), 0u);
+    EXPECT_EQ(any(0xFFFFFFFFu), 0u);
+}
+
+TEST(Lpm, ZeroPrefixAtAPopulatedLevel) {
+    // 0.0.0.0/8 next to 1.0.0.0/8 ... : a zero prefix must not be pinned to a slot another bucket owns.
+    for (std::uint32_t k : {24u, 32u, 50u, 60u}) {
+        std::vector<route32> routes;
+        for (std::uint32_t i = 0; i <= k; ++i) routes.push_back({i << 24, 8});
+        const auto table = std::make_unique<lpm_table<std::uint32_t, 61>>(routes.data(), routes.size());
+        for (std::uint32_t i = 0; i <= k; ++i) ASSERT_EQ((*table)((i << 24) | 0x123u), i) << k;
+        EXPECT_EQ((*table)(0xFF000000u), table->not_found());
+    }
+
+    // Levels {2, 4, 16}: a lookup for 10.1.x.x/16 turns off at /4, so it needs the marker 0/4,
+    // which shares the level with the routes 1/4 ... 15/4.
+    std::vector<route32> routes{{0x40000000u, 2}};
+    for (std::uint32_t i = 1; i < 16; ++i) routes.push_back({i << 28, 4});
+    for (std::uint32_t i = 0; i < 16; ++i) routes.push_back({0x0A010000u | (i << 8), 16});
+    routes.push_back({0x0A100000u, 16});
+    const auto table = std::make_unique<lpm_table<std::uint32_t, 64>>(routes.data(), routes.size());
+    for (std::uint32_t key : {0x0A010001u, 0x0A100203u, 0x0B000000u, 0x1A000000u, 0x45000000u, 0x00000000u})
+        ASSERT_EQ((*table)(key), reference(routes, key, table->not_found())) << std::hex << key;
+}
+
+TEST(Lpm, DenseSixteenBitRoutes) {
+    // Short keys and lengths hit prefix 0 at almost every level.
+    std::vector<lpm_route<std::uint16_t>> routes;
+    std::uint64_t x = 777;
+    const auto next = [&x] { x = x * 6364136223846793005ull + 1442695040888963407ull; return x >> 24; };
+    for (std::size_t i = 0; i < 400; ++i)
+        routes.push_back({static_cast<std::uint16_t>(next()), static_cast<std::uint8_t>(next() % 17)});
+    const auto table = std::make_unique<lpm_table<std::uint16_t, 400>>(routes.data(), routes.size());
+    for (std::uint32_t key = 0; key <= 0xFFFFu; ++key)
+        ASSERT_EQ((*table)(static_cast<std::uint16_t>(key)),
+                  reference(routes, static_cast<std::uint16_t>(key), table->not_found())) << key;
+}
+
+constexpr auto zero_heavy = make_lpm_table(std::array<route32, 5>{{
+    {0x00000000u, 8}, {0x01000000u, 8}, {0x02000000u, 8}, {0x03000000u, 8}, {0x00000000u, 0},
+}});
+static_assert(zero_heavy(0x00FFFFFFu) == 0);
+static_assert(zero_heavy(0x03000001u) == 3);
+static_assert(zero_heavy(0x04000000u) == 4);
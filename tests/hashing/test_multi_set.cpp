@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include <etools/hashing/multi_set.hpp>
+
+using namespace etools::hashing;
+
+namespace {
+
+using M = multi_set<std::uint16_t>;
+
+constexpr const auto& ports = M::instance<M::set<22, 80, 443>,     // tcp
+                                         M::set<53, 123, 443>,     // udp
+                                         M::set<>,                 // empty
+                                         M::set<80, 80, 8080>>();  // duplicates collapse
+
+struct even_keys {
+    static constexpr std::array<std::uint16_t, 4> keys{{0, 2, 4, 6}};
+};
+
+} // namespace
+
+static_assert(ports.sets() == 4);
+static_assert(ports.size() == 6);
+static_assert(ports(443) == 0b0011);
+static_assert(ports(80) == 0b1001);
+static_assert(ports(8080) == 0b1000);
+static_assert(ports(53) == 0b0010);
+static_assert(ports(0) == 0 && ports(81) == 0 && ports(65535) == 0);
+static_assert(ports.contains(1, 123) && !ports.contains(0, 123) && !ports.contains(7, 123));
+static_assert(std::is_same_v<std::decay_t<decltype(ports(0))>, std::uint8_t>);
+static_assert(&ports == &M::instance<M::set<22, 80, 443>, M::set<53, 123, 443>, M::set<>, M::set<80, 80, 8080>>());
+
+// Any type with `static constexpr std::array keys` is a set; key 0 is a regular key.
+static_assert(M::instance<even_keys, M::set<0, 1>>()(0) == 0b11);
+static_assert(M::instance<even_keys, M::set<0, 1>>()(1) == 0b10);
+
+TEST(MultiSet, RuntimeBuildMatchesSeparateSets) {
+    constexpr std::size_t sets = 12;
+    std::vector<std::uint32_t> data[sets];
+    std::set<std::uint32_t> truth[sets];
+    std::uint64_t x = 0x9E3779B97F4A7C15ull;
+    for (std::size_t s = 0; s < sets; ++s) {
+        for (std::size_t i = 0; i < 200 + 30 * s; ++i) {
+            x = x * 6364136223846793005ull + 1442695040888963407ull;
+            const auto k = static_cast<std::uint32_t>(x >> 40) % 5000; // heavy overlap between sets
+            data[s].push_back(k);
+            truth[s].insert(k);
+        }
+    }
+    std::array<key_span<std::uint32_t>, sets> spans{};
+    for (std::size_t s = 0; s < sets; ++s) spans[s] = {data[s].data(), data[s].size()};
+
+    auto table = std::make_unique<multi_set_table<std::uint32_t, 5000, sets>>(spans);
+    static_assert(std::is_same_v<multi_set_table<std::uint32_t, 5000, sets>::mask_type, std::uint16_t>);
+
+    std::set<std::uint32_t> all;
+    for (const auto& t : truth) all.insert(t.begin(), t.end());
+    EXPECT_EQ(table->size(), all.size());
+
+    for (std::uint32_t k = 0; k < 6000; ++k) {
+        std::uint16_t expected = 0;
+        for (std::size_t s = 0; s < sets; ++s) if (truth[s].count(k)) expected |= std::uint16_t(1u << s);
+        ASSERT_EQ((*table)(k), expected) << k;
+    }
+}
+
+TEST(MultiSet, SixtyFourSetsUseAWideMask) {
+    std::array<std::uint64_t, 64> keys{};
+    std::array<key_span<std::uint64_t>, 64> spans{};
+    for (std::size_t s = 0; s < 64; ++s) {
+        keys[s] = ~std::uint64_t{0} - s % 4;   // only four distinct keys
+        spans[s] = {&keys[s], 1};
+    }
+    const multi_set_table<std::uint64_t, 64, 64> table{spans};
+    EXPECT_EQ(table.size(), 4u);
+    EXPECT_EQ(table(~std::uint64_t{0}), 0x1111111111111111ull);
+    EXPECT_EQ(table(~std::uint64_t{0} - 3), 0x8888888888888888ull);
+    EXPECT_TRUE(table.contains(63, ~std::uint64_t{0} - 3));
+    EXPECT_EQ(table(0), 0u);
+}
+
+TEST(MultiSet, EmptyTableFindsNothing) {
+    const multi_set_table<std::uint32_t, 0, 2> table{{}};
+    EXPECT_EQ(table.size(), 0u);
+    EXPECT_EQ(table(0), 0u);
+    EXPECT_EQ(table(12345), 0u);
+}
+
+TEST(MultiSet, KeyZeroAmongManyKeys) {
+    // Key 0 mixes to 0; it must not be pinned to a slot another bucket already owns.
+    for (std::uint32_t n : {40u, 51u}) {
+        std::vector<std::uint32_t> keys;
+        for (std::uint32_t k = 0; k < n; ++k) keys.push_back(k * 7);
+        const std::array<key_span<std::uint32_t>, 2> spans{{{keys.data(), keys.size()}, {keys.data(), 1}}};
+        const multi_set_table<std::uint32_t, 64, 2> table{spans};
+        EXPECT_EQ(table.size(), n);
+        EXPECT_EQ(table(0), 0b11u);
+        for (std::uint32_t k = 1; k < n; ++k) ASSERT_EQ(table(k * 7), 0b01u) << k;
+        EXPECT_EQ(table(1), 0u);
+    }
+}
+
+constexpr const auto& with_zero = M::instance<M::set<0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                                                     16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29>>();
+static_assert(with_zero(0) == 1 && with_zero(29) == 1 && with_zero(30) == 0);
@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
 #include <etools/memory/buffer.hpp>
 #include <eser/flat/serializer.hpp>
+#include <array>
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <tuple>
 #include <utility>
 
 struct Message {
@@ -296,4 +300,101 @@ TEST(BufferTest, PackUnpack_HeterogeneousTypes_PreservesValues) {
     EXPECT_EQ(i, -7);
     EXPECT_DOUBLE_EQ(d, 2.71828);
     EXPECT_EQ(c, 'Q');
-}
\ No newline at end of file
+}
+// --- Field-wise codec (types opting into fields()) --------------------------
+
+struct Padded {
+    std::uint32_t id;
+    std::uint8_t flags;     // followed by padding
+    std::uint64_t stamp;
+    static constexpr bool wire_fields = true;
+    auto fields()       { return std::tie(id, flags, stamp); }
+    auto fields() const { return std::tie(id, flags, stamp); }
+};
+static_assert(sizeof(Padded) > sizeof(std::uint32_t) + sizeof(std::uint8_t) + sizeof(std::uint64_t));
+
+TEST(BufferTest, Fields_PackedWithoutPaddingAndRoundTrip) {
+    etools::memory::buffer b{std::make_unique<std::byte[]>(64), 64};
+    const Padded in{7, 3, 123456789ull};
+    std::size_t n = b.pack(in, int{-5});
+    EXPECT_EQ(n, sizeof(std::uint32_t) + sizeof(std::uint8_t) + sizeof(std::uint64_t) + sizeof(int));
+
+    auto out = b.unpack<Padded, int>();
+    ASSERT_TRUE(out.has_value());
+    EXPECT_EQ(std::get<0>(*out).id, 7u);
+    EXPECT_EQ(std::get<0>(*out).flags, 3u);
+    EXPECT_EQ(std::get<0>(*out).stamp, 123456789ull);
+    EXPECT_EQ(std::get<1>(*out), -5);
+}
+
+// A fields() method alone does not change the wire format, and a by-value tuple is no probe match.
+struct ValueFields {
+    int a, b;
+    std::tuple<int, int> fields() const { return {a, b}; }
+};
+
+TEST(BufferTest, Fields_WithoutMarkerPackTheObject) {
+    etools::memory::buffer b{std::make_unique<std::byte[]>(64), 64};
+    EXPECT_EQ(b.pack(ValueFields{3, 4}), sizeof(ValueFields));
+    auto out = b.unpack<ValueFields>();
+    ASSERT_TRUE(out.has_value());
+    EXPECT_EQ(std::get<0>(*out).a, 3);
+    EXPECT_EQ(std::get<0>(*out).b, 4);
+}
+
+TEST(BufferTest, Fields_TooShortYieldsNullopt) {
+    etools::memory::buffer b{std::make_unique<std::byte[]>(64), 64};
+    b.pack(std::uint32_t{1});
+    EXPECT_FALSE(b.unpack<Padded>().has_value());
+}
+
+// --- Compact wire mode -------------------------------------------------------
+
+enum class Kind : std::uint16_t { idle = 0, busy = 300 };
+
+TEST(BufferTest, Compact_SmallValuesShrinkAndRoundTrip) {
+    using etools::memory::compact;
+    etools::memory::buffer b{std::make_unique<std::byte[]>(128), 128};
+    const Padded p{7, 3, 1ull << 40};
+    const std::array<std::int32_t, 5> deltas{0, -1, 1, -300, 70000};
+    const std::size_t n = b.pack(compact, std::uint32_t{5}, std::int64_t{-2}, true, false, true,
+                                 Kind::busy, 2.5, p, deltas);
+    // bitmap 1, varints 1 + 1 + 2, double 8, Padded 1 + 1 + 6, array 2 control + 1 + 1 + 1 + 2 + 3
+    EXPECT_EQ(n, 1u + 4u + 8u + 8u + 10u);
+    EXPECT_LT(n, b.pack(std::uint32_t{5}, std::int64_t{-2}, true, false, true, Kind::busy, 2.5, p, deltas));
+    b.pack(compact, std::uint32_t{5}, std::int64_t{-2}, true, false, true, Kind::busy, 2.5, p, deltas);
+
+    auto out = b.unpack<std::uint32_t, std::int64_t, bool, bool, bool, Kind, double, Padded,
+                        std::array<std::int32_t, 5>>(compact);
+    ASSERT_TRUE(out.has_value());
+    EXPECT_EQ(std::get<0>(*out), 5u);
+    EXPECT_EQ(std::get<1>(*out), -2);
+    EXPECT_TRUE(std::get<2>(*out));
+    EXPECT_FALSE(std::get<3>(*out));
+    EXPECT_TRUE(std::get<4>(*out));
+    EXPECT_EQ(std::get<5>(*out), Kind::busy);
+    EXPECT_DOUBLE_EQ(std::get<6>(*out), 2.5);
+    EXPECT_EQ(std::get<7>(*out).stamp, 1ull << 40);
+    EXPECT_EQ(std::get<8>(*out), deltas);
+}
+
+TEST(BufferTest, Compact_ExtremesShortAndOutOfRangeInput) {
+    using etools::memory::compact;
+    etools::memory::buffer b{std::make_unique<std::byte[]>(64), 64};
+    b.pack(compact, std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::uint64_t>::max(),
+           std::numeric_limits<std::int16_t>::min());
+    auto out = b.unpack<std::int64_t, std::uint64_t, std::int16_t>(compact);
+    ASSERT_TRUE(out.has_value());
+    EXPECT_EQ(std::get<0>(*out), std::numeric_limits<std::int64_t>::min());
+    EXPECT_EQ(std::get<1>(*out), std::numeric_limits<std::uint64_t>::max());
+    EXPECT_EQ(std::get<2>(*out), std::numeric_limits<std::int16_t>::min());
+
+    b.pack(compact, std::uint32_t{70000});
+    EXPECT_FALSE(b.unpack<std::uint16_t>(compact).has_value());     // does not fit the type
+    EXPECT_FALSE((b.unpack<std::uint32_t, std::uint32_t>(compact).has_value()));
+
+    etools::memory::buffer tiny{std::make_unique<std::byte[]>(2), 2};
+    EXPECT_EQ(tiny.pack(compact, std::uint32_t{1u << 20}), 0u);
+    EXPECT_EQ(tiny.size(), 0u);
+    EXPECT_EQ(tiny.pack(compact, std::uint32_t{100}, true), 2u);
+}
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 #include <eser/flat/serializer.hpp>
+#include <etools/memory/buffer.hpp>
 #include <etools/memory/buffer_view.hpp>
+#include <cstdint>
+#include <memory>
 #include <type_traits>
 struct Message {
     int id;
@@ -174,4 +177,19 @@ TEST(BufferViewCompile, DataReturnsConstByteStar) {
         decltype(std::declval<const etools::memory::buffer_view&>().data()),
         const std::byte*>,
         "data() must return const std::byte*");
-}
\ No newline at end of file
+}
+TEST(BufferViewTest, UnpackCompact_ReadsWhatBufferPacked) {
+    etools::memory::buffer b{std::make_unique<std::byte[]>(64), 64};
+    const std::size_t n = b.pack(etools::memory::compact, std::int32_t{-64}, true, std::uint64_t{1} << 35);
+    EXPECT_EQ(n, 1u + 1u + 6u);
+
+    etools::memory::buffer_view view(b.data(), b.size());
+    auto out = view.unpack<std::int32_t, bool, std::uint64_t>(etools::memory::compact);
+    ASSERT_TRUE(out.has_value());
+    EXPECT_EQ(std::get<0>(*out), -64);
+    EXPECT_TRUE(std::get<1>(*out));
+    EXPECT_EQ(std::get<2>(*out), std::uint64_t{1} << 35);
+
+    etools::memory::buffer_view cut(b.data(), b.size() - 1);
+    EXPECT_FALSE((cut.unpack<std::int32_t, bool, std::uint64_t>(etools::memory::compact).has_value()));
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <etools/memory/lazy_slot.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace etools::memory;
+
+namespace {
+
+struct Counted {
+    static inline int constructed = 0;
+    static inline int destroyed = 0;
+    int value;
+    explicit Counted(int v) : value(v) { ++constructed; }
+    ~Counted() { ++destroyed; }
+};
+
+struct Pinned {
+    int value;
+    explicit Pinned(int v) : value(v) {}
+    Pinned(const Pinned&) = delete;
+    Pinned(Pinned&&) = delete;
+};
+
+Pinned make_pinned() { return Pinned{17}; }
+
+// Static-initialisation order: `early` is dynamically initialised before the
+// line that defines `late_slot`, and uses it. Constant initialisation of the
+// slot means it is already a valid empty slot, and is not reset afterwards.
+extern lazy_slot<std::string> late_slot;
+struct Early {
+    const std::string* seen;
+    Early() : seen(&late_slot.get_or_emplace("built during static init")) {}
+} early;
+lazy_slot<std::string> late_slot;
+
+} // namespace
+
+static_assert(!std::is_copy_constructible_v<lazy_slot<int>>);
+static_assert(!std::is_move_constructible_v<lazy_slot<int>>);
+static_assert(std::is_nothrow_default_constructible_v<lazy_slot<std::string>>);
+static_assert(noexcept(std::declval<lazy_slot<int>&>().get_or_emplace(1)));
+static_assert(!noexcept(std::declval<lazy_slot<std::string>&>().get_or_emplace("x")));
+
+TEST(LazySlot, ConstantInitialisedBeforeDynamicInitialisers) {
+    ASSERT_TRUE(late_slot.has_value());
+    EXPECT_EQ(&*late_slot, early.seen);
+    EXPECT_EQ(*late_slot, "built during static init");
+}
+
+TEST(LazySlot, ConstructsOnceOnFirstAccessAndDestroysWithTheSlot) {
+    Counted::constructed = Counted::destroyed = 0;
+    {
+        lazy_slot<Counted> s;
+        EXPECT_FALSE(s.has_value());
+        EXPECT_FALSE(static_cast<bool>(s));
+        EXPECT_EQ(Counted::constructed, 0);
+
+        Counted& a = s.get_or_emplace(1);
+        Counted& b = s.get_or_emplace(2);                 // arguments ignored once built
+        EXPECT_EQ(&a, &b);
+        EXPECT_EQ(b.value, 1);
+        EXPECT_EQ(s->value, 1);
+        EXPECT_TRUE(s);
+        EXPECT_EQ(Counted::constructed, 1);
+
+        int calls = 0;
+        s.get_or_init([&] { ++calls; return Counted{3}; });
+        EXPECT_EQ(calls, 0);                              // the builder runs only when building
+    }
+    EXPECT_EQ(Counted::destroyed, 1);
+
+    lazy_slot<Counted> never;
+    (void)never;
+    EXPECT_EQ(Counted::constructed, 1);
+}
+
+TEST(LazySlot, GetOrInitConstructsInPlace) {
+    lazy_slot<Pinned> s;
+    EXPECT_EQ(s.get_or_init(make_pinned).value, 17);
+    const auto& cs = s;
+    EXPECT_EQ((*cs).value, 17);
+    EXPECT_EQ(cs->value, 17);
+}
+
+TEST(LazySlot, ThrowingConstructorLeavesTheSlotEmptyForARetry) {
+    lazy_slot<std::string> s;
+    EXPECT_THROW(s.get_or_init([]() -> std::string { throw std::runtime_error("no config yet"); }), std::runtime_error);
+    EXPECT_FALSE(s.has_value());
+    EXPECT_EQ(s.get_or_emplace(3, 'z'), "zzz");
+}
+
+TEST(LazySlot, ConcurrentFirstAccessBuildsExactlyOnce) {
+    for (int round = 0; round < 20; ++round) {
+        lazy_slot<std::vector<int>> s;
+        std::atomic<int> builds{0};
+        std::atomic<bool> go{false};
+        std::vector<const std::vector<int>*> seen(8);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < seen.size(); ++t) {
+            threads.emplace_back([&, t] {
+                while (!go.load()) std::this_thread::yield();
+                const auto& v = s.get_or_init([&] {
+                    builds.fetch_add(1);
+                    std::this_thread::sleep_for(std::chrono::microseconds(200));
+                    return std::vector<int>(1000, 7);
+                });
+                // Every thread sees the finished object, never a partly built one.
+                if (v.size() == 1000 && v.back() == 7) seen[t] = &v;
+            });
+        }
+        go.store(true);
+        for (auto& th : threads) th.join();
+        EXPECT_EQ(builds.load(), 1);
+        for (const auto* p : seen) EXPECT_EQ(p, &*s);
+    }
+}
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+#include <etools/memory/lz.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace etools::memory;
+
+namespace {
+
+std::vector<std::byte> bytes_of(const std::string& s) {
+    std::vector<std::byte> v(s.size());
+    std::memcpy(v.data(), s.data(), s.size());
+    return v;
+}
+
+// Packed telemetry-like records: repetitive layout, slowly changing fields.
+std::vector<std::byte> record_batch(std::size_t records, std::uint64_t seed) {
+    std::vector<std::byte> out;
+    buffer rec{std::make_unique<std::byte[]>(64), 64};
+    std::uint64_t ts = 1'700'000'000'000'000'000ull;
+    for (std::size_t i = 0; i < records; ++i) {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        ts += 1000 + (seed >> 60);
+        rec.pack(ts, static_cast<std::uint32_t>(seed >> 61), static_cast<std::uint16_t>(7), 21.5 + double(seed >> 62));
+        out.insert(out.end(), rec.data(), rec.data() + rec.size());
+    }
+    return out;
+}
+
+std::vector<std::byte> round_trip(const std::vector<std::byte>& in, lz_table table) {
+    std::vector<std::byte> packed(lz_compress_bound(in.size()));
+    const std::size_t n = lz_compress(in.data(), in.size(), packed.data(), packed.size(), table);
+    EXPECT_GT(n, 0u);
+    std::vector<std::byte> out(in.size() + 16);
+    const auto m = lz_decompress(packed.data(), n, out.data(), out.size());
+    EXPECT_TRUE(m.has_value());
+    out.resize(m ? *m : 0);
+    return out;
+}
+
+} // namespace
+
+TEST(Lz, DecodesAHandWrittenLz4Block) {
+    // "abc", match (offset 3, length 12), then the final literals "xyzwv".
+    const std::array<std::uint8_t, 12> block{0x38, 'a', 'b', 'c', 0x03, 0x00, 0x50, 'x', 'y', 'z', 'w', 'v'};
+    std::array<std::byte, 64> out{};
+    const auto n = lz_decompress(reinterpret_cast<const std::byte*>(block.data()), block.size(), out.data(), out.size());
+    ASSERT_TRUE(n.has_value());
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(out.data()), *n), "abcabcabcabcabcxyzwv");
+}
+
+TEST(Lz, RoundTripsEverySmallSizeAndRepetitiveData) {
+    std::array<std::uint32_t, 4096> cells{};
+    for (std::size_t n = 0; n < 64; ++n) {
+        std::vector<std::byte> in(n);
+        for (std::size_t i = 0; i < n; ++i) in[i] = static_cast<std::byte>(i % 3);
+        ASSERT_EQ(round_trip(in, lz_table{cells}), in) << n;
+    }
+
+    const auto batch = record_batch(20000, 1);
+    std::vector<std::byte> packed(lz_compress_bound(batch.size()));
+    const std::size_t n = lz_compress(batch.data(), batch.size(), packed.data(), packed.size(), lz_table{cells});
+    EXPECT_LT(n, batch.size() / 2);
+    EXPECT_EQ(round_trip(batch, lz_table{cells}), batch);
+
+    const auto text = bytes_of(std::string(100000, 'z'));
+    EXPECT_EQ(round_trip(text, lz_table{cells}), text);
+}
+
+TEST(Lz, IncompressibleDataStaysWithinTheBoundAndStaleTablesAreHarmless) {
+    std::array<std::uint32_t, 256> cells;
+    cells.fill(0xFFFFFFF0u);                     // garbage positions must be rejected
+    std::vector<std::byte> noise(50000);
+    std::uint64_t x = 42;
+    for (auto& b : noise) { x = x * 6364136223846793005ull + 1; b = static_cast<std::byte>(x >> 56); }
+    std::vector<std::byte> packed(lz_compress_bound(noise.size()));
+    const std::size_t n = lz_compress(noise.data(), noise.size(), packed.data(), packed.size(), lz_table{cells});
+    EXPECT_GT(n, noise.size());
+    EXPECT_LE(n, lz_compress_bound(noise.size()));
+    EXPECT_EQ(lz_compress(noise.data(), noise.size(), packed.data(), noise.size(), lz_table{cells}), 0u);
+
+    // The same table, now full of positions from `noise`, on a different input.
+    const auto batch = record_batch(500, 9);
+    EXPECT_EQ(round_trip(batch, lz_table{cells}), batch);
+}
+
+TEST(Lz, MalformedBlocksAreRejected) {
+    std::array<std::uint32_t, 1024> cells{};
+    const auto batch = record_batch(200, 3);
+    std::vector<std::byte> packed(lz_compress_bound(batch.size()));
+    const std::size_t n = lz_compress(batch.data(), batch.size(), packed.data(), packed.size(), lz_table{cells});
+    std::vector<std::byte> out(batch.size());
+
+    EXPECT_FALSE(lz_decompress(packed.data(), 0, out.data(), out.size()));
+    EXPECT_FALSE(lz_decompress(packed.data(), n, out.data(), out.size() - 1));     // output too small
+    for (std::size_t cut = 1; cut < n; cut += 7) {                                 // a cut after literals still parses
+        const auto m = lz_decompress(packed.data(), cut, out.data(), out.size());
+        EXPECT_TRUE(!m || *m < batch.size()) << cut;
+    }
+
+    const std::array<std::uint8_t, 4> bad_offset{0x10, 'a', 0x05, 0x00};            // offset beyond output
+    EXPECT_FALSE(lz_decompress(reinterpret_cast<const std::byte*>(bad_offset.data()), 4, out.data(), out.size()));
+
+    std::uint64_t x = 7;                                                             // corruption never overruns
+    for (int trial = 0; trial < 2000; ++trial) {
+        std::vector<std::byte> bad(packed.begin(), packed.begin() + static_cast<std::ptrdiff_t>(n));
+        x = x * 6364136223846793005ull + 1;
+        bad[(x >> 33) % n] ^= static_cast<std::byte>(1u << (x >> 61));
+        (void)lz_decompress(bad.data(), bad.size(), out.data(), out.size());
+    }
+}
+
+TEST(Lz, BufferOverloadsSetTheUsedSize) {
+    std::array<std::uint32_t, 4096> cells{};
+    const auto batch = record_batch(1000, 5);
+    buffer in{std::make_unique<std::byte[]>(batch.size()), batch.size()};
+    std::memcpy(in.mutable_data(), batch.data(), batch.size());
+    in.resize(batch.size());
+
+    buffer packed{std::make_unique<std::byte[]>(lz_compress_bound(batch.size())), lz_compress_bound(batch.size())};
+    const std::size_t n = lz_compress(in, packed, lz_table{cells});
+    EXPECT_EQ(packed.size(), n);
+
+    buffer out{std::make_unique<std::byte[]>(batch.size()), batch.size()};
+    ASSERT_EQ(lz_decompress(buffer_view{packed.data(), packed.size()}, out), batch.size());
+    EXPECT_EQ(out.size(), batch.size());
+    EXPECT_EQ(std::memcmp(out.data(), batch.data(), batch.size()), 0);
+
+    buffer tiny{std::make_unique<std::byte[]>(8), 8};
+    EXPECT_EQ(lz_compress(in, tiny, lz_table{cells}), 0u);
+    EXPECT_EQ(tiny.size(), 0u);
+    EXPECT_FALSE(lz_decompress(packed, tiny));
+    EXPECT_EQ(tiny.size(), 0u);
+}
+
+TEST(LzFrame, RecordsRoundTripAcrossBlocks) {
+    std::array<std::uint32_t, 4096> cells{};
+    constexpr std::size_t block = 4096;
+    std::vector<std::byte> scratch(lz_frame_writer_scratch(block));
+    std::vector<std::byte> frame;
+    lz_frame_writer writer{[&frame](const std::byte* p, std::size_t n) { frame.insert(frame.end(), p, p + n); },
+                           lz_table{cells}, scratch.data(), block};
+
+    std::vector<std::vector<std::byte>> records;
+    std::uint64_t x = 11;
+    for (std::size_t i = 0; i < 3000; ++i) {
+        x = x * 6364136223846793005ull + 1442695040888963407ull;
+        auto rec = (i % 50 == 49) ? std::vector<std::byte>(300) : record_batch(1 + (x >> 62), x);
+        if (i % 50 == 49) for (auto& b : rec) { x = x * 6364136223846793005ull + 1; b = static_cast<std::byte>(x >> 56); }
+        if (i % 97 == 0) rec.clear();                                   // empty records are records too
+        ASSERT_TRUE(writer.write(buffer_view{rec.data(), rec.size()}));
+        records.push_back(std::move(rec));
+    }
+    std::vector<std::byte> too_big(block);
+    EXPECT_FALSE(writer.write(buffer_view{too_big.data(), too_big.size()}));
+    writer.finish();
+    EXPECT_FALSE(writer.write(buffer_view{records[1].data(), records[1].size()}));
+    EXPECT_EQ(writer.bytes_out(), frame.size());
+    EXPECT_LT(frame.size(), writer.bytes_in() / 2);
+
+    std::vector<std::byte> decode(block);
+    lz_frame_reader reader{buffer_view{frame.data(), frame.size()}, decode.data(), decode.size()};
+    EXPECT_EQ(reader.block_size(), block);
+    for (const auto& rec : records) {
+        const auto got = reader.next();
+        ASSERT_TRUE(got.has_value());
+        ASSERT_EQ(got->size(), rec.size());
+        if (!rec.empty()) { ASSERT_EQ(std::memcmp(got->data(), rec.data(), rec.size()), 0); }
+    }
+    EXPECT_FALSE(reader.next().has_value());
+    EXPECT_FALSE(reader.failed());
+}
+
+TEST(LzFrame, TruncatedOrForeignFramesFail) {
+    std::array<std::uint32_t, 1024> cells{};
+    std::vector<std::byte> scratch(lz_frame_writer_scratch(1024));
+    std::vector<std::byte> frame;
+    lz_frame_writer writer{[&frame](const std::byte* p, std::size_t n) { frame.insert(frame.end(), p, p + n); },
+                           lz_table{cells}, scratch.data(), 1024};
+    const auto rec = record_batch(100, 2);
+    for (std::size_t off = 0; off + 64 <= rec.size(); off += 64) writer.write(rec.data() + off, 64);
+    writer.finish();
+
+    std::vector<std::byte> decode(1024);
+    std::size_t complete = 0;
+    for (lz_frame_reader r{buffer_view{frame.data(), frame.size()}, decode.data(), decode.size()}; r.next();) ++complete;
+    EXPECT_EQ(complete, rec.size() / 64);
+
+    lz_frame_reader cut{buffer_view{frame.data(), frame.size() - 5}, decode.data(), decode.size()};
+    while (cut.next()) {}
+    EXPECT_TRUE(cut.failed());
+
+    lz_frame_reader small{buffer_view{frame.data(), frame.size()}, decode.data(), 512};
+    EXPECT_TRUE(small.failed());
+    EXPECT_FALSE(small.next());
+
+    const auto text = bytes_of("not a frame at all");
+    lz_frame_reader foreign{buffer_view{text.data(), text.size()}, decode.data(), decode.size()};
+    EXPECT_TRUE(foreign.failed());
+}
@@ -337,3 +337,84 @@ TEST(SlotCompile, AccessorReturnTypes) {
     static_assert(std::is_same_v<
         slot<SimpleObject>::value_type, SimpleObject>);
 }
+
+// --- Capability fast paths (meta/capabilities.hpp) --------------------------
+
+namespace {
+    struct recyclable {
+        static inline int ctor_calls = 0;
+        static inline int dtor_calls = 0;
+        static inline int reinit_calls = 0;
+        int value;
+        explicit recyclable(int v) noexcept : value(v) { ++ctor_calls; }
+        ~recyclable() { ++dtor_calls; }
+        void reinit(int v) noexcept { value = v; ++reinit_calls; }
+        static void reset_counts() noexcept { ctor_calls = dtor_calls = reinit_calls = 0; }
+    };
+
+    // Owns a heap int; the pointer may be moved bitwise.
+    struct relocatable_box {
+        static constexpr bool relocatable = true;
+        static inline int move_calls = 0;
+        static inline int dtor_calls = 0;
+        std::unique_ptr<int> p;
+        explicit relocatable_box(int v) : p(std::make_unique<int>(v)) {}
+        relocatable_box(relocatable_box&& o) noexcept : p(std::move(o.p)) { ++move_calls; }
+        ~relocatable_box() { ++dtor_calls; }
+    };
+}
+
+TEST(SlotCapabilities, EmplaceOnEngagedSlotUsesReinit) {
+    recyclable::reset_counts();
+    {
+        slot<recyclable> s;
+        s.emplace(1);                       // empty: constructs
+        s.emplace(2);                       // engaged + reinit(int): recycles
+        EXPECT_EQ(s->value, 2);
+        EXPECT_EQ(recyclable::ctor_calls, 1);
+        EXPECT_EQ(recyclable::reinit_calls, 1);
+        EXPECT_EQ(recyclable::dtor_calls, 0);
+    }
+    EXPECT_EQ(recyclable::dtor_calls, 1);
+}
+
+TEST(SlotCapabilities, ReinitNotUsedForOtherArgumentLists) {
+    struct two_ctors : recyclable {
+        using recyclable::recyclable;
+        two_ctors(int a, int b) noexcept : recyclable(a + b) {}
+    };
+    recyclable::reset_counts();
+    slot<two_ctors> s;
+    s.emplace(1);
+    s.emplace(2, 3);                        // no reinit(int, int): destroy + construct
+    EXPECT_EQ(s->value, 5);
+    EXPECT_EQ(recyclable::ctor_calls, 2);
+    EXPECT_EQ(recyclable::dtor_calls, 1);
+    EXPECT_EQ(recyclable::reinit_calls, 0);
+}
+
+TEST(SlotCapabilities, RelocatableMovesBytesWithoutMoveOrDestroy) {
+    static_assert(etools::meta::is_relocatable_v<relocatable_box>);
+    static_assert(std::is_nothrow_move_constructible_v<slot<relocatable_box>>);
+    relocatable_box::move_calls = relocatable_box::dtor_calls = 0;
+    {
+        slot<relocatable_box> a;
+        a.emplace(7);
+        int* raw = a->p.get();
+
+        slot<relocatable_box> b(std::move(a));
+        EXPECT_FALSE(a.has_value());
+        ASSERT_TRUE(b.has_value());
+        EXPECT_EQ(b->p.get(), raw);
+        EXPECT_EQ(*b->p, 7);
+
+        slot<relocatable_box> c;
+        c = std::move(b);
+        EXPECT_FALSE(b.has_value());
+        EXPECT_EQ(*c->p, 7);
+
+        EXPECT_EQ(relocatable_box::move_calls, 0);
+        EXPECT_EQ(relocatable_box::dtor_calls, 0);
+    }
+    EXPECT_EQ(relocatable_box::dtor_calls, 1);  // only the final owner destroys
+}
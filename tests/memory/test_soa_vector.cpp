@@ -0,0 +1,255 @@
+#include <gtest/gtest.h>
+#include <etools/memory/soa_vector.hpp>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using namespace etools;
+using memory::soa_vector;
+
+// Counts live instances so leaks / double destruction show up as a non-zero balance.
+struct Tracked {
+    static int alive;
+    int v;
+    explicit Tracked(int x) noexcept : v(x) { ++alive; }
+    Tracked(Tracked&& o) noexcept : v(o.v) { ++alive; }
+    ~Tracked() { --alive; }
+};
+int Tracked::alive = 0;
+
+// Constructor throws for a negative value; move throws once `move_budget` is spent.
+struct Fragile {
+    static inline int move_budget = 1 << 30;
+    int v;
+    explicit Fragile(int x) : v(x) { if (x < 0) throw std::runtime_error("negative"); }
+    Fragile(Fragile&& o) : v(o.v) { if (move_budget-- <= 0) throw std::runtime_error("move"); }
+};
+
+// Constructor throws for a negative value; moves never throw (usable in growable mode).
+struct Picky {
+    int v;
+    explicit Picky(int x) : v(x) { if (x < 0) throw std::runtime_error("negative"); }
+    Picky(Picky&&) noexcept = default;
+};
+
+class SoaVectorTest : public ::testing::Test {
+protected:
+    void SetUp() override { Tracked::alive = 0; }
+    void TearDown() override { EXPECT_EQ(Tracked::alive, 0); }
+};
+
+using fixed_t   = soa_vector<meta::typelist<float, std::uint32_t, double>, 4>;
+using dynamic_t = soa_vector<meta::typelist<float, std::uint32_t, double>>;
+
+static_assert(std::is_same_v<fixed_t::column_type<1>, std::uint32_t>);
+static_assert(fixed_t::columns == 3);
+static_assert(std::is_same_v<fixed_t::reference, std::tuple<float&, std::uint32_t&, double&>>);
+static_assert(!std::is_copy_constructible_v<fixed_t>);
+static_assert(std::is_nothrow_move_constructible_v<dynamic_t>);
+static_assert(std::is_nothrow_move_constructible_v<fixed_t>);
+static_assert(!std::is_nothrow_move_constructible_v<soa_vector<meta::typelist<Tracked, Fragile>, 4>>);
+static_assert(!std::is_nothrow_move_assignable_v<soa_vector<meta::typelist<Tracked, Fragile>, 4>>);
+// Fixed mode carries only its inline columns and the row count: no capacity, no resource.
+static_assert(std::is_empty_v<memory::details::soa_growth<false>>);
+static_assert(std::is_base_of_v<memory::details::soa_growth<false>, fixed_t>);
+
+// --- Fixed capacity -------------------------------------------------------
+
+TEST_F(SoaVectorTest, Fixed_InitialState) {
+    fixed_t v;
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(v.size(), 0u);
+    EXPECT_EQ(v.capacity(), 4u);
+}
+
+TEST_F(SoaVectorTest, Fixed_EmplaceUntilFull) {
+    fixed_t v;
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(v.emplace_back(float(i), std::uint32_t(i * 10), double(i) / 2));
+    EXPECT_FALSE(v.emplace_back(9.f, 9u, 9.0));
+    EXPECT_EQ(v.size(), 4u);
+    EXPECT_FALSE(v.reserve(5));
+    EXPECT_TRUE(v.reserve(4));
+}
+
+TEST_F(SoaVectorTest, Fixed_ProxyRowReadsAndWrites) {
+    fixed_t v;
+    v.emplace_back(1.5f, 7u, 2.5);
+    auto [x, id, w] = v[0];
+    EXPECT_FLOAT_EQ(x, 1.5f);
+    EXPECT_EQ(id, 7u);
+    EXPECT_DOUBLE_EQ(w, 2.5);
+
+    std::get<1>(v[0]) = 42u;
+    EXPECT_EQ(v.data<1>()[0], 42u);
+    EXPECT_EQ(&std::get<0>(v.front()), &std::get<0>(v.back()));
+}
+
+TEST_F(SoaVectorTest, Fixed_ConstFrontAndBack) {
+    fixed_t v;
+    v.emplace_back(1.f, 2u, 3.0);
+    v.emplace_back(4.f, 5u, 6.0);
+    const fixed_t& c = v;
+    static_assert(std::is_same_v<decltype(c.front()), fixed_t::const_reference>);
+    EXPECT_FLOAT_EQ(std::get<0>(c.front()), 1.f);
+    EXPECT_EQ(std::get<1>(c.back()), 5u);
+    EXPECT_EQ(&std::get<2>(c.back()), &std::get<2>(v.back()));
+}
+
+TEST_F(SoaVectorTest, Fixed_ColumnsAreContiguousAndAligned) {
+    fixed_t v;
+    for (int i = 0; i < 3; ++i) v.emplace_back(float(i), std::uint32_t(i), double(i));
+
+    auto col = v.column<1>();
+    EXPECT_EQ(col.size(), 3u);
+    EXPECT_EQ(col.data() + 2, &std::get<1>(v[2]));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v.data<0>()) % memory::soa_column_alignment, 0u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v.data<2>()) % memory::soa_column_alignment, 0u);
+
+    for (auto& id : col) id += 100;
+    EXPECT_EQ(std::get<1>(v[1]), 101u);
+}
+
+TEST_F(SoaVectorTest, Fixed_ZipSelectedColumns) {
+    fixed_t v;
+    for (int i = 0; i < 4; ++i) v.emplace_back(float(i), std::uint32_t(i), double(i));
+
+    double sum = 0;
+    for (auto [w, x] : v.zip<2, 0>()) {
+        sum += w;
+        x = -x;
+    }
+    EXPECT_DOUBLE_EQ(sum, 6.0);
+    EXPECT_FLOAT_EQ(std::get<0>(v[3]), -3.f);
+
+    std::size_t rows = 0;
+    for (auto row : std::as_const(v).zip()) {
+        static_assert(std::is_same_v<decltype(row), std::tuple<const float&, const std::uint32_t&, const double&>>);
+        ++rows;
+    }
+    EXPECT_EQ(rows, 4u);
+}
+
+TEST_F(SoaVectorTest, Fixed_NonTrivialLifetime) {
+    {
+        soa_vector<meta::typelist<Tracked, std::string>, 3> v;
+        v.emplace_back(1, "one");
+        v.emplace_back(2, "two");
+        EXPECT_EQ(Tracked::alive, 2);
+        v.pop_back();
+        EXPECT_EQ(Tracked::alive, 1);
+        EXPECT_EQ(std::get<1>(v.back()), "one");
+
+        auto moved = std::move(v);
+        EXPECT_TRUE(v.empty());
+        EXPECT_EQ(moved.size(), 1u);
+        EXPECT_EQ(Tracked::alive, 1);
+    }
+    // TearDown checks the balance.
+}
+
+TEST_F(SoaVectorTest, Fixed_ThrowingColumnRollsBackTheRow) {
+    {
+        soa_vector<meta::typelist<Tracked, Fragile, Tracked>, 4> v;
+        v.emplace_back(1, 1, 1);
+        EXPECT_THROW(v.emplace_back(2, -1, 2), std::runtime_error);
+        EXPECT_EQ(v.size(), 1u);
+        EXPECT_EQ(Tracked::alive, 2);                      // the first column of row 1 was destroyed
+    }
+}
+
+TEST_F(SoaVectorTest, Fixed_ThrowingMoveKeepsEveryRowOwned) {
+    {
+        soa_vector<meta::typelist<Tracked, Fragile>, 4> v;
+        for (int i = 0; i < 3; ++i) v.emplace_back(i, i);
+        Fragile::move_budget = 1;
+        using fragile_t = soa_vector<meta::typelist<Tracked, Fragile>, 4>;
+        EXPECT_THROW(fragile_t{std::move(v)}, std::runtime_error);
+        Fragile::move_budget = 1 << 30;
+        EXPECT_EQ(v.size(), 3u);
+        EXPECT_EQ(std::get<1>(v[2]).v, 2);
+    }
+    // TearDown checks that the partly built target destroyed what it held.
+}
+
+// --- Growable -------------------------------------------------------------
+
+TEST_F(SoaVectorTest, Dynamic_StartsWithoutStorage) {
+    dynamic_t v;
+    EXPECT_EQ(v.capacity(), 0u);
+    EXPECT_EQ(v.data<0>(), nullptr);
+}
+
+TEST_F(SoaVectorTest, Dynamic_GrowsAndPreservesRows) {
+    dynamic_t v;
+    for (std::uint32_t i = 0; i < 1000; ++i)
+        ASSERT_TRUE(v.emplace_back(float(i), i, double(i) * 2));
+    EXPECT_EQ(v.size(), 1000u);
+    EXPECT_GE(v.capacity(), 1000u);
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(v.data<1>()[i], i);
+        EXPECT_DOUBLE_EQ(v.data<2>()[i], double(i) * 2);
+    }
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(v.data<2>()) % memory::soa_column_alignment, 0u);
+}
+
+TEST_F(SoaVectorTest, Dynamic_ReserveAvoidsRegrowth) {
+    dynamic_t v;
+    EXPECT_TRUE(v.reserve(64));
+    const float* before = v.data<0>();
+    for (int i = 0; i < 64; ++i) v.emplace_back(0.f, 0u, 0.0);
+    EXPECT_EQ(v.data<0>(), before);
+}
+
+TEST_F(SoaVectorTest, Dynamic_GrowthMayTakeItsOwnRows) {
+    soa_vector<meta::typelist<std::string, Tracked>> v;
+    for (int i = 0; i < 8; ++i) v.emplace_back(std::string(40, char('a' + i)), Tracked{i});
+    ASSERT_EQ(v.size(), v.capacity());
+    // Both initializers refer to rows of `v`, and this call has to grow it.
+    ASSERT_TRUE(v.emplace_back(std::get<0>(v[0]), std::move(std::get<1>(v[7]))));
+    EXPECT_GT(v.capacity(), 8u);
+    EXPECT_EQ(std::get<0>(v[8]), std::string(40, 'a'));
+    EXPECT_EQ(std::get<1>(v[8]).v, 7);
+    EXPECT_EQ(std::get<0>(v[0]), std::string(40, 'a'));
+}
+
+TEST_F(SoaVectorTest, Dynamic_ReserveRejectsAnOverflowingSize) {
+    dynamic_t v;
+    v.emplace_back(1.f, 2u, 3.0);
+    const std::size_t huge = std::numeric_limits<std::size_t>::max() / sizeof(double) + 1;
+    EXPECT_THROW(v.reserve(huge), std::length_error);   // the uint32_t column alone would fit
+    EXPECT_EQ(v.size(), 1u);
+    EXPECT_EQ(v.capacity(), 8u);
+    EXPECT_DOUBLE_EQ(std::get<2>(v[0]), 3.0);
+}
+
+TEST_F(SoaVectorTest, Dynamic_ThrowingColumnRollsBackTheRow) {
+    {
+        soa_vector<meta::typelist<Tracked, std::string, Picky>> v;
+        EXPECT_THROW(v.emplace_back(7, "a string too long for the small-string buffer", -1), std::runtime_error);
+        EXPECT_TRUE(v.empty());
+        EXPECT_EQ(Tracked::alive, 0);
+    }
+}
+
+TEST_F(SoaVectorTest, Dynamic_MoveStealsColumns) {
+    soa_vector<meta::typelist<Tracked, std::unique_ptr<int>>> v;
+    for (int i = 0; i < 20; ++i) v.emplace_back(i, std::make_unique<int>(i));
+    EXPECT_EQ(Tracked::alive, 20);
+
+    const Tracked* col = v.data<0>();
+    decltype(v) w;
+    w = std::move(v);
+    EXPECT_EQ(w.data<0>(), col);
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(v.capacity(), 0u);
+    EXPECT_EQ(*std::get<1>(w[19]), 19);
+
+    w.clear();
+    EXPECT_EQ(Tracked::alive, 0);
+    EXPECT_GE(w.capacity(), 20u);
+}
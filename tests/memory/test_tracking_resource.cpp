@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+#include <etools/memory/tracking_resource.hpp>
+#include <etools/memory/buffer.hpp>
+#include <etools/memory/soa_vector.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace etools;
+using namespace etools::memory;
+
+namespace {
+
+// Fails the `fail_at`-th allocation and checks every block is released with its allocated size.
+class failing_resource : public std::pmr::memory_resource {
+public:
+    explicit failing_resource(int fail_at) : _fail_at{fail_at} {}
+    int mismatches = 0;
+    std::map<void*, std::size_t> live;
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        if (++_calls == _fail_at) throw std::bad_alloc{};
+        void* p = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        live[p] = bytes;
+        return p;
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        auto it = live.find(p);
+        if (it == live.end() || it->second != bytes) ++mismatches;
+        else live.erase(it);
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    int _fail_at;
+    int _calls = 0;
+};
+
+} // namespace
+
+static_assert(allocation_stats::bucket_of(0) == 0);
+static_assert(allocation_stats::bucket_of(16) == 0);
+static_assert(allocation_stats::bucket_of(17) == 1);
+static_assert(allocation_stats::bucket_of(32) == 1);
+static_assert(allocation_stats::bucket_of(33) == 2);
+static_assert(allocation_stats::bucket_of(256 * 1024) == 14);
+static_assert(allocation_stats::bucket_of(256 * 1024 + 1) == 15);
+static_assert(allocation_stats::bucket_of(std::size_t{1} << 40) == 15);
+static_assert(allocation_stats::bucket_limit(0) == 16);
+static_assert(allocation_stats::bucket_limit(14) == 256 * 1024);
+
+TEST(TrackingResource, CountsBytesAllocationsAndSizeClasses) {
+    tracking_resource r{"test.counts"};
+    EXPECT_EQ(r.tag(), "test.counts");
+    EXPECT_EQ(r.upstream(), std::pmr::get_default_resource());
+
+    void* a = r.allocate(8);
+    void* b = r.allocate(100, 64);
+    void* c = r.allocate(1 << 20);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % 64, 0u);
+
+    allocation_stats s = r.stats();
+    EXPECT_EQ(s.allocations, 3u);
+    EXPECT_EQ(s.deallocations, 0u);
+    EXPECT_EQ(s.bytes_allocated, 8u + 100u + (1u << 20));
+    EXPECT_EQ(s.bytes_in_use, s.bytes_allocated);
+    EXPECT_EQ(s.peak_bytes, s.bytes_in_use);
+    EXPECT_EQ(s.histogram[0], 1u);
+    EXPECT_EQ(s.histogram[allocation_stats::bucket_of(100)], 1u);
+    EXPECT_EQ(s.histogram[allocation_stats::histogram_buckets - 1], 1u);
+
+    r.deallocate(c, 1 << 20);
+    r.deallocate(b, 100, 64);
+    r.deallocate(a, 8);
+    s = r.stats();
+    EXPECT_EQ(s.deallocations, 3u);
+    EXPECT_EQ(s.bytes_in_use, 0u);
+    EXPECT_EQ(s.peak_bytes, 8u + 100u + (1u << 20));   // a large block is published at once
+}
+
+TEST(TrackingResource, ForwardsToUpstreamAndWorksWithPmrContainers) {
+    tracking_resource outer{"test.outer"};
+    tracking_resource inner{"test.inner", &outer};
+    {
+        std::pmr::vector<std::pmr::string> v{&inner};
+        v.emplace_back("a string long enough to leave the small-string buffer");
+        EXPECT_GT(inner.stats().bytes_in_use, 0u);
+        EXPECT_EQ(outer.stats().bytes_in_use, inner.stats().bytes_in_use);
+    }
+    EXPECT_EQ(inner.stats().bytes_in_use, 0u);
+    EXPECT_EQ(outer.stats().allocations, inner.stats().allocations);
+    EXPECT_TRUE(inner.is_equal(inner));
+    EXPECT_FALSE(inner.is_equal(outer));
+}
+
+TEST(TrackingResource, ForEachVisitsLiveResourcesOnly) {
+    auto seen = [](std::string_view tag) {
+        bool found = false;
+        tracking_resource::for_each([&](const tracking_resource& r) { found = found || r.tag() == tag; });
+        return found;
+    };
+    {
+        tracking_resource a{"test.walk.a"};
+        tracking_resource b{"test.walk.b"};
+        EXPECT_TRUE(seen("test.walk.a"));
+        EXPECT_TRUE(seen("test.walk.b"));
+    }
+    EXPECT_FALSE(seen("test.walk.a"));
+    EXPECT_FALSE(seen("test.walk.b"));
+}
+
+TEST(TrackingResource, ConcurrentThreadsMergeExactly) {
+    tracking_resource r{"test.threads"};
+    // More live threads than private shards, so some share the last one.
+    constexpr int threads = 2 * tracking_resource::shards, rounds = 20000;
+    std::atomic<int> finished{0};
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+        pool.emplace_back([&] {
+            std::vector<void*> live;
+            for (int i = 0; i < rounds; ++i) live.push_back(r.allocate(48));
+            for (void* p : live) r.deallocate(p, 48);
+            finished.fetch_add(1);
+            while (finished.load() < threads) std::this_thread::yield();
+        });
+    }
+    for (auto& th : pool) th.join();
+
+    const allocation_stats s = r.stats();
+    EXPECT_EQ(s.allocations, std::uint64_t{threads} * rounds);
+    EXPECT_EQ(s.deallocations, s.allocations);
+    EXPECT_EQ(s.bytes_allocated, s.allocations * 48);
+    EXPECT_EQ(s.histogram[allocation_stats::bucket_of(48)], s.allocations);
+    EXPECT_EQ(s.bytes_in_use, 0u);
+    // Each thread held all its blocks at once; batching may hide up to one flush per shard.
+    EXPECT_GE(s.peak_bytes + tracking_resource::shards * tracking_resource::flush_bytes, std::uint64_t{rounds} * 48);
+}
+
+TEST(TrackingResource, AttributesBuffersAndSoaColumns) {
+    tracking_resource r{"test.integration"};
+    {
+        auto b = make_buffer(256, r);
+        EXPECT_EQ(b.capacity(), 256u);
+        EXPECT_EQ(b.pack(std::uint32_t{7}, 1.5f), sizeof(std::uint32_t) + sizeof(float));
+        EXPECT_EQ(r.stats().bytes_in_use, 256u);
+
+        buffer<resource_deleter> moved = std::move(b);
+        EXPECT_EQ(r.stats().allocations, 1u);
+    }
+    EXPECT_EQ(r.stats().bytes_in_use, 0u);
+
+    {
+        soa_vector<meta::typelist<float, std::uint32_t>> rows{&r};
+        EXPECT_EQ(rows.resource(), &r);
+        EXPECT_EQ(r.stats().allocations, 1u);             // constructing allocates nothing
+        for (std::uint32_t i = 0; i < 100; ++i) rows.emplace_back(float(i), i);
+        EXPECT_EQ(r.stats().bytes_in_use, rows.capacity() * (sizeof(float) + sizeof(std::uint32_t)));
+
+        soa_vector<meta::typelist<float, std::uint32_t>> other;
+        other = std::move(rows);                          // columns keep their resource
+        EXPECT_EQ(other.resource(), &r);
+        EXPECT_EQ(std::get<1>(other[99]), 99u);
+    }
+    const allocation_stats s = r.stats();
+    EXPECT_EQ(s.bytes_in_use, 0u);
+    EXPECT_EQ(s.deallocations, s.allocations);
+}
+
+TEST(TrackingResource, SoaGrowthSurvivesAThrowingUpstream) {
+    // Three columns: the first growth allocates 3 blocks, the second fails on its 2nd block.
+    failing_resource upstream{5};
+    tracking_resource r{"test.failing", &upstream};
+    {
+        soa_vector<meta::typelist<float, std::uint32_t, double>> rows{&r};
+        for (std::uint32_t i = 0; i < 8; ++i) rows.emplace_back(float(i), i, double(i));
+        EXPECT_THROW(rows.emplace_back(8.f, 8u, 8.0), std::bad_alloc);
+        EXPECT_EQ(rows.size(), 8u);
+        EXPECT_EQ(rows.capacity(), 8u);
+        EXPECT_EQ(std::get<1>(rows[7]), 7u);
+        EXPECT_EQ(r.stats().bytes_in_use, 8 * (sizeof(float) + sizeof(std::uint32_t) + sizeof(double)));
+
+        for (std::uint32_t i = 8; i < 20; ++i) rows.emplace_back(float(i), i, double(i));
+        EXPECT_EQ(std::get<2>(rows[19]), 19.0);
+    }
+    EXPECT_EQ(upstream.mismatches, 0);
+    EXPECT_TRUE(upstream.live.empty());
+    EXPECT_EQ(r.stats().bytes_in_use, 0u);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <etools/memory/varint.hpp>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace etools::memory;
+
+static_assert(zigzag_encode(std::int32_t{0}) == 0u);
+static_assert(zigzag_encode(std::int32_t{-1}) == 1u);
+static_assert(zigzag_encode(std::int32_t{1}) == 2u);
+static_assert(zigzag_encode(std::numeric_limits<std::int32_t>::min()) == std::numeric_limits<std::uint32_t>::max());
+static_assert(zigzag_decode<std::int16_t>(zigzag_encode(std::int16_t{-300})) == -300);
+static_assert(varint_size(0) == 1 && varint_size(127) == 1 && varint_size(128) == 2);
+static_assert(varint_size(std::numeric_limits<std::uint64_t>::max()) == varint_max_size);
+static_assert(stream_vbyte_bound(5) == 2 + 20);
+
+TEST(Varint, RoundTripsAtEveryLengthBoundary) {
+    std::array<std::byte, varint_max_size> buf{};
+    for (unsigned bits = 0; bits <= 64; ++bits) {
+        for (const std::uint64_t v : {bits ? (std::uint64_t{1} << (bits - 1)) : 0u,
+                                      bits == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << bits) - 1}) {
+            const std::size_t n = varint_encode(v, buf.data());
+            ASSERT_EQ(n, varint_size(v));
+            std::uint64_t out = 0;
+            ASSERT_EQ(varint_decode(buf.data(), n, out), n) << v;
+            EXPECT_EQ(out, v);
+            EXPECT_EQ(varint_decode(buf.data(), n - 1, out), 0u);   // truncated
+        }
+    }
+}
+
+TEST(Varint, RejectsOverlongAndOverflowingInput) {
+    std::array<std::byte, 11> buf;
+    buf.fill(std::byte{0x80});
+    std::uint64_t out = 5;
+    EXPECT_EQ(varint_decode(buf.data(), buf.size(), out), 0u);        // never terminates within 10 bytes
+    buf[9] = std::byte{0x02};                                          // a 65th bit
+    EXPECT_EQ(varint_decode(buf.data(), buf.size(), out), 0u);
+    buf[9] = std::byte{0x01};
+    EXPECT_EQ(varint_decode(buf.data(), buf.size(), out), 10u);
+    EXPECT_EQ(out, std::uint64_t{1} << 63);
+    EXPECT_EQ(varint_decode(buf.data(), 0, out), 0u);
+}
+
+TEST(StreamVByte, RoundTripsEveryCountAndWidth) {
+    std::uint64_t x = 3;
+    for (std::size_t count = 0; count < 70; ++count) {
+        std::vector<std::uint32_t> in(count), out(count + 1, 0xDEADBEEFu);
+        for (auto& v : in) {
+            x = x * 6364136223846793005ull + 1442695040888963407ull;
+            v = static_cast<std::uint32_t>(x >> 32) >> (8 * (x >> 62));   // 1 to 4 significant bytes
+        }
+        std::vector<std::byte> enc(stream_vbyte_bound(count));
+        const std::size_t n = stream_vbyte_encode(in.data(), count, enc.data());
+        ASSERT_LE(n, enc.size());
+        const auto m = stream_vbyte_decode(enc.data(), n, out.data(), count);
+        ASSERT_TRUE(m.has_value()) << count;
+        EXPECT_EQ(*m, n);
+        EXPECT_EQ(std::vector<std::uint32_t>(out.begin(), out.begin() + static_cast<std::ptrdiff_t>(count)), in);
+        EXPECT_EQ(out[count], 0xDEADBEEFu);                              // nothing written past count
+        if (count) { EXPECT_FALSE(stream_vbyte_decode(enc.data(), n - 1, out.data(), count).has_value()); }
+    }
+}
+
+TEST(StreamVByte, SmallValuesTakeOneByteAndLongInputsUseTheWholeBlock) {
+    std::vector<std::uint32_t> in(1000);
+    for (std::size_t i = 0; i < in.size(); ++i) in[i] = static_cast<std::uint32_t>(i % 200);
+    in[500] = 0xFFFFFFFFu;
+    std::vector<std::byte> enc(stream_vbyte_bound(in.size()) + 16);
+    const std::size_t n = stream_vbyte_encode(in.data(), in.size(), enc.data());
+    EXPECT_EQ(n, 250u + 1000u + 3u);
+
+    std::vector<std::uint32_t> out(in.size());
+    const auto m = stream_vbyte_decode(enc.data(), enc.size(), out.data(), out.size());   // trailing bytes are not read
+    ASSERT_TRUE(m.has_value());
+    EXPECT_EQ(*m, n);
+    EXPECT_EQ(out, in);
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <etools/meta/algorithm.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+using namespace etools::meta;
+
+namespace {
+    enum class color : std::uint8_t { red = 3, green = 1, blue = 2 };
+
+    struct pt { int x, y; };
+    struct by_x {
+        constexpr bool operator()(const pt& a, const pt& b) const { return a.x < b.x; }
+    };
+
+    constexpr std::array<std::uint32_t, 8> keys{40, 10, 30, 20, 50, 10, 70, 60};
+    constexpr auto sorted = sorted_array(keys);
+
+    template<std::size_t N>
+    constexpr bool is_sorted(const std::array<std::uint32_t, N>& a) {
+        for (std::size_t i = 1; i < N; ++i)
+            if (a[i] < a[i - 1]) return false;
+        return true;
+    }
+
+    constexpr std::array<std::uint64_t, 40> descending() {
+        std::array<std::uint64_t, 40> a{};
+        for (std::size_t i = 0; i < a.size(); ++i) a[i] = (a.size() - i) << 40;
+        radix_sort_array(a);
+        return a;
+    }
+
+    constexpr std::size_t unique_count() {
+        auto a = sorted;
+        return unique_sorted(a);
+    }
+} // namespace
+
+// --- Compile-time ---------------------------------------------------------
+
+static_assert(is_sorted(sorted));
+static_assert(sorted[0] == 10 && sorted[1] == 10 && sorted[7] == 70);
+static_assert(sorted_array(keys, std::greater<>{})[0] == 70);
+static_assert(descending()[0] == (std::uint64_t{1} << 40) && descending()[39] == (std::uint64_t{40} << 40));
+static_assert(unique_count() == 7);
+
+static_assert(!all_distinct_sorted(keys));
+static_assert(all_distinct_sorted(std::array<int, 4>{3, -1, 2, 0}));
+static_assert(all_distinct_sorted(std::array<int, 0>{}));
+
+static_assert(lower_bound_index(sorted, 10u) == 0);
+static_assert(lower_bound_index(sorted, 25u) == 3);
+static_assert(lower_bound_index(sorted, 70u) == 7);
+static_assert(lower_bound_index(sorted, 71u) == 8);
+static_assert(lower_bound_index(sorted, 50u, 4) == 4);
+
+static_assert(exclusive_prefix_sum(std::array<int, 3>{2, 0, 3})[0] == 0);
+static_assert(exclusive_prefix_sum(std::array<int, 3>{2, 0, 3})[2] == 2);
+static_assert(exclusive_prefix_sum(std::array<int, 3>{2, 0, 3})[3] == 5);
+
+// --- Runtime ----------------------------------------------------------------
+
+TEST(AlgorithmTest, SortArray_MatchesStdSort) {
+    std::mt19937_64 rng(7);
+    for (int round = 0; round < 50; ++round) {
+        std::array<std::uint32_t, 300> a{};
+        for (auto& v : a) v = static_cast<std::uint32_t>(rng() % (round % 2 ? 16 : 1u << 31));
+        std::array<std::uint32_t, 300> expected = a;
+        std::sort(expected.begin(), expected.end());
+
+        std::array<std::uint32_t, 300> intro = a, radix = a;
+        sort_array(intro);
+        radix_sort_array(radix);
+        EXPECT_EQ(intro, expected);
+        EXPECT_EQ(radix, expected);
+    }
+}
+
+TEST(AlgorithmTest, SortArray_CustomComparatorAndEnums) {
+    std::array<pt, 5> pts{{{3, 0}, {1, 1}, {2, 2}, {0, 3}, {4, 4}}};
+    sort_array(pts, by_x{});
+    for (int i = 0; i < 5; ++i) EXPECT_EQ(pts[i].x, i);
+
+    std::array<color, 3> cs{color::red, color::green, color::blue};
+    radix_sort_array(cs);
+    EXPECT_EQ(cs[0], color::green);
+    EXPECT_EQ(cs[1], color::blue);
+    EXPECT_EQ(cs[2], color::red);
+}
+
+TEST(AlgorithmTest, LowerBoundIndex_MatchesStdLowerBound) {
+    std::array<int, 33> a{};
+    for (std::size_t i = 0; i < a.size(); ++i) a[i] = static_cast<int>(2 * (i / 2));
+    for (std::size_t n = 0; n <= a.size(); ++n)
+        for (int v = -1; v <= 34; ++v)
+            EXPECT_EQ(lower_bound_index(a, v, n),
+                      static_cast<std::size_t>(std::lower_bound(a.begin(), a.begin() + n, v) - a.begin()))
+                << "n=" << n << " v=" << v;
+}
+
+TEST(AlgorithmTest, CountingSortByBucket_IsStableCsr) {
+    constexpr std::array<int, 7> a{5, 2, 8, 4, 1, 7, 3};
+    constexpr auto p = counting_sort_by_bucket<3>(a, [](int v) { return v % 3; });
+
+    EXPECT_EQ(p.counts, (std::array<std::size_t, 3>{1, 3, 3}));
+    EXPECT_EQ(p.offsets, (std::array<std::size_t, 4>{0, 1, 4, 7}));
+    // bucket 0: {3}; bucket 1: {4, 1, 7}; bucket 2: {5, 2, 8}, each in input order.
+    EXPECT_EQ(p.items, (std::array<std::size_t, 7>{6, 3, 4, 5, 0, 1, 2}));
+    for (std::size_t i = 0; i < a.size(); ++i) EXPECT_EQ(p.bucket[i], static_cast<std::size_t>(a[i] % 3));
+}
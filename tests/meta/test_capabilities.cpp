@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <etools/meta/capabilities.hpp>
+#include <etools/meta/info_gen.hpp>
+#include <etools/memory/slot.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+
+using namespace etools::meta;
+
+// The library's detectors are private, so user code may still generate these names.
+generate_has_callable(reinit)
+generate_has_static_member_variable(relocatable)
+generate_has_static_member_variable(key)
+generate_has_callable(fields)
+
+struct plain {};
+
+struct reinit_int {
+    void reinit(int) noexcept {}
+};
+
+struct keyed {
+    static constexpr std::uint16_t key = 9;
+};
+
+struct instance_key {
+    int key;
+};
+
+struct marked_relocatable {
+    static constexpr bool relocatable = true;
+    std::unique_ptr<int> p;
+};
+
+struct marked_not_relocatable {
+    static constexpr bool relocatable = false;
+    std::string s;
+};
+
+struct with_fields {
+    int a;
+    double b;
+    auto fields() { return std::tie(a, b); }
+};
+
+struct fields_not_tuple {
+    int fields() { return 0; }
+};
+
+struct fields_by_value {
+    int a, b;
+    std::tuple<int, int> fields() const { return {a, b}; }
+};
+
+struct fields_const_refs {
+    int a, b;
+    std::tuple<const int&, const int&> fields() const { return {a, b}; }
+};
+
+struct wire_packet {
+    int a;
+    double b;
+    static constexpr bool wire_fields = true;
+    auto fields() { return std::tie(a, b); }
+};
+
+struct wire_marker_off {
+    int a;
+    static constexpr bool wire_fields = false;
+    auto fields() { return std::tie(a); }
+};
+
+// --- reinit -------------------------------------------------------------------
+static_assert(is_reinitializable_v<reinit_int, int>);
+static_assert(is_reinitializable_v<reinit_int, short>);       // implicit conversion
+static_assert(!is_reinitializable_v<reinit_int>);
+static_assert(!is_reinitializable_v<reinit_int, int, int>);
+static_assert(!is_reinitializable_v<plain, int>);
+
+// --- relocatable ------------------------------------------------------------
+static_assert(is_relocatable_v<int>);
+static_assert(is_relocatable_v<plain>);                         // trivially copyable
+static_assert(is_relocatable_v<marked_relocatable>);
+static_assert(!is_relocatable_v<marked_not_relocatable>);
+static_assert(!is_relocatable_v<std::string>);
+
+// --- key ----------------------------------------------------------------------
+static_assert(has_static_key_v<keyed>);
+static_assert(!has_static_key_v<instance_key>);
+static_assert(!has_static_key_v<plain>);
+static_assert(static_key<keyed>::value == 9);
+static_assert(std::is_same_v<std::remove_cv_t<decltype(static_key<keyed>::value)>, std::uint16_t>);
+
+// --- fields -------------------------------------------------------------------
+static_assert(has_fields_v<with_fields>);
+static_assert(!has_fields_v<fields_not_tuple>);
+static_assert(!has_fields_v<plain>);
+static_assert(!has_fields_v<fields_by_value>);                  // assigning would hit a temporary
+static_assert(!has_fields_v<fields_const_refs>);
+static_assert(has_wire_fields_v<wire_packet>);
+static_assert(!has_wire_fields_v<with_fields>);                 // no wire_fields marker
+static_assert(!has_wire_fields_v<wire_marker_off>);
+static_assert(!has_wire_fields_v<fields_by_value>);
+
+// --- user-generated probes coexist with the library's ------------------------
+static_assert(has_static_member_variable_key_v<keyed>);
+static_assert(has_static_member_variable_relocatable_v<marked_relocatable>);
+static_assert(!has_callable_reinit_v<reinit_int>);                   // reinit takes an int
+static_assert(has_callable_fields_v<fields_not_tuple>);
+
+TEST(Capabilities, FieldsAliasMembers) {
+    with_fields w{1, 2.5};
+    std::get<0>(w.fields()) = 4;
+    EXPECT_EQ(w.a, 4);
+    w.fields() = std::make_tuple(7, 0.5);
+    EXPECT_EQ(w.a, 7);
+    EXPECT_DOUBLE_EQ(w.b, 0.5);
+}
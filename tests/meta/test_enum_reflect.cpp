@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <etools/meta/enum_reflect.hpp>
+
+using namespace etools::meta;
+using namespace std::string_view_literals;
+
+namespace reflect_test {
+
+enum class color : std::uint8_t { red, green, blue };
+
+enum class status : std::int16_t { failed = -3, idle = 0, busy = 40, done = 120 };
+
+enum legacy : int { legacy_a = 1, legacy_b = 2 };
+
+enum class wide : std::uint32_t { first = 1000, second = 1001, third = 1005 };
+
+} // namespace reflect_test
+
+template<>
+struct etools::meta::enum_range<reflect_test::wide> {
+    static constexpr long long min = 990;
+    static constexpr long long max = 1010;
+};
+
+using reflect_test::color;
+using reflect_test::status;
+using reflect_test::wide;
+
+// Compile-time surface: everything is usable in constant expressions.
+static_assert(enum_name<color::green>() == "green");
+static_assert(enum_name<static_cast<color>(7)>().empty());
+static_assert(enum_name<reflect_test::legacy_b>() == "legacy_b");
+static_assert(enum_count_v<color> == 3);
+static_assert(enum_values_v<status>[0] == status::failed);
+static_assert(enum_names_v<status>[3] == "done");
+static_assert(to_string(color::blue) == "blue");
+static_assert(*from_string<status>("busy") == status::busy);
+static_assert(!from_string<color>("purple"));
+
+TEST(EnumReflect, DefaultRangeFollowsUnderlyingType) {
+    EXPECT_EQ(enum_range<color>::min, 0);
+    EXPECT_EQ(enum_range<color>::max, 255);
+    EXPECT_EQ(enum_range<status>::min, -128);
+    EXPECT_EQ(enum_range<status>::max, 127);
+}
+
+TEST(EnumReflect, ContiguousEnumRoundTrips) {
+    for (std::size_t i = 0; i < enum_count_v<color>; ++i) {
+        const color c = enum_values_v<color>[i];
+        EXPECT_EQ(enum_index(c), i);
+        EXPECT_EQ(from_string<color>(to_string(c)), c);
+    }
+    volatile std::uint8_t raw = 3;
+    EXPECT_TRUE(to_string(static_cast<color>(raw)).empty());
+    EXPECT_EQ(enum_index(static_cast<color>(raw)), enum_count_v<color>);
+}
+
+TEST(EnumReflect, SparseSignedEnumUsesPerfectHash) {
+    EXPECT_EQ(enum_names_v<status>[0], "failed"sv);
+    EXPECT_EQ(to_string(status::failed), "failed"sv);
+    EXPECT_EQ(to_string(status::done), "done"sv);
+    volatile std::int16_t raw = 41;
+    EXPECT_TRUE(to_string(static_cast<status>(raw)).empty());
+    raw = -2000;
+    EXPECT_TRUE(to_string(static_cast<status>(raw)).empty());
+}
+
+TEST(EnumReflect, FromStringRejectsNearMisses) {
+    const std::string runtime = "idle";
+    EXPECT_EQ(from_string<status>(runtime), status::idle);
+    EXPECT_FALSE(from_string<status>("Idle"));
+    EXPECT_FALSE(from_string<status>("idl"));
+    EXPECT_FALSE(from_string<status>(""));
+    EXPECT_FALSE(from_string<status>("status::idle"));
+}
+
+TEST(EnumReflect, CustomRangeAndUnscopedEnums) {
+    ASSERT_EQ(enum_count_v<wide>, 3u);
+    EXPECT_EQ(to_string(wide::third), "third"sv);
+    EXPECT_EQ(from_string<wide>("second"), wide::second);
+    EXPECT_EQ(enum_count_v<reflect_test::legacy>, 2u);
+    EXPECT_EQ(from_string<reflect_test::legacy>("legacy_a"), reflect_test::legacy_a);
+}
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include <etools/meta/fast_variant.hpp>
+#include <etools/meta/overload.hpp>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using namespace etools::meta;
+
+// Counts live instances so leaks / double destruction show up as a non-zero balance.
+struct Tracked {
+    static int alive;
+    int v;
+    explicit Tracked(int x = 0) noexcept : v(x) { ++alive; }
+    Tracked(const Tracked& o) noexcept : v(o.v) { ++alive; }
+    Tracked(Tracked&& o) noexcept : v(o.v) { o.v = -1; ++alive; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) = default;
+    ~Tracked() { --alive; }
+};
+int Tracked::alive = 0;
+
+class FastVariantTest : public ::testing::Test {
+protected:
+    void SetUp() override { Tracked::alive = 0; }
+    void TearDown() override { EXPECT_EQ(Tracked::alive, 0); }
+};
+
+// --- Compile-time shape ---------------------------------------------------
+
+static_assert(std::is_same_v<fast_variant<int, double, int>, fast_variant<int, double>>);
+static_assert(std::is_same_v<fast_variant<int, double>::types, typelist<int, double>>);
+static_assert(std::is_same_v<fast_variant<int, double>::index_type, std::uint8_t>);
+static_assert(fast_variant<int, double>::index_of<double> == 1);
+static_assert(fast_variant<int, double>::index_of<float> == fast_variant<int, double>::npos);
+static_assert(std::is_same_v<fast_variant<int, double>::alternative_t<1>, double>);
+static_assert(sizeof(fast_variant<std::uint32_t, float>) == 8);
+static_assert(std::is_nothrow_move_constructible_v<fast_variant<int, std::string>>);
+static_assert(std::is_nothrow_move_assignable_v<fast_variant<int, std::string>>);
+static_assert(std::is_trivially_copyable_v<fast_variant<int, double>>);
+static_assert(std::is_trivially_copyable_v<fast_variant<std::uint8_t, float, int*>>);
+static_assert(!std::is_trivially_copyable_v<fast_variant<int, std::string>>);
+static_assert(!std::is_copy_constructible_v<fast_variant<int, std::unique_ptr<int>>>);
+static_assert(!std::is_copy_assignable_v<fast_variant<int, std::unique_ptr<int>>>);
+static_assert(std::is_move_constructible_v<fast_variant<int, std::unique_ptr<int>>>);
+static_assert(std::is_move_assignable_v<fast_variant<int, std::unique_ptr<int>>>);
+static_assert(!std::is_move_constructible_v<fast_variant<int, std::mutex>>);
+static_assert(!std::is_copy_assignable_v<fast_variant<int, std::mutex>>);
+static_assert(!std::is_constructible_v<fast_variant<int, double>, const char*>);
+
+// --- Construction ---------------------------------------------------------
+
+TEST_F(FastVariantTest, DefaultConstructsFirstAlternative) {
+    fast_variant<int, std::string> v;
+    EXPECT_EQ(v.index(), 0u);
+    EXPECT_EQ(v.get<int>(), 0);
+    EXPECT_FALSE(v.valueless());
+}
+
+TEST_F(FastVariantTest, ConvertingAndInPlaceConstruction) {
+    fast_variant<int, float, std::string> a = 2.5f;
+    EXPECT_TRUE(a.holds<float>());
+    EXPECT_FLOAT_EQ(a.get<1>(), 2.5f);
+
+    fast_variant<int, float, std::string> b{std::in_place_type<std::string>, 3, 'x'};
+    EXPECT_EQ(b.get<std::string>(), "xxx");
+
+    fast_variant<int, float, std::string> c{std::in_place_index<0>, 7};
+    EXPECT_EQ(c.get<int>(), 7);
+}
+
+TEST_F(FastVariantTest, GetIfReturnsNullForInactive) {
+    fast_variant<int, std::string> v = std::string("hi");
+    EXPECT_EQ(v.get_if<int>(), nullptr);
+    ASSERT_NE(v.get_if<std::string>(), nullptr);
+    EXPECT_EQ(*std::as_const(v).get_if<std::string>(), "hi");
+}
+
+// --- Visitation -----------------------------------------------------------
+
+TEST_F(FastVariantTest, VisitWithOverloadSet) {
+    fast_variant<int, float, std::string> v = std::string("abc");
+    auto which = [](const auto& var) {
+        return var.visit(overload{
+            [](int)                -> int { return 0; },
+            [](float)              -> int { return 1; },
+            [](const std::string&) -> int { return 2; },
+        });
+    };
+    EXPECT_EQ(which(v), 2);
+    v = 1.f;
+    EXPECT_EQ(which(v), 1);
+    v = 5;
+    EXPECT_EQ(which(v), 0);
+}
+
+TEST_F(FastVariantTest, VisitPropagatesReferenceCategory) {
+    fast_variant<int, std::string> v = std::string("move me");
+    visit([](auto& x) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(x)>, std::string>) x += "!";
+    }, v);
+    EXPECT_EQ(v.get<std::string>(), "move me!");
+
+    std::string out = std::move(v).visit(overload{
+        [](int&&)           { return std::string{}; },
+        [](std::string&& s) { return std::move(s); },
+    });
+    EXPECT_EQ(out, "move me!");
+}
+
+TEST_F(FastVariantTest, VisitManyAlternatives) {
+    using big_t = fast_variant<
+        std::integral_constant<int, 0>,  std::integral_constant<int, 1>,  std::integral_constant<int, 2>,
+        std::integral_constant<int, 3>,  std::integral_constant<int, 4>,  std::integral_constant<int, 5>,
+        std::integral_constant<int, 6>,  std::integral_constant<int, 7>,  std::integral_constant<int, 8>,
+        std::integral_constant<int, 9>,  std::integral_constant<int, 10>, std::integral_constant<int, 11>,
+        std::integral_constant<int, 12>, std::integral_constant<int, 13>, std::integral_constant<int, 14>,
+        std::integral_constant<int, 15>, std::integral_constant<int, 16>, std::integral_constant<int, 17>,
+        std::integral_constant<int, 18>, std::integral_constant<int, 19>, std::integral_constant<int, 20>>;
+    static_assert(big_t::alternatives == 21);
+
+    big_t v{std::in_place_index<17>};
+    EXPECT_EQ(v.visit([](auto c) { return decltype(c)::value; }), 17);
+    v.emplace<4>();
+    EXPECT_EQ(v.visit([](auto c) { return decltype(c)::value; }), 4);
+}
+
+// --- Lifetime -------------------------------------------------------------
+
+TEST_F(FastVariantTest, EmplaceDestroysPrevious) {
+    {
+        fast_variant<Tracked, std::string> v{std::in_place_type<Tracked>, 1};
+        EXPECT_EQ(Tracked::alive, 1);
+        v.emplace<std::string>("s");
+        EXPECT_EQ(Tracked::alive, 0);
+        v.emplace<Tracked>(2);
+        EXPECT_EQ(Tracked::alive, 1);
+        EXPECT_EQ(v.get<Tracked>().v, 2);
+    }
+    // TearDown checks the balance.
+}
+
+TEST_F(FastVariantTest, CopyAndMoveSemantics) {
+    fast_variant<Tracked, std::unique_ptr<int>> a{std::in_place_type<Tracked>, 9};
+    fast_variant<Tracked, std::unique_ptr<int>> b = std::move(a);
+    EXPECT_EQ(b.get<Tracked>().v, 9);
+    EXPECT_EQ(a.get<Tracked>().v, -1);   // moved-from alternative stays engaged
+    EXPECT_EQ(Tracked::alive, 2);
+
+    a = std::make_unique<int>(4);
+    EXPECT_EQ(Tracked::alive, 1);
+    b = std::move(a);
+    EXPECT_EQ(Tracked::alive, 0);
+    EXPECT_EQ(*b.get<std::unique_ptr<int>>(), 4);
+
+    fast_variant<Tracked, std::string> c{std::in_place_type<Tracked>, 3};
+    fast_variant<Tracked, std::string> d = c;
+    EXPECT_EQ(Tracked::alive, 2);
+    d = std::string("x");
+    d = c;
+    EXPECT_EQ(d.get<Tracked>().v, 3);
+    EXPECT_EQ(Tracked::alive, 2);
+}
+
+TEST_F(FastVariantTest, TriviallyCopyableAlternativesCopyBytes) {
+    using pod_t = fast_variant<std::uint32_t, double>;
+    pod_t a = 1.25;
+    pod_t b = a;
+    EXPECT_DOUBLE_EQ(b.get<double>(), 1.25);
+    b = std::uint32_t{7};
+    a = b;
+    EXPECT_EQ(a.get<std::uint32_t>(), 7u);
+}
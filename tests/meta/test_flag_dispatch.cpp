@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <etools/meta/flag_dispatch.hpp>
+#include <cstdint>
+#include <string>
+
+using namespace etools::meta;
+
+enum class ev : std::uint32_t {
+    none   = 0,
+    rx     = 1u << 0,
+    tx     = 1u << 1,
+    hangup = 1u << 4,
+    error  = 1u << 31
+};
+template <>
+struct etools::meta::enable_flags<ev> : std::true_type {};
+
+namespace {
+    void on_rx(std::string& log)     { log += 'r'; }
+    void on_tx(std::string& log)     { log += 't'; }
+    void on_hangup(std::string& log) { log += 'h'; }
+    void on_error(std::string& log)  { log += 'e'; }
+
+    constexpr int twice(int x) { return 2 * x; }
+    constexpr int thrice(int x) { return 3 * x; }
+} // namespace
+
+using bit_order = flag_dispatch<ev,
+    flag_handler<ev::error, &on_error>,
+    flag_handler<ev::rx, &on_rx>,
+    flag_handler<ev::tx, on_tx>>;
+
+using by_priority = flag_dispatch<ev,
+    flag_handler<ev::rx, &on_rx>,
+    flag_handler<ev::tx, &on_tx, 1>,
+    flag_handler<ev::hangup, &on_hangup>,
+    flag_handler<ev::error, &on_error, 10>>;
+
+// --- Compile-time shape ---------------------------------------------------
+
+static_assert(bit_order::size == 3);
+static_assert(bit_order::mask == (ev::rx | ev::tx | ev::error));
+static_assert(!bit_order::prioritized);
+static_assert(by_priority::prioritized);
+static_assert(bit_order::handles(ev::rx | ev::error));
+static_assert(!bit_order::handles(ev::rx | ev::hangup));
+
+static_assert(bit_order::order()[0] == ev::rx);
+static_assert(bit_order::order()[1] == ev::tx);
+static_assert(bit_order::order()[2] == ev::error);
+static_assert(by_priority::order()[0] == ev::error);
+static_assert(by_priority::order()[1] == ev::tx);
+static_assert(by_priority::order()[2] == ev::rx);
+static_assert(by_priority::order()[3] == ev::hangup);
+
+// Dispatch is usable in constant expressions; handler results are discarded.
+using scale = flag_dispatch<ev, flag_handler<ev::rx, &twice>, flag_handler<ev::tx, &thrice>>;
+static_assert(scale::dispatch(ev::rx | ev::tx, 1) == 2);
+static_assert(scale::dispatch(ev::none, 1) == 0);
+
+// --- Runtime dispatch -------------------------------------------------------
+
+TEST(FlagDispatchTest, BitOrder_CallsOnlySetHandledFlags) {
+    std::string log;
+    EXPECT_EQ(bit_order::dispatch(ev::error | ev::tx, log), 2u);
+    EXPECT_EQ(log, "te");
+
+    log.clear();
+    EXPECT_EQ(bit_order::dispatch(ev::none, log), 0u);
+    EXPECT_EQ(log, "");
+}
+
+TEST(FlagDispatchTest, BitOrder_UnhandledFlagsAreIgnored) {
+    std::string log;
+    EXPECT_EQ(bit_order::dispatch(ev::hangup | ev::rx, log), 1u);
+    EXPECT_EQ(log, "r");
+}
+
+TEST(FlagDispatchTest, Priority_HigherFirstThenBitOrder) {
+    std::string log;
+    EXPECT_EQ(by_priority::dispatch(ev::rx | ev::tx | ev::hangup | ev::error, log), 4u);
+    EXPECT_EQ(log, "etrh");
+
+    log.clear();
+    by_priority::dispatch(ev::hangup | ev::rx, log);
+    EXPECT_EQ(log, "rh");
+}
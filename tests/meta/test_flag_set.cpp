@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <etools/meta/flag_set.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+using namespace etools::meta;
+
+enum class feature : std::uint16_t {
+    fast_path = 0,
+    tracing   = 1,
+    word0_top = 63,
+    word1_low = 64,
+    middle    = 130,
+    last      = 199
+};
+
+using features = flag_set<feature, 200>;
+using tiny     = flag_set<feature, 2>;
+
+// --- Compile-time shape ---------------------------------------------------
+
+static_assert(features::word_count == 4);
+static_assert(features::size() == 200);
+static_assert(sizeof(features) == 4 * sizeof(std::uint64_t));
+static_assert(flag_set<feature, 64>::word_count == 1);
+static_assert(flag_set<feature, 65>::word_count == 2);
+
+static_assert(features{}.none());
+static_assert(features{feature::last}.test(feature::last));
+static_assert(features::full().count() == 200);
+static_assert(features::full().all());
+static_assert((~features{}) == features::full());
+static_assert(tiny::full().words()[0] == 0b11);
+
+// --- Single-flag operations -------------------------------------------------
+
+TEST(FlagSetTest, SetResetFlipAcrossWords) {
+    features s;
+    s.set(feature::fast_path).set(feature::word1_low).set(feature::last);
+    EXPECT_TRUE(s.test(feature::fast_path));
+    EXPECT_TRUE(s.test(feature::word1_low));
+    EXPECT_TRUE(s.test(feature::last));
+    EXPECT_FALSE(s.test(feature::word0_top));
+    EXPECT_EQ(s.count(), 3u);
+
+    s.reset(feature::word1_low).flip(feature::middle).flip(feature::fast_path);
+    EXPECT_FALSE(s.test(feature::word1_low));
+    EXPECT_TRUE(s.test(feature::middle));
+    EXPECT_FALSE(s.test(feature::fast_path));
+    EXPECT_EQ(s.count(), 2u);
+
+    s.clear();
+    EXPECT_TRUE(s.none());
+}
+
+// --- Whole-set operations ---------------------------------------------------
+
+TEST(FlagSetTest, BitwiseOperators) {
+    const features a{feature::fast_path, feature::word0_top, feature::middle};
+    const features b{feature::word0_top, feature::last};
+
+    EXPECT_EQ(a | b, (features{feature::fast_path, feature::word0_top, feature::middle, feature::last}));
+    EXPECT_EQ(a & b, features{feature::word0_top});
+    EXPECT_EQ(a ^ b, (features{feature::fast_path, feature::middle, feature::last}));
+    EXPECT_NE(a, b);
+
+    features c = a;
+    c &= ~b;
+    EXPECT_EQ(c, (features{feature::fast_path, feature::middle}));
+}
+
+TEST(FlagSetTest, ComplementStaysWithinN) {
+    const features s = ~features{feature::tracing};
+    EXPECT_EQ(s.count(), 199u);
+    EXPECT_FALSE(s.all());
+    EXPECT_TRUE(s.any());
+    // No phantom bits beyond position 199.
+    EXPECT_EQ(s.words()[3] >> (200 - 192), 0u);
+    EXPECT_TRUE((s | features{feature::tracing}).all());
+}
+
+// --- Iteration ----------------------------------------------------------------
+
+TEST(FlagSetTest, IteratesSetFlagsInOrder) {
+    const features s{feature::last, feature::tracing, feature::word1_low, feature::word0_top};
+    const std::vector<feature> expect{feature::tracing, feature::word0_top, feature::word1_low, feature::last};
+
+    std::vector<feature> seen(s.begin(), s.end());
+    EXPECT_EQ(seen, expect);
+
+    std::vector<feature> cb;
+    s.for_each([&](feature f) { cb.push_back(f); });
+    EXPECT_EQ(cb, expect);
+
+    auto it = s.begin();
+    std::advance(it, 2);
+    EXPECT_EQ(it.index(), 64u);
+}
+
+TEST(FlagSetTest, IterationOfEmptyAndFull) {
+    const features empty;
+    EXPECT_EQ(empty.begin(), empty.end());
+
+    const features full = features::full();
+    std::size_t n = 0, last = 0;
+    for (auto it = full.begin(); it != full.end(); ++it, ++n) last = it.index();
+    EXPECT_EQ(n, 200u);
+    EXPECT_EQ(last, 199u);
+}
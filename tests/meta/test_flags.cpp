@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <etools/meta/flags.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+using namespace etools::meta;
+
+enum class perms : std::uint8_t {
+    none    = 0,
+    read    = 1u << 0,
+    write   = 1u << 1,
+    execute = 1u << 2,
+    sticky  = 1u << 7
+};
+template <>
+struct etools::meta::enable_flags<perms> : std::true_type {};
+
+enum class events : std::uint64_t {
+    none  = 0,
+    rx    = 1ull << 3,
+    tx    = 1ull << 17,
+    error = 1ull << 63
+};
+template <>
+struct etools::meta::enable_flags<events> : std::true_type {};
+
+// --- Existing decomposition helpers --------------------------------------
+
+static_assert(enumerate_flags(perms::read | perms::sticky)[7] == perms::sticky);
+static_assert(enumerate_flags(perms::read | perms::sticky)[1] == perms::none);
+static_assert(extract_flags(perms::write | perms::sticky).second == 2);
+static_assert(extract_flags(perms::write | perms::sticky).first[1] == perms::sticky);
+// A truncated Size ignores the high bits.
+static_assert(extract_flags<perms, 4>(perms::write | perms::sticky).second == 1);
+
+TEST(FlagsTest, EnumerateAndExtract_Wide) {
+    const auto mask = events::rx | events::error;
+    const auto bits = enumerate_flags(mask);
+    for (std::size_t i = 0; i < bits.size(); ++i)
+        EXPECT_EQ(bits[i] != events::none, i == 3 || i == 63) << i;
+
+    const auto [flags, count] = extract_flags(mask);
+    ASSERT_EQ(count, 2u);
+    EXPECT_EQ(flags[0], events::rx);
+    EXPECT_EQ(flags[1], events::error);
+    EXPECT_EQ(flags[2], events::none);
+}
+
+// --- Set-bit queries -------------------------------------------------------
+
+static_assert(popcount(perms::none) == 0);
+static_assert(popcount(perms::read | perms::execute | perms::sticky) == 3);
+static_assert(popcount(events::rx | events::tx | events::error) == 3);
+static_assert(lowest_flag(perms::write | perms::sticky) == perms::write);
+static_assert(lowest_flag(perms::none) == perms::none);
+static_assert(lowest_flag(events::error) == events::error);
+static_assert(flag_index(perms::sticky) == 7);
+static_assert(flag_index(events::tx | events::error) == 17);
+
+// --- flag_range ------------------------------------------------------------
+
+constexpr std::size_t sum_indices(events mask) {
+    std::size_t s = 0;
+    const flag_range r(mask);
+    for (auto it = r.begin(); it != r.end(); ++it) s += it.index();
+    return s;
+}
+static_assert(sum_indices(events::rx | events::tx | events::error) == 3 + 17 + 63);
+static_assert(flag_range(perms::none).empty());
+static_assert(flag_range(perms::read | perms::write).size() == 2);
+
+TEST(FlagsTest, FlagRange_AscendingSingleBitFlags) {
+    std::vector<events> seen;
+    for (events e : flag_range(events::error | events::rx | events::tx))
+        seen.push_back(e);
+    EXPECT_EQ(seen, (std::vector<events>{events::rx, events::tx, events::error}));
+
+    std::vector<perms> none(flag_range(perms::none).begin(), flag_range(perms::none).end());
+    EXPECT_TRUE(none.empty());
+}
+
+TEST(FlagsTest, FlagRange_IteratorIsForward) {
+    const flag_range r(perms::read | perms::execute | perms::sticky);
+    static_assert(std::is_same_v<std::iterator_traits<decltype(r.begin())>::iterator_category,
+                                 std::forward_iterator_tag>);
+    EXPECT_EQ(std::distance(r.begin(), r.end()), 3);
+
+    auto it = r.begin();
+    auto prev = it++;
+    EXPECT_EQ(*prev, perms::read);
+    EXPECT_EQ(*it, perms::execute);
+    EXPECT_EQ(it.index(), 2u);
+}
+
+// --- for_each_flag -----------------------------------------------------------
+
+TEST(FlagsTest, ForEachFlag_UnaryAndIndexedCallbacks) {
+    std::vector<perms> flags;
+    for_each_flag(perms::sticky | perms::write, [&](perms p) { flags.push_back(p); });
+    EXPECT_EQ(flags, (std::vector<perms>{perms::write, perms::sticky}));
+
+    std::vector<std::size_t> idx;
+    for_each_flag(events::tx | events::error, [&](events, std::size_t i) { idx.push_back(i); });
+    EXPECT_EQ(idx, (std::vector<std::size_t>{17, 63}));
+
+    int calls = 0;
+    for_each_flag(events::none, [&](events) { ++calls; });
+    EXPECT_EQ(calls, 0);
+}
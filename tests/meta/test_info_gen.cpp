@@ -538,4 +538,42 @@ TEST(GenerateHasNestedTypeTest, EdgeCaseStruct_Negative) {
     EXPECT_FALSE((etools::meta::has_nested_type_alias_t_v<edge_case_struct>));
 }
 
- 
\ No newline at end of file
+ 
+
+
+///////////////////////////////////////////////////////////// `generate_has_callable_with` TESTS  /////////////////////////////////////////////////////////////
+
+
+generate_has_callable_with(bar)
+generate_has_callable_with(foo)
+generate_has_callable_with(overloaded)
+generate_has_callable_with(returns_complex)
+generate_has_callable_with(variadic)
+generate_has_callable_with(private_method)
+generate_has_callable_with(get_static)
+generate_has_callable_with(id)
+
+TEST(GenerateHasCallableWithTest, BasicPublicMembers) {
+    EXPECT_TRUE((etools::meta::has_callable_with_bar_v<basic_public_members, int, float>));
+    EXPECT_TRUE((etools::meta::has_callable_with_bar_v<basic_public_members, short, double>)); // implicit conversions
+    EXPECT_FALSE((etools::meta::has_callable_with_bar_v<basic_public_members>));
+    EXPECT_FALSE((etools::meta::has_callable_with_bar_v<basic_public_members, int>));
+    EXPECT_TRUE((etools::meta::has_callable_with_foo_v<basic_public_members>));
+    EXPECT_FALSE((etools::meta::has_callable_with_foo_v<basic_public_members, int>));
+    EXPECT_FALSE((etools::meta::has_callable_with_id_v<basic_public_members>));             // a variable
+}
+
+TEST(GenerateHasCallableWithTest, OverloadsAndTemplates) {
+    EXPECT_TRUE((etools::meta::has_callable_with_overloaded_v<complex_method_signatures>));
+    EXPECT_TRUE((etools::meta::has_callable_with_overloaded_v<complex_method_signatures, int>));
+    EXPECT_FALSE((etools::meta::has_callable_with_overloaded_v<complex_method_signatures, int, int>));
+    EXPECT_TRUE((etools::meta::has_callable_with_returns_complex_v<complex_method_signatures, double, int>));
+    EXPECT_TRUE((etools::meta::has_callable_with_variadic_v<complex_method_signatures>));
+    EXPECT_TRUE((etools::meta::has_callable_with_variadic_v<complex_method_signatures, int&, const char*>));
+}
+
+TEST(GenerateHasCallableWithTest, AccessAndStatics) {
+    EXPECT_FALSE((etools::meta::has_callable_with_private_method_v<mixed_access_members, int>));
+    EXPECT_TRUE((etools::meta::has_callable_with_get_static_v<static_and_constexpr_members>)); // static, via an instance
+    EXPECT_FALSE((etools::meta::has_callable_with_bar_v<mixed_access_members, int, float>));
+}
@@ -257,3 +257,31 @@ TEST(SortTest, CustomComparator_AllEquivalent_PreservesOrder) {
         typelist<s4, s1, s2>
     >));
 }
+
+// ---- Large packs: multi-block merges -------------------------------------
+
+template<std::size_t I>
+struct sized { static constexpr std::size_t index = I; char pad[(I * 7) % 5 + 1]; };
+
+template<typename... Ts>
+constexpr bool sorted_stable_by_size(typelist<Ts...>) {
+    constexpr std::size_t sizes[] = { sizeof(Ts)... };
+    constexpr std::size_t indices[] = { Ts::index... };
+    for (std::size_t i = 1; i < sizeof...(Ts); ++i) {
+        if (sizes[i - 1] > sizes[i]) return false;
+        if (sizes[i - 1] == sizes[i] && indices[i - 1] > indices[i]) return false;
+    }
+    return true;
+}
+
+template<std::size_t... Is>
+constexpr bool sort_large_pack(std::index_sequence<Is...>) {
+    using sorted = sort_t<size_less, sized<Is>...>;
+    return sizeof...(Is) == 0 || sorted_stable_by_size(sorted{});
+}
+
+TEST(SortTest, LargePack_SortedAndStable) {
+    // 300 types, 5 distinct sizes: runs longer than one merge block, many ties.
+    EXPECT_TRUE(sort_large_pack(std::make_index_sequence<300>{}));
+    EXPECT_TRUE(sort_large_pack(std::make_index_sequence<65>{}));
+}
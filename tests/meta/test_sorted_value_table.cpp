@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <etools/meta/sorted_value_table.hpp>
+#include <etools/meta/sort.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+using namespace etools::meta;
+
+template<std::size_t Capacity, int Tag = 0>
+struct pool { static constexpr std::size_t capacity = Capacity; };
+
+template<typename T>
+struct capacity_of { static constexpr std::size_t value = T::capacity; };
+
+template<typename L, typename R>
+struct by_capacity : std::bool_constant<(L::capacity < R::capacity)> {};
+
+using p256 = pool<256>;
+using p64  = pool<64>;
+using p1k  = pool<1024>;
+using p64b = pool<64, 1>;  // same key as p64, registered later
+using p16  = pool<16>;
+
+using pools_t = sorted_value_table<capacity_of, p256, p64, p1k, p64b, p16>;
+
+// --- Compile-time tables --------------------------------------------------
+
+static_assert(pools_t::size == 5);
+static_assert(std::is_same_v<pools_t::value_type, std::size_t>);
+static_assert(std::is_same_v<pools_t::index_type, std::uint8_t>);
+
+static_assert(pools_t::keys[0] == 16 && pools_t::keys[1] == 64 && pools_t::keys[2] == 64
+           && pools_t::keys[3] == 256 && pools_t::keys[4] == 1024);
+static_assert(pools_t::order[0] == 4 && pools_t::order[1] == 1 && pools_t::order[2] == 3
+           && pools_t::order[3] == 0 && pools_t::order[4] == 2);
+static_assert(pools_t::rank_of<p256>() == 3);
+static_assert(pools_t::rank_of<p64b>() == 2);
+
+// Same (stable) result as the type-level sort, without a comparator per pair.
+static_assert(std::is_same_v<pools_t::sorted_types, typelist<p16, p64, p64b, p256, p1k>>);
+static_assert(std::is_same_v<pools_t::sorted_types,
+                             sort_t<by_capacity, p256, p64, p1k, p64b, p16>>);
+
+// Queries are constant expressions.
+static_assert(pools_t::find_at_least(100) == 0);
+static_assert(pools_t::find_at_least(64) == 1);
+static_assert(pools_t::find_at_least(2000) == pools_t::npos);
+
+// typelist form.
+static_assert(std::is_same_v<sorted_value_table<capacity_of, typelist<p256, p64>>::sorted_types,
+                             typelist<p64, p256>>);
+
+// --- Runtime queries ------------------------------------------------------
+
+TEST(SortedValueTable, PermutationsAreInverse) {
+    for (std::size_t i = 0; i < pools_t::size; ++i) {
+        EXPECT_EQ(pools_t::order[pools_t::rank[i]], i);
+        EXPECT_EQ(pools_t::rank[pools_t::order[i]], i);
+    }
+}
+
+TEST(SortedValueTable, BoundsMatchLinearScan) {
+    for (std::size_t x = 0; x <= 1100; ++x) {
+        std::size_t lo = 0, hi = 0;
+        while (lo < pools_t::size && pools_t::keys[lo] < x) ++lo;
+        while (hi < pools_t::size && pools_t::keys[hi] <= x) ++hi;
+        EXPECT_EQ(pools_t::lower_bound(x), lo) << "x=" << x;
+        EXPECT_EQ(pools_t::upper_bound(x), hi) << "x=" << x;
+
+        // First registered type with the smallest capacity >= x.
+        const std::size_t caps[] = {256, 64, 1024, 64, 16};
+        std::size_t best = pools_t::npos;
+        for (std::size_t i = 0; i < pools_t::size; ++i)
+            if (caps[i] >= x && (best == pools_t::npos || caps[i] < caps[best])) best = i;
+        EXPECT_EQ(pools_t::find_at_least(x), best) << "x=" << x;
+    }
+}
+
+TEST(SortedValueTable, VisitByRank) {
+    for (std::size_t r = 0; r < pools_t::size; ++r) {
+        const std::size_t cap = pools_t::visit(r, [](auto tag) {
+            return decltype(tag)::type::capacity;
+        });
+        EXPECT_EQ(cap, pools_t::keys[r]);
+    }
+}
+
+enum class level : std::int8_t { low = -1, mid = 0, high = 1 };
+
+template<level L> struct leveled { static constexpr level lvl = L; };
+template<typename T> struct level_of { static constexpr level value = T::lvl; };
+
+TEST(SortedValueTable, EnumAndSignedKeys) {
+    using t = sorted_value_table<level_of, leveled<level::high>, leveled<level::low>, leveled<level::mid>>;
+    static_assert(t::keys[0] == level::low && t::keys[2] == level::high);
+    EXPECT_EQ(t::find_at_least(level::mid), 2u);
+    EXPECT_EQ(t::upper_bound(level::high), t::npos);
+}
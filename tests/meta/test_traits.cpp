@@ -127,6 +127,20 @@ TEST(TraitsTest, Nth_Negative) {
     // using OutOfBoundsType = etools::meta::nth<3, int, double, char>::type;
 }
 
+TEST(TraitsTest, IndexOf_Positive) {
+    EXPECT_EQ((etools::meta::index_of_v<int, int, double, char>), 0u);
+    EXPECT_EQ((etools::meta::index_of_v<char, int, double, char>), 2u);
+    // First occurrence wins; qualifiers are part of the type.
+    EXPECT_EQ((etools::meta::index_of_v<int, double, int, int>), 1u);
+    EXPECT_EQ((etools::meta::index_of_v<const int, int, const int>), 1u);
+}
+
+TEST(TraitsTest, IndexOf_Negative) {
+    // Absent types report sizeof...(Ts).
+    EXPECT_EQ((etools::meta::index_of_v<float, int, double, char>), 3u);
+    EXPECT_EQ((etools::meta::index_of_v<float>), 0u);
+}
+
 TEST(TraitsTest, SmallestUintT_Positive) {
     // A value that fits in uint8_t.
     EXPECT_TRUE((std::is_same_v<etools::meta::smallest_uint_t<100>, std::uint8_t>));
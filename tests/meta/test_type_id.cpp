@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <etools/meta/type_id.hpp>
+#include <etools/hashing/optimal_mph.hpp>
+#include <etools/factories/dispatch_factory.hpp>
+#include <etools/meta/utility.hpp>
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+using namespace etools;
+using meta::type_id;
+using meta::type_name;
+
+namespace zoo {
+    struct animal {
+        virtual ~animal() = default;
+        virtual int legs() const noexcept = 0;
+    };
+    struct cat  : animal { int legs() const noexcept override { return 4; } };
+    struct bird : animal { int legs() const noexcept override { return 2; } };
+    struct fish : animal { int legs() const noexcept override { return 0; } };
+    template<typename T> struct box {};
+} // namespace zoo
+
+// --- type_name --------------------------------------------------------------
+
+static_assert(type_name<int>() == "int");
+static_assert(type_name<double>() == "double");
+
+TEST(TypeIdTest, TypeName_ContainsQualifiedSpelling) {
+    constexpr std::string_view n = type_name<zoo::cat>();
+    EXPECT_NE(n.find("zoo::cat"), std::string_view::npos) << n;
+    // Nothing of the enclosing function signature leaks into the name.
+    EXPECT_EQ(n.find("type_name"), std::string_view::npos) << n;
+    EXPECT_EQ(n.find("signature_of"), std::string_view::npos) << n;
+
+    constexpr std::string_view t = type_name<zoo::box<zoo::fish>>();
+    EXPECT_NE(t.find("zoo::box<"), std::string_view::npos) << t;
+    EXPECT_NE(t.find("zoo::fish"), std::string_view::npos) << t;
+}
+
+// --- type_id ----------------------------------------------------------------
+
+static_assert(type_id<int>() == type_id<int>());
+static_assert(type_id<int>() != type_id<unsigned>());
+static_assert(type_id<int>() != type_id<const int>());
+static_assert(type_id<int>() != type_id<int&>());
+static_assert(meta::type_id_v<zoo::cat> == type_id<zoo::cat>());
+static_assert(std::is_same_v<decltype(meta::type_id_of<zoo::cat>::value), const meta::type_id_t>);
+
+TEST(TypeIdTest, DistinctTypesGetDistinctIds) {
+    constexpr meta::type_id_t ids[] = {
+        type_id<zoo::cat>(), type_id<zoo::bird>(), type_id<zoo::fish>(),
+        type_id<zoo::box<zoo::cat>>(), type_id<zoo::box<zoo::bird>>(),
+        type_id<char>(), type_id<signed char>(), type_id<unsigned char>(),
+    };
+    static_assert(meta::all_distinct_fast(std::array<meta::type_id_t, 8>{
+        ids[0], ids[1], ids[2], ids[3], ids[4], ids[5], ids[6], ids[7]}));
+    SUCCEED();
+}
+
+// --- Consumers ----------------------------------------------------------------
+
+TEST(TypeIdTest, UsableAsOptimalMphKeys) {
+    constexpr const auto& mph = hashing::optimal_mph<meta::type_id_t>::instance<
+        type_id<zoo::cat>(), type_id<zoo::bird>(), type_id<zoo::fish>()>();
+    static_assert(mph.size() == 3);
+    static_assert(mph(type_id<zoo::cat>()) == 0);
+    static_assert(mph(type_id<zoo::bird>()) == 1);
+    static_assert(mph(type_id<zoo::fish>()) == 2);
+    EXPECT_EQ(mph(type_id<zoo::box<zoo::cat>>()), mph.not_found());
+}
+
+TEST(TypeIdTest, UsableAsDispatchFactoryExtractor) {
+    factories::dispatch_factory<zoo::animal, meta::type_id_of, zoo::cat, zoo::bird, zoo::fish> f;
+
+    auto b = f.emplace(type_id<zoo::bird>());
+    ASSERT_TRUE(b);
+    EXPECT_EQ(b->legs(), 2);
+
+    auto c = f.emplace(type_id<zoo::cat>());
+    ASSERT_TRUE(c);
+    EXPECT_EQ(c->legs(), 4);
+
+    EXPECT_FALSE(f.emplace(type_id<int>()));
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <etools/meta/type_map.hpp>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using namespace etools::meta;
+
+struct Cat {};
+struct Dog {};
+struct Bird {};
+struct Fish {};
+
+using counters_t = type_map<typelist<Cat, Dog, Bird>, std::uint32_t>;
+using mixed_t    = type_map<type_pair<Cat, int>, type_pair<Dog, std::string>, type_pair<Bird, double>>;
+
+// --- Compile-time shape ---------------------------------------------------
+
+static_assert(counters_t::size() == 3);
+static_assert(counters_t::index_of<Bird> == 2);
+static_assert(counters_t::contains<Dog>);
+static_assert(!counters_t::contains<Fish>);
+static_assert(std::is_same_v<counters_t::key_t<1>, Dog>);
+static_assert(std::is_same_v<mixed_t::value_t<Dog>, std::string>);
+static_assert(sizeof(counters_t) == 3 * sizeof(std::uint32_t));
+
+// Usable in constant expressions.
+constexpr counters_t make_counters() {
+    counters_t m{};
+    m.get<Dog>() = 5;
+    m[2] = 7;
+    return m;
+}
+static_assert(make_counters().get<Dog>() == 5);
+static_assert(make_counters().get<Bird>() == 7);
+static_assert(make_counters().visit(1, [](auto, std::uint32_t v) { return v * 2; }) == 10);
+
+// --- Homogeneous ----------------------------------------------------------
+
+TEST(TypeMapTest, Homogeneous_ValueInitialisedAndFill) {
+    counters_t zero;
+    for (auto v : zero) EXPECT_EQ(v, 0u);
+
+    counters_t seven{7u};
+    EXPECT_EQ(seven.get<Cat>(), 7u);
+    EXPECT_EQ(seven.get<Bird>(), 7u);
+}
+
+TEST(TypeMapTest, Homogeneous_AccessByTypeAndIndexAlias) {
+    counters_t m;
+    ++m.get<Dog>();
+    ++m.get<Dog>();
+    m.get<0>() = 9;
+    EXPECT_EQ(m[1], 2u);
+    EXPECT_EQ(&m[0], &m.get<Cat>());
+    EXPECT_EQ(std::as_const(m).get<Cat>(), 9u);
+}
+
+TEST(TypeMapTest, Homogeneous_RuntimeVisitPassesKeyType) {
+    counters_t m{1u};
+    std::size_t seen = 99;
+    m.visit(2, [&](auto key, std::uint32_t& v) {
+        using K = typename decltype(key)::type;
+        seen = counters_t::index_of<K>;
+        v = 42;
+    });
+    EXPECT_EQ(seen, 2u);
+    EXPECT_EQ(m.get<Bird>(), 42u);
+}
+
+TEST(TypeMapTest, Homogeneous_ForEachInKeyOrder) {
+    counters_t m;
+    std::string order;
+    m.for_each([&](auto key, std::uint32_t&) {
+        using K = typename decltype(key)::type;
+        if constexpr (std::is_same_v<K, Cat>)  order += 'c';
+        if constexpr (std::is_same_v<K, Dog>)  order += 'd';
+        if constexpr (std::is_same_v<K, Bird>) order += 'b';
+    });
+    EXPECT_EQ(order, "cdb");
+}
+
+// --- Heterogeneous --------------------------------------------------------
+
+TEST(TypeMapTest, Heterogeneous_PerKeyValueTypes) {
+    mixed_t m;
+    m.get<Cat>() = 3;
+    m.get<Dog>() = "rex";
+    m.get<Bird>() = 0.5;
+    EXPECT_EQ(m.get<0>(), 3);
+    EXPECT_EQ(std::as_const(m).get<Dog>(), "rex");
+    EXPECT_DOUBLE_EQ(m.get<2>(), 0.5);
+}
+
+TEST(TypeMapTest, Heterogeneous_RuntimeVisit) {
+    mixed_t m;
+    m.get<Dog>() = "rex";
+    auto describe = [](auto, const auto& v) -> std::string {
+        if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::string>) return v;
+        else return std::to_string(v);
+    };
+    EXPECT_EQ(std::as_const(m).visit(1, describe), "rex");
+    EXPECT_EQ(std::as_const(m).visit(0, describe), "0");
+}
+
+TEST(TypeMapTest, Heterogeneous_ForEachMutates) {
+    mixed_t m;
+    m.for_each([](auto, auto& v) {
+        if constexpr (std::is_arithmetic_v<std::decay_t<decltype(v)>>) v += 1;
+        else v = "set";
+    });
+    EXPECT_EQ(m.get<Cat>(), 1);
+    EXPECT_EQ(m.get<Dog>(), "set");
+    EXPECT_DOUBLE_EQ(m.get<Bird>(), 1.0);
+}
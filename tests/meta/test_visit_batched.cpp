@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <etools/meta/visit_batched.hpp>
+#include <etools/meta/overload.hpp>
+#include <string>
+#include <variant>
+#include <vector>
+
+using namespace etools::meta;
+
+// --- std::variant ---------------------------------------------------------
+
+TEST(VisitBatchedTest, StdVariant_VisitsEveryElementOnce) {
+    std::vector<std::variant<int, double, std::string>> v = {
+        1, 2.5, std::string("a"), 3, std::string("bc"), 0.5, 4,
+    };
+    int isum = 0; double dsum = 0; std::string cat;
+    visit_batched(v.data(), v.size(), overload{
+        [&](int i)                { isum += i; },
+        [&](double d)             { dsum += d; },
+        [&](const std::string& s) { cat += s; },
+    });
+    EXPECT_EQ(isum, 8);
+    EXPECT_DOUBLE_EQ(dsum, 3.0);
+    EXPECT_EQ(cat, "abc");
+}
+
+TEST(VisitBatchedTest, StdVariant_GroupsByAlternativeStably) {
+    // Fully interleaved: sorted into groups, each group in array order.
+    std::vector<std::variant<int, char>> v = { 1, 'a', 2, 'b', 3, 'c' };
+    std::string trace;
+    visit_batched(v.data(), v.size(), overload{
+        [&](int i)  { trace += char('0' + i); },
+        [&](char c) { trace += c; },
+    });
+    EXPECT_EQ(trace, "123abc");
+}
+
+TEST(VisitBatchedTest, LongRunsAreVisitedInPlace) {
+    // One switch in twelve elements: below the sorting threshold.
+    std::vector<std::variant<int, char>> v = { 1, 2, 3, 4, 5, 6, 'a', 'b', 'c', 'd', 'e', 'f' };
+    std::string trace;
+    visit_batched(v.data(), v.size(), overload{
+        [&](int i)  { trace += char('0' + i); },
+        [&](char c) { trace += c; },
+    });
+    EXPECT_EQ(trace, "123456abcdef");
+}
+
+TEST(VisitBatchedTest, SkipsValuelessElements) {
+    struct Throws {
+        Throws() = default;
+        Throws(const Throws&) { throw 1; }
+    };
+    std::vector<std::variant<int, Throws>> v(4, 1);
+    try { v[2].emplace<Throws>(Throws{}); } catch (int) {}
+    ASSERT_TRUE(v[2].valueless_by_exception());
+    v[1].emplace<Throws>();  // break up the run so the chunk is sorted
+
+    int ints = 0, others = 0;
+    visit_batched(v.data(), v.size(), overload{
+        [&](int)           { ++ints; },
+        [&](const Throws&) { ++others; },
+    });
+    EXPECT_EQ(ints, 2);
+    EXPECT_EQ(others, 1);
+}
+
+TEST(VisitBatchedTest, StdVariant_MutatesThroughNonConstPointer) {
+    std::vector<std::variant<int, double>> v = { 1, 2.0, 3 };
+    visit_batched(v.data(), v.size(), [](auto& x) { x *= 10; });
+    EXPECT_EQ(std::get<int>(v[0]), 10);
+    EXPECT_DOUBLE_EQ(std::get<double>(v[1]), 20.0);
+    EXPECT_EQ(std::get<int>(v[2]), 30);
+}
+
+// --- fast_variant ---------------------------------------------------------
+
+TEST(VisitBatchedTest, FastVariant_ConstAccess) {
+    const std::vector<fast_variant<int, float>> v = { 1, 2.f, 3, 4.f };
+    int ints = 0, floats = 0;
+    visit_batched(v.data(), v.size(), overload{
+        [&](const int&)   { ++ints; },
+        [&](const float&) { ++floats; },
+    });
+    EXPECT_EQ(ints, 2);
+    EXPECT_EQ(floats, 2);
+}
+
+// --- Chunking -------------------------------------------------------------
+
+TEST(VisitBatchedTest, ChunkBoundariesCoverEveryElement) {
+    std::vector<std::variant<int, long>> v;
+    for (int i = 0; i < 1000; ++i) {
+        if (i % 3) v.emplace_back(i);
+        else       v.emplace_back(long(i));
+    }
+    long sum = 0;
+    std::size_t calls = 0;
+    visit_batched<7>(v.data(), v.size(), [&](auto x) { sum += x; ++calls; });
+    EXPECT_EQ(calls, 1000u);
+    EXPECT_EQ(sum, 999L * 1000 / 2);
+}
+
+TEST(VisitBatchedTest, EmptyRangeIsNoOp) {
+    std::variant<int, char>* none = nullptr;
+    bool called = false;
+    visit_batched(none, 0, [&](auto) { called = true; });
+    EXPECT_FALSE(called);
+}
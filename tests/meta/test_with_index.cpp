@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include <etools/meta/with_index.hpp>
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+using namespace etools::meta;
+
+template<std::size_t N>
+constexpr std::size_t squared(std::size_t i) {
+    return with_index<N>(i, [](auto I) { return I() * I(); });
+}
+
+// Both lowerings are usable in constant expressions.
+static_assert(squared<1>(0) == 0);
+static_assert(squared<16>(15) == 225);    // switch
+static_assert(squared<17>(16) == 256);    // function-pointer table
+static_assert(squared<300>(299) == 299 * 299);
+
+namespace {
+
+struct nothrow_fn { template<typename I> void operator()(I) noexcept {} };
+struct throwing_fn { template<typename I> void operator()(I) {} };
+
+struct counter {
+    int calls = 0;
+    template<std::size_t I>
+    void operator()(std::integral_constant<std::size_t, I>) & { ++calls; }
+};
+
+template<std::size_t N>
+void check_every_index() {
+    for (std::size_t i = 0; i < N; ++i) {
+        std::size_t seen = N;
+        with_index<N>(i, [&](auto I) { seen = I(); });
+        EXPECT_EQ(seen, i) << "N=" << N;
+    }
+}
+
+} // namespace
+
+// noexcept follows the callable.
+static_assert(noexcept(with_index<4>(0, std::declval<nothrow_fn&>())));
+static_assert(!noexcept(with_index<4>(0, std::declval<throwing_fn&>())));
+
+TEST(WithIndex, EveryIndexReachesItsConstant) {
+    check_every_index<1>();
+    check_every_index<7>();
+    check_every_index<16>();
+    check_every_index<17>();
+    check_every_index<100>();
+}
+
+TEST(WithIndex, ForwardsReferenceResults) {
+    std::tuple<int, int, int> t{1, 2, 3};
+    int& r = with_index<3>(1, [&](auto I) -> int& { return std::get<I()>(t); });
+    r = 20;
+    EXPECT_EQ(std::get<1>(t), 20);
+}
+
+TEST(WithIndex, SelectsTupleElementType) {
+    std::tuple<char, double, std::array<int, 5>> t{};
+    for (std::size_t i = 0; i < 3; ++i) {
+        const std::size_t size = with_index<3>(i, [&](auto I) { return sizeof(std::get<I()>(t)); });
+        const std::size_t expected[] = {sizeof(char), sizeof(double), sizeof(std::array<int, 5>)};
+        EXPECT_EQ(size, expected[i]);
+    }
+}
+
+TEST(WithIndex, CallableInvokedOnceAsLvalue) {
+    counter c;
+    with_index<40>(33, c);
+    with_index<4>(3, c);
+    EXPECT_EQ(c.calls, 2);
+}
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <etools/trace/events.hpp>
+
+namespace test_trace {
+
+struct entry {
+    char ph;
+    etools::trace::event e;
+    std::uint64_t arg;
+};
+
+// Must be declared before any etools header that includes trace/hooks.hpp.
+struct recording_policy {
+    static constexpr bool enabled = true;
+    static inline std::vector<entry> log;
+    static void begin(etools::trace::event e, std::uint64_t a) noexcept { log.push_back({'B', e, a}); }
+    static void end(etools::trace::event e, std::uint64_t a) noexcept { log.push_back({'E', e, a}); }
+    static void instant(etools::trace::event e, std::uint64_t a) noexcept { log.push_back({'i', e, a}); }
+};
+
+} // namespace test_trace
+
+#define ETOOLS_TRACE_POLICY ::test_trace::recording_policy
+
+#include <etools/factories/dispatch_factory.hpp>
+#include <etools/hashing/fks.hpp>
+#include <etools/hashing/llut.hpp>
+#include <etools/memory/buffer.hpp>
+#include <etools/memory/buffer_view.hpp>
+
+#ifdef ETOOLS_TRACE_HAS_BUILTIN
+    #error "trace/hooks.tpp must not leak its feature-test helper"
+#endif
+
+using namespace etools;
+using trace::event;
+using test_trace::recording_policy;
+
+namespace {
+
+struct base {
+    virtual ~base() = default;
+};
+
+struct small : base {
+    static constexpr std::uint8_t key = 3;
+    int v;
+    explicit small(int x) noexcept : v(x) {}
+};
+
+struct other : base {
+    static constexpr std::uint8_t key = 9;
+};
+
+std::vector<test_trace::entry>& fresh_log() {
+    recording_policy::log.clear();
+    return recording_policy::log;
+}
+
+} // namespace
+
+TEST(TraceHooks, PolicyIsSelectedByMacro) {
+    static_assert(trace::enabled);
+    static_assert(std::is_same_v<trace::policy, recording_policy>);
+}
+
+TEST(TraceHooks, SpanReportsBeginAndEndWithUpdatedArg) {
+    auto& log = fresh_log();
+    {
+        trace::span<event::buffer_pack> s{1};
+        s.arg(42);
+    }
+    ASSERT_EQ(log.size(), 2u);
+    EXPECT_EQ(log[0].ph, 'B');
+    EXPECT_EQ(log[0].arg, 1u);
+    EXPECT_EQ(log[1].ph, 'E');
+    EXPECT_EQ(log[1].e, event::buffer_pack);
+    EXPECT_EQ(log[1].arg, 42u);
+}
+
+TEST(TraceHooks, PerfectHashLookupsReportHitAndMissAtRuntimeOnly) {
+    constexpr const auto& f = hashing::fks<std::uint32_t>::instance<10, 2000, 70000>();
+    constexpr const auto& l = hashing::llut<std::uint8_t>::instance<1, 4, 6>();
+    static_assert(f(2000) == 1);  // constant evaluation stays silent and valid
+    static_assert(l(6) == 2);
+
+    auto& log = fresh_log();
+    volatile std::uint32_t fk = 70000;
+    volatile std::uint8_t  lk = 5;
+    EXPECT_EQ(f(fk), 2u);
+    EXPECT_EQ(l(lk), l.not_found());
+    ASSERT_EQ(log.size(), 2u);
+    EXPECT_EQ(log[0].ph, 'i');
+    EXPECT_EQ(log[0].e, event::hash_hit);
+    EXPECT_EQ(log[0].arg, 70000u);
+    EXPECT_EQ(log[1].e, event::hash_miss);
+    EXPECT_EQ(log[1].arg, 5u);
+}
+
+TEST(TraceHooks, DispatchFactoryReportsEmplaceReleaseAndSlots) {
+    using namespace factories::utils;
+    factories::keyed_dispatch_factory<base, capacity<small, 2>, other> factory;
+
+    auto& log = fresh_log();
+    auto h = factory.emplace(small::key, 5);
+    ASSERT_TRUE(h);
+    // B emplace, i hash hit, i pool acquire (slot 0), E emplace
+    ASSERT_EQ(log.size(), 4u);
+    EXPECT_EQ(log[0].ph, 'B');
+    EXPECT_EQ(log[0].e, event::factory_emplace);
+    EXPECT_EQ(log[0].arg, small::key);
+    EXPECT_EQ(log[1].e, event::hash_hit);
+    EXPECT_EQ(log[2].e, event::pool_acquire);
+    EXPECT_EQ(log[2].arg, 0u);
+    EXPECT_EQ(log[3].ph, 'E');
+
+    log.clear();
+    h.reset();
+    // B release, i hash hit, i pool release (slot 0), E release
+    ASSERT_EQ(log.size(), 4u);
+    EXPECT_EQ(log[0].e, event::factory_release);
+    EXPECT_EQ(log[2].e, event::pool_release);
+    EXPECT_EQ(log[3].ph, 'E');
+    EXPECT_EQ(log[3].e, event::factory_release);
+
+    log.clear();
+    EXPECT_FALSE(factory.emplace(std::uint8_t{42}));
+    ASSERT_EQ(log.size(), 3u);
+    EXPECT_EQ(log[1].e, event::hash_miss);
+}
+
+TEST(TraceHooks, BufferReportsPackAndUnpackSizes) {
+    memory::buffer b{std::make_unique<std::byte[]>(16), 16};
+
+    auto& log = fresh_log();
+    const std::size_t n = b.pack(std::uint32_t{7}, std::uint16_t{9});
+    ASSERT_EQ(log.size(), 2u);
+    EXPECT_EQ(log[0].e, event::buffer_pack);
+    EXPECT_EQ(log[1].ph, 'E');
+    EXPECT_EQ(log[1].arg, n);
+
+    log.clear();
+    ASSERT_TRUE((b.unpack<std::uint32_t, std::uint16_t>()));
+    ASSERT_TRUE((memory::buffer_view{b.data(), b.size()}.unpack<std::uint32_t, std::uint16_t>()));
+    ASSERT_EQ(log.size(), 4u);
+    for (const auto& x : log) {
+        EXPECT_EQ(x.e, event::buffer_unpack);
+        EXPECT_EQ(x.arg, n);
+    }
+}
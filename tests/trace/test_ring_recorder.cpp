@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#include <etools/trace/ring_recorder.hpp>
+
+using recorder = etools::trace::ring_recorder<8, 2>;
+#define ETOOLS_TRACE_POLICY ::recorder
+
+#include <etools/trace/trace.hpp>
+#include <etools/hashing/llut.hpp>
+
+using namespace etools;
+using trace::event;
+
+namespace {
+
+std::string dump(double ticks_per_us = 1.0) {
+    std::FILE* f = std::tmpfile();
+    recorder::write_chrome_trace(f, ticks_per_us);
+    std::string s(static_cast<std::size_t>(std::ftell(f)), '\0');
+    std::rewind(f);
+    const std::size_t n = std::fread(s.data(), 1, s.size(), f);
+    std::fclose(f);
+    s.resize(n);
+    return s;
+}
+
+std::size_t count(const std::string& s, const std::string& what) {
+    std::size_t n = 0;
+    for (auto p = s.find(what); p != std::string::npos; p = s.find(what, p + 1)) ++n;
+    return n;
+}
+
+} // namespace
+
+TEST(RingRecorder, TscIsMonotonicAndCalibrated) {
+    const std::uint64_t a = trace::read_tsc();
+    const std::uint64_t b = trace::read_tsc();
+    EXPECT_LE(a, b);
+    EXPECT_GT(trace::tsc_ticks_per_us(), 0.0);
+}
+
+TEST(RingRecorder, RecordsSpansAndInstantsAsChromeJson) {
+    recorder::clear();
+    {
+        trace::span<event::buffer_pack> s;
+        s.arg(12);
+    }
+    constexpr const auto& t = hashing::llut<std::uint8_t>::instance<1, 2>();
+    volatile std::uint8_t k = 2;
+    EXPECT_EQ(t(k), 1u);
+    EXPECT_EQ(recorder::size(), 3u);
+
+    const std::string json = dump();
+    EXPECT_EQ(json.rfind("{\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(json.find("],\"displayTimeUnit\":\"ns\"}"), std::string::npos);
+    EXPECT_EQ(count(json, "\"name\":\"buffer::pack\",\"cat\":\"memory\",\"ph\":\"B\""), 1u);
+    EXPECT_EQ(count(json, "\"ph\":\"E\""), 1u);
+    EXPECT_EQ(count(json, "\"args\":{\"arg\":12}"), 1u);
+    EXPECT_EQ(count(json, "\"name\":\"mph::hit\",\"cat\":\"hashing\",\"ph\":\"i\",\"s\":\"t\""), 1u);
+    EXPECT_EQ(count(json, "\"tid\":1"), 3u);
+    EXPECT_NE(json.find("\"ts\":0.000"), std::string::npos);
+}
+
+TEST(RingRecorder, KeepsOnlyTheNewestCapacityRecords) {
+    recorder::clear();
+    for (std::uint64_t i = 0; i < 20; ++i) trace::instant<event::pool_acquire>(i);
+    EXPECT_EQ(recorder::size(), 8u);
+    const std::string json = dump();
+    EXPECT_EQ(count(json, "\"name\""), 8u);
+    EXPECT_EQ(count(json, "\"args\":{\"arg\":11}"), 0u);
+    EXPECT_EQ(count(json, "\"args\":{\"arg\":12}"), 1u);
+    EXPECT_EQ(count(json, "\"args\":{\"arg\":19}"), 1u);
+}
+
+TEST(RingRecorder, EachThreadGetsItsOwnRingUntilTheyRunOut) {
+    recorder::clear();
+    trace::instant<event::pool_release>(1);
+
+    std::thread([] { trace::instant<event::pool_release>(2); }).join();
+    std::thread([] { trace::instant<event::pool_release>(3); }).join();  // third thread: no ring left
+
+    EXPECT_EQ(recorder::size(), 2u);
+    EXPECT_EQ(recorder::dropped(), 1u);
+    const std::string json = dump();
+    EXPECT_EQ(count(json, "\"tid\":1,\"args\":{\"arg\":1}"), 1u);
+    EXPECT_EQ(count(json, "\"tid\":2,\"args\":{\"arg\":2}"), 1u);
+    EXPECT_EQ(count(json, "\"arg\":3"), 0u);
+}